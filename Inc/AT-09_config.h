@@ -39,7 +39,42 @@
 #endif
 
 #ifndef ETX_OTA_VERBOSE
-#define ETX_OTA_VERBOSE 			        (0U)   	        	                                        /**< @brief Flag value used to enable the compiler to take into account the code of both the @ref hm10_ble_clone library that displays detailed information about the processes made inside them via @ref printf with a \c 1 . Otherwise, a \c 0 for not displaying any messages at all with @ref printf . */
+#define ETX_OTA_VERBOSE 			        (0U)   	        	                                        /**< @brief Flag value used to enable the compiler to take into account the code of both the @ref hm10_ble_clone library that displays detailed information about the processes made inside them via @ref printf with a \c 1 . Otherwise, a \c 0 for not displaying any messages at all with @ref printf . @note This flag only gives the default value of the per-subsystem log levels (e.g., @ref HM10_CLONE_LOG_LEVEL_CMD ), which can be individually overridden instead. */
+#endif
+
+#define HM10_CLONE_LOG_NONE                 (0U)                                                        /**< @brief Log level with which no messages at all are given. */
+#define HM10_CLONE_LOG_ERROR                (1U)                                                        /**< @brief Log level with which only the error messages are given. */
+#define HM10_CLONE_LOG_WARN                 (2U)                                                        /**< @brief Log level with which the error and warning messages are given. */
+#define HM10_CLONE_LOG_INFO                 (3U)                                                        /**< @brief Log level with which the error, warning and informative messages are given. */
+#define HM10_CLONE_LOG_DEBUG                (4U)                                                        /**< @brief Log level with which all the messages are given, including the detailed ones that are given for each transferred packet or byte. */
+
+#ifndef HM10_CLONE_LOG_LEVEL_CMD
+#define HM10_CLONE_LOG_LEVEL_CMD            (ETX_OTA_VERBOSE ? HM10_CLONE_LOG_DEBUG : HM10_CLONE_LOG_NONE)  /**< @brief Log level of the messages given by the AT Command engine of the @ref hm10_ble_clone (e.g., @ref send_hm10clone_name_cmd ), which can be any of @ref HM10_CLONE_LOG_NONE , @ref HM10_CLONE_LOG_ERROR , @ref HM10_CLONE_LOG_WARN , @ref HM10_CLONE_LOG_INFO or @ref HM10_CLONE_LOG_DEBUG . @note The messages below this level are compiled out entirely, so their strings do not take any FLASH memory. */
+#endif
+
+#ifndef HM10_CLONE_LOG_LEVEL_DATA
+#define HM10_CLONE_LOG_LEVEL_DATA           (ETX_OTA_VERBOSE ? HM10_CLONE_LOG_DEBUG : HM10_CLONE_LOG_NONE)  /**< @brief Log level of the messages given by the OTA data path of the @ref hm10_ble_clone (i.e., @ref send_hm10clone_ota_data and @ref get_hm10clone_ota_data ). @note A value of @ref HM10_CLONE_LOG_ERROR is suggested for production builds. */
+#endif
+
+#ifndef HM10_CLONE_LOG_LEVEL_CONN
+#define HM10_CLONE_LOG_LEVEL_CONN           (ETX_OTA_VERBOSE ? HM10_CLONE_LOG_DEBUG : HM10_CLONE_LOG_NONE)  /**< @brief Log level of the messages given by the @ref hm10_ble_clone about the BLE Connection State of the HM-10 Clone BLE Device. */
+#endif
+
+#ifndef HM10_CLONE_LOG_LEVEL_FLUSH
+#define HM10_CLONE_LOG_LEVEL_FLUSH          (ETX_OTA_VERBOSE ? HM10_CLONE_LOG_DEBUG : HM10_CLONE_LOG_NONE)  /**< @brief Log level of the messages given by the @ref hm10_ble_clone whenever flushing the RX of its UART. */
+#endif
+
+#define HM10_CLONE_LOG_ENABLED              ((HM10_CLONE_LOG_LEVEL_CMD > HM10_CLONE_LOG_NONE) || (HM10_CLONE_LOG_LEVEL_DATA > HM10_CLONE_LOG_NONE) || (HM10_CLONE_LOG_LEVEL_CONN > HM10_CLONE_LOG_NONE) || (HM10_CLONE_LOG_LEVEL_FLUSH > HM10_CLONE_LOG_NONE))  /**< @brief Flag that indicates whether any of the messages of the @ref hm10_ble_clone is enabled by the per-subsystem log levels. */
+
+#define HM10_CLONE_VERBOSE_BACKEND_PRINTF   (0U)                                                        /**< @brief @ref HM10_CLONE_VERBOSE_BACKEND value with which the messages of the @ref hm10_ble_clone are displayed synchronously via @ref printf . */
+#define HM10_CLONE_VERBOSE_BACKEND_TRACE    (1U)                                                        /**< @brief @ref HM10_CLONE_VERBOSE_BACKEND value with which the messages of the @ref hm10_ble_clone are stored as binary records into a RAM ring buffer (see @ref AT_09_trace_events ). */
+
+#ifndef HM10_CLONE_VERBOSE_BACKEND
+#define HM10_CLONE_VERBOSE_BACKEND          (HM10_CLONE_VERBOSE_BACKEND_PRINTF)                         /**< @brief Designated way in which the messages of the @ref hm10_ble_clone are given whenever any of the per-subsystem log levels (e.g., @ref HM10_CLONE_LOG_LEVEL_CMD ) is enabled, which can be either @ref HM10_CLONE_VERBOSE_BACKEND_PRINTF or @ref HM10_CLONE_VERBOSE_BACKEND_TRACE . @note Each message given via @ref printf takes tens of milliseconds with the UART1 as its output, which distorts the timing of the processes that are being debugged. The @ref HM10_CLONE_VERBOSE_BACKEND_TRACE backend takes only a few CPU cycles per message instead, so it can be kept enabled in production. */
+#endif
+
+#ifndef HM10_CLONE_TRACE_BUFFER_RECORDS
+#define HM10_CLONE_TRACE_BUFFER_RECORDS     (64U)                                                       /**< @brief Number of @ref HM10_Clone_Trace_Record records that the binary trace ring buffer can hold before the oldest ones start to be overwritten, which must be a power of two. @note Each record takes 16 bytes of RAM. */
 #endif
 
 #ifndef HM10_CLONE_DEFAULT_BLE_NAME
@@ -62,6 +97,242 @@
 #define HM10_CLONE_CUSTOM_HAL_TIMEOUT	    (120U)				                						/**< @brief Designated time in milliseconds for the HAL Timeout to be requested during each FLASH request in our MCU/MPU that are used in the @ref hm10_ble_clone . @note For more details see @ref FLASH_WaitForLastOperation . @note As a reference, the lowest value at which the author the @ref hm10_ble_clone had always unsuccessful responses was with 100 milliseconds. On the other hand, 120 milliseconds worked most of the times but it did not on some rare occasions. Therefore, it is suggested that the implementer/user of the @ref hm10_ble_clone to assign a more convenient value for this field with which the implementer feels more confident that it will always work well. */
 #endif
 
+#ifndef HM10_CLONE_MAX_FLUSH_BYTES
+#define HM10_CLONE_MAX_FLUSH_BYTES          (64U)                                                       /**< @brief Designated maximum number of bytes that are discarded from the RX of the UART each time that it is flushed before an AT Command, so that the time of that flush is bounded to this many times @ref HM10_CLONE_CUSTOM_HAL_TIMEOUT even if the HM-10 Clone BLE Device sends data endlessly. */
+#endif
+
+#ifndef HM10_CLONE_RETRY_MAX_ATTEMPTS
+#define HM10_CLONE_RETRY_MAX_ATTEMPTS       (2U)                                                        /**< @brief Designated default maximum number of attempts of each AT Command (see @ref HM10_Clone_Retry_Policy ). @note The default of two attempts is because the first command after waking up the HM-10 Clone BLE Device is ignored by it. */
+#endif
+
+#ifndef HM10_CLONE_RETRY_BACKOFF_MS
+#define HM10_CLONE_RETRY_BACKOFF_MS         0, 0, 0, 0                                                  /**< @brief Designated default backoff schedule in milliseconds of the retries of the AT Commands, which must consist of @ref HM10_CLONE_RETRY_BACKOFF_STEPS values (see @ref HM10_Clone_Retry_Policy ). */
+#endif
+
+#ifndef HM10_CLONE_RETRY_ON_NR
+#define HM10_CLONE_RETRY_ON_NR              (1U)                                                        /**< @brief Flag used to retry, with a \c 1 , the attempts of the AT Commands that concluded with @ref HM10_Clone_EC_NR by default. Otherwise, a \c 0 for not retrying them. */
+#endif
+
+#ifndef HM10_CLONE_RETRY_ON_ERR
+#define HM10_CLONE_RETRY_ON_ERR             (1U)                                                        /**< @brief Flag used to retry, with a \c 1 , the attempts of the AT Commands that concluded with @ref HM10_Clone_EC_ERR due to the UART by default. Otherwise, a \c 0 for not retrying them. */
+#endif
+
+#ifndef HM10_CLONE_ADAPTIVE_TIMEOUT
+#define HM10_CLONE_ADAPTIVE_TIMEOUT         (1U)                                                        /**< @brief Flag used to enable, with a \c 1 , the adaptive timeouts of the AT Commands of the @ref hm10_ble_clone . Otherwise, a \c 0 for using @ref HM10_CLONE_CUSTOM_HAL_TIMEOUT on every transmission and reception of the AT Commands. @details With the adaptive timeouts, a round-trip time estimate is kept for each AT Command type as a smoothed mean and variation, just like the retransmission timer of TCP. The timeout with which each Response is received is then given by that mean plus four times that variation, plus the time that the Response takes in the wire at the current baud rate of the UART, bounded by @ref HM10_CLONE_ADAPTIVE_TIMEOUT_MIN and @ref HM10_CLONE_ADAPTIVE_TIMEOUT_MAX . @note @ref HM10_CLONE_CUSTOM_HAL_TIMEOUT is still used as the initial estimate of each AT Command type and for flushing the RX of the UART. */
+#endif
+
+#ifndef HM10_CLONE_ADAPTIVE_TIMEOUT_MIN
+#define HM10_CLONE_ADAPTIVE_TIMEOUT_MIN     (20U)                                                       /**< @brief Lowest timeout in milliseconds that the adaptive timeouts can give (see @ref HM10_CLONE_ADAPTIVE_TIMEOUT ). */
+#endif
+
+#ifndef HM10_CLONE_ADAPTIVE_TIMEOUT_MAX
+#define HM10_CLONE_ADAPTIVE_TIMEOUT_MAX     (500U)                                                      /**< @brief Highest timeout in milliseconds that the adaptive timeouts can give (see @ref HM10_CLONE_ADAPTIVE_TIMEOUT ). */
+#endif
+
+#ifndef HM10_CLONE_STATS
+#define HM10_CLONE_STATS                    (1U)                                                        /**< @brief Flag used to enable, with a \c 1 , the always-on performance counters and health statistics of the @ref hm10_ble_clone (see @ref get_hm10clone_stats ). Otherwise, a \c 0 for not compiling the code of those counters at all. */
+#endif
+
+#ifndef HM10_CLONE_NONBLOCKING_API
+#define HM10_CLONE_NONBLOCKING_API          (1U)                                                        /**< @brief Flag used to enable, with a \c 1 , the non-blocking start/poll variants of the AT Commands of the @ref hm10_ble_clone (see @ref poll_hm10clone_transaction ). Otherwise, a \c 0 for not compiling them at all. */
+#endif
+
+#ifndef HM10_CLONE_RTOS
+#define HM10_CLONE_RTOS                     (0U)                                                        /**< @brief Flag used to enable, with a \c 1 , the RTOS integration of the @ref hm10_ble_clone (see @ref HM10_Clone_OS_Port ), with which its calls are serialised by a mutex and its UART transfers block the calling task on a semaphore that is signalled from the UART interrupts instead of polling the HAL Tick. Otherwise, a \c 0 for a bare-metal build that uses the Polling mode of the UART. @note It can also be run on a host computer with the POSIX threads @ref HM10_Clone_OS_Port of "tools/posix_hal/AT-09_os_port_pthread.h" (see "tools/AT-09_rtos_stress.c"). */
+#endif
+
+#ifndef HM10_CLONE_NAME_CMDS
+#define HM10_CLONE_NAME_CMDS                (1U)                                                        /**< @brief Flag used to enable, with a \c 1 , the Name Commands of the @ref hm10_ble_clone (see @ref set_hm10clone_name ). Otherwise, a \c 0 for not compiling them at all. @note The length of the Tx/Rx buffer of the AT Commands is given by the longest AT Command that is compiled in, so disabling the Name Commands also shrinks it from 21 to 14 bytes. */
+#endif
+
+#ifndef HM10_CLONE_ROLE_CMDS
+#define HM10_CLONE_ROLE_CMDS                (1U)                                                        /**< @brief Flag used to enable, with a \c 1 , the Role Commands of the @ref hm10_ble_clone (see @ref set_hm10clone_role ). Otherwise, a \c 0 for not compiling them at all. */
+#endif
+
+#ifndef HM10_CLONE_PIN_CMDS
+#define HM10_CLONE_PIN_CMDS                 (1U)                                                        /**< @brief Flag used to enable, with a \c 1 , the Pin Commands of the @ref hm10_ble_clone (see @ref set_hm10clone_pin ). Otherwise, a \c 0 for not compiling them at all. */
+#endif
+
+#ifndef HM10_CLONE_TYPE_CMDS
+#define HM10_CLONE_TYPE_CMDS                (1U)                                                        /**< @brief Flag used to enable, with a \c 1 , the Type Commands of the @ref hm10_ble_clone (see @ref set_hm10clone_pin_code_mode ). Otherwise, a \c 0 for not compiling them at all. */
+#endif
+
+#ifndef HM10_CLONE_GETTER_CMDS
+#define HM10_CLONE_GETTER_CMDS              (1U)                                                        /**< @brief Flag used to enable, with a \c 1 , the Get Commands of the enabled command families of the @ref hm10_ble_clone (e.g., @ref get_hm10clone_name ). Otherwise, a \c 0 for only compiling their Set Commands, which is enough for a firmware that configures the HM-10 Clone BLE Device without reading its settings back. */
+#endif
+
+#ifndef HM10_CLONE_STATE_PIN
+#define HM10_CLONE_STATE_PIN                (1U)                                                        /**< @brief Flag used to enable, with a \c 1 , the reading of the STATE pin of the HM-10 Clone BLE Device (see @ref set_hm10clone_state_pin ), together with the @ref GPIO_def_t structure. Otherwise, a \c 0 for not compiling them at all. @note @ref HM10_CLONE_CENTRAL_API requires this flag. */
+#endif
+
+#ifndef HM10_CLONE_CONNECTED_POLICY
+#define HM10_CLONE_CONNECTED_POLICY         (1U)                                                        /**< @brief Designated default @ref HM10_Clone_Connected_Policy of the AT Commands that are requested while the STATE pin of the HM-10 Clone BLE Device is high (see @ref set_hm10clone_connected_policy ), where \c 0 sends them anyway, \c 1 rejects them right away with @ref HM10_Clone_EC_CONNECTED and \c 2 holds them until the HM-10 Clone BLE Device disconnects. @note The HM-10 Clone BLE Device forwards the AT Commands that it receives while connected Over the Air to its peer instead of executing them, so sending them anyway only makes sense whenever no STATE pin has been set. */
+#endif
+
+#ifndef HM10_CLONE_CONNECTED_WAIT_TIMEOUT
+#define HM10_CLONE_CONNECTED_WAIT_TIMEOUT   (5000U)                                                     /**< @brief Designated default time in milliseconds that an AT Command is held by the @ref HM10_Clone_Connected_WAIT policy until the HM-10 Clone BLE Device disconnects, before concluding it with @ref HM10_Clone_EC_CONNECTED (see @ref set_hm10clone_connected_policy ). */
+#endif
+
+#ifndef HM10_CLONE_POWER_PIN
+#define HM10_CLONE_POWER_PIN                (0U)                                                        /**< @brief Flag used to enable, with a \c 1 , the control of an external circuitry that switches the power supply, or that drives the reset line, of the HM-10 Clone BLE Device (see @ref set_hm10clone_power_pin ), together with @ref disconnect_hm10clone_device and the caching of the configuration that is set to the HM-10 Clone BLE Device. Otherwise, a \c 0 for not compiling them at all. */
+#endif
+
+#ifndef HM10_CLONE_POWER_OFF_TIME
+#define HM10_CLONE_POWER_OFF_TIME           (100U)                                                      /**< @brief Designated time in milliseconds during which @ref disconnect_hm10clone_device keeps the HM-10 Clone BLE Device powered off, which must be long enough for the decoupling capacitors of its board to discharge below the power-on reset threshold of the HM-10 Clone BLE Device. */
+#endif
+
+#ifndef HM10_CLONE_POWER_READY_TIMEOUT
+#define HM10_CLONE_POWER_READY_TIMEOUT      (1500U)                                                     /**< @brief Designated maximum time in milliseconds that @ref disconnect_hm10clone_device waits for the HM-10 Clone BLE Device to answer the Test Command after powering it back on. */
+#endif
+
+#ifndef HM10_CLONE_CENTRAL_API
+#define HM10_CLONE_CENTRAL_API              (HM10_CLONE_STATE_PIN)                                      /**< @brief Flag used to enable, with a \c 1 , the Central mode functions of the @ref hm10_ble_clone (see @ref scan_hm10clone_devices ). Otherwise, a \c 0 for not compiling them at all. @note These functions require @ref HM10_CLONE_STATE_PIN , so they are left out by default whenever it is disabled. */
+#endif
+
+#ifndef HM10_CLONE_SCAN_CMD
+#define HM10_CLONE_SCAN_CMD                 "AT+INQ"                                                    /**< @brief Designated AT Command, without its Carriage Return and New Line characters, with which the HM-10 Clone BLE Device is requested to scan for BLE Devices in Central mode. @note Some firmwares of the HM-10 Clone BLE Devices use "AT+DISC?" instead. */
+#endif
+
+#ifndef HM10_CLONE_SCAN_RESULT_PREFIX
+#define HM10_CLONE_SCAN_RESULT_PREFIX       "+INQ:"                                                     /**< @brief Designated prefix of the Response lines with which the HM-10 Clone BLE Device gives each BLE Device that it discovers while scanning, which must then contain its address as 12 hexadecimal digits (e.g., "+INQ:1 0x001583005A1B"). @note Some firmwares of the HM-10 Clone BLE Devices use "OK+DIS" instead. */
+#endif
+
+#ifndef HM10_CLONE_SCAN_END_PREFIX
+#define HM10_CLONE_SCAN_END_PREFIX          "+INQE"                                                     /**< @brief Designated prefix of the Response line with which the HM-10 Clone BLE Device indicates that it has finished scanning. @note Some firmwares of the HM-10 Clone BLE Devices use "OK+DISCE" instead. */
+#endif
+
+#ifndef HM10_CLONE_CONNECT_CMD
+#define HM10_CLONE_CONNECT_CMD              "AT+CONA"                                                   /**< @brief Designated AT Command, without the address of the BLE Device nor its Carriage Return and New Line characters, with which the HM-10 Clone BLE Device is requested to connect to a BLE Device in Central mode (see @ref connect_hm10clone_device ). */
+#endif
+
+#ifndef HM10_CLONE_CONNECT_ADDRESS_PREFIX
+#define HM10_CLONE_CONNECT_ADDRESS_PREFIX   "0x"                                                        /**< @brief Designated text that is given in the @ref HM10_CLONE_CONNECT_CMD AT Command right before the 12 hexadecimal digits of the address of the BLE Device, which can be "" if not required by the firmware of the HM-10 Clone BLE Device. */
+#endif
+
+#ifndef HM10_CLONE_AUTO_RECONNECT_ON_CMD
+#define HM10_CLONE_AUTO_RECONNECT_ON_CMD    "AT+IMME0"                                                  /**< @brief Designated AT Command, without its Carriage Return and New Line characters, with which the HM-10 Clone BLE Device is requested to automatically reconnect to its last peer (see @ref set_hm10clone_auto_reconnect ). */
+#endif
+
+#ifndef HM10_CLONE_AUTO_RECONNECT_OFF_CMD
+#define HM10_CLONE_AUTO_RECONNECT_OFF_CMD   "AT+IMME1"                                                  /**< @brief Designated AT Command, without its Carriage Return and New Line characters, with which the HM-10 Clone BLE Device is requested to stop reconnecting automatically to its last peer, so that it only connects whenever requested (see @ref set_hm10clone_auto_reconnect ). */
+#endif
+
+#ifndef HM10_CLONE_AUTO_RECONNECT_RESP_PREFIX
+#define HM10_CLONE_AUTO_RECONNECT_RESP_PREFIX   "OK"                                                    /**< @brief Designated prefix of the Response line with which the HM-10 Clone BLE Device accepts the @ref HM10_CLONE_AUTO_RECONNECT_ON_CMD and @ref HM10_CLONE_AUTO_RECONNECT_OFF_CMD AT Commands. */
+#endif
+
+#ifndef HM10_CLONE_SCAN_CACHE_SIZE
+#define HM10_CLONE_SCAN_CACHE_SIZE          (8U)                                                        /**< @brief Number of recently discovered BLE Devices that are kept in the scan cache of the @ref hm10_ble_clone (see @ref get_hm10clone_scan_cache ), where the least recently seen one is replaced whenever it is full. */
+#endif
+
+#ifndef HM10_CLONE_MAX_LINE_SIZE
+#define HM10_CLONE_MAX_LINE_SIZE            (32U)                                                       /**< @brief Length in bytes of the longest Response line, without its Carriage Return and New Line characters, that the incremental parser of the @ref hm10_ble_clone can hold, where the longer ones are discarded. */
+#endif
+
+#ifndef HM10_CLONE_ZERO_COPY_RX
+#define HM10_CLONE_ZERO_COPY_RX             (0U)                                                        /**< @brief Flag used to enable, with a \c 1 , the zero-copy reception of the Over the Air (OTA) data of the @ref hm10_ble_clone (see @ref peek_hm10clone_rx_data ), with which that data is received via DMA into an internal ring buffer that is parsed in place. Otherwise, a \c 0 for not compiling that code at all. @note The DMA channel of the RX of the UART must be configured in Circular mode. */
+#endif
+
+#ifndef HM10_CLONE_RX_RING_SIZE
+#define HM10_CLONE_RX_RING_SIZE             (256U)                                                      /**< @brief Length in bytes of the ring buffer into which the OTA data is received whenever @ref HM10_CLONE_ZERO_COPY_RX is enabled, which must be a power of two of up to 32768 bytes. @note This ring buffer must be committed faster than the HM-10 Clone BLE Device fills it, since the DMA will otherwise overwrite the bytes that have not been committed yet, which @ref peek_hm10clone_rx_data then reports as an overrun. */
+#endif
+
+#ifndef HM10_CLONE_TX_COALESCING
+#define HM10_CLONE_TX_COALESCING            (0U)                                                        /**< @brief Flag used to enable, with a \c 1 , the coalescing of the small writes of @ref send_hm10clone_ota_data into whole packets of 18 bytes (see @ref flush_hm10clone_ota_data ). Otherwise, a \c 0 for sending each write to the UART as soon as it is made. */
+#endif
+
+#ifndef HM10_CLONE_TX_COALESCING_DELAY_MS
+#define HM10_CLONE_TX_COALESCING_DELAY_MS   (10U)                                                       /**< @brief Time in milliseconds that the coalesced bytes of a packet that is not full yet may wait before they are sent by @ref poll_hm10clone_ota_tx or by the next @ref send_hm10clone_ota_data . */
+#endif
+
+#ifndef HM10_CLONE_RPC
+#define HM10_CLONE_RPC                      (0U)                                                        /**< @brief Flag used to enable, with a \c 1 , the request/response RPC layer of the @ref hm10_ble_clone (see @ref AT_09_rpc ). Otherwise, a \c 0 for not compiling it at all. */
+#endif
+
+#ifndef HM10_CLONE_RPC_MAX_PENDING
+#define HM10_CLONE_RPC_MAX_PENDING          (4U)                                                        /**< @brief Maximum number of RPC requests that can be in flight at the same time (see @ref send_hm10clone_rpc_request ). */
+#endif
+
+#ifndef HM10_CLONE_RPC_MAX_PAYLOAD
+#define HM10_CLONE_RPC_MAX_PAYLOAD          (64U)                                                       /**< @brief Length in bytes of the largest payload of an RPC request or response, which must be of up to 255 bytes. */
+#endif
+
+#ifndef HM10_CLONE_PING
+#define HM10_CLONE_PING                     (0U)                                                        /**< @brief Flag used to enable, with a \c 1 , the round-trip latency probe of the @ref hm10_ble_clone (see @ref AT_09_ping ), with which timestamped probe frames are echoed back by the other side of the BLE Connection. Otherwise, a \c 0 for not compiling it at all. @note This layer frames the whole OTA data stream, so it cannot be used at the same time as the @ref AT_09_rpc or the @ref AT_09_mux . */
+#endif
+
+#ifndef HM10_CLONE_PING_MAX_PAYLOAD
+#define HM10_CLONE_PING_MAX_PAYLOAD         (64U)                                                       /**< @brief Length in bytes of the largest padding payload of a probe frame, which must be of up to 255 bytes. */
+#endif
+
+#ifndef HM10_CLONE_PING_HISTOGRAM_BUCKETS
+#define HM10_CLONE_PING_HISTOGRAM_BUCKETS   (24U)                                                       /**< @brief Number of buckets of the round-trip time histogram of the probe frames, where the bucket \c i counts the round-trip times within \f$[2^i, 2^{i+1})\f$ microseconds (the first bucket also counts the ones below 1 microsecond and the last one counts all the ones above its lower limit). @note The default value of 24 covers round-trip times of up to about 16 seconds. */
+#endif
+
+#ifndef HM10_CLONE_PING_CLOCK
+#define HM10_CLONE_PING_CLOCK()             (DWT->CYCCNT)                                               /**< @brief Free-running 32-bit clock with which the probe frames are timestamped, which is the DWT Cycle Counter of the Cortex-M core by default (enabled by @ref init_hm10clone_ping ). @note A host HAL without that counter (e.g., the one at the "tools/posix_hal" folder) defines its own clock, together with @ref HM10_CLONE_PING_CLOCK_HZ . */
+#endif
+
+#ifndef HM10_CLONE_PING_CLOCK_HZ
+#define HM10_CLONE_PING_CLOCK_HZ            (SystemCoreClock)                                           /**< @brief Frequency in Hertz of @ref HM10_CLONE_PING_CLOCK , which must be of at least 1 MHz. */
+#endif
+
+#ifndef HM10_CLONE_MUX
+#define HM10_CLONE_MUX                      (0U)                                                        /**< @brief Flag used to enable, with a \c 1 , the multiplexing of logical channels over the OTA data of the @ref hm10_ble_clone (see @ref AT_09_mux ). Otherwise, a \c 0 for not compiling it at all. @note This layer and the @ref AT_09_rpc cannot be used at the same time, since both of them frame the whole OTA data stream. */
+#endif
+
+#ifndef HM10_CLONE_MUX_CHANNELS
+#define HM10_CLONE_MUX_CHANNELS             (4U)                                                        /**< @brief Number of logical channels that are multiplexed, which must be from 1 up to 255. */
+#endif
+
+#ifndef HM10_CLONE_MUX_TX_QUEUE_SIZE
+#define HM10_CLONE_MUX_TX_QUEUE_SIZE        (128U)                                                      /**< @brief Length in bytes of the TX queue of each logical channel. */
+#endif
+
+#ifndef HM10_CLONE_MUX_RX_BUFFER_SIZE
+#define HM10_CLONE_MUX_RX_BUFFER_SIZE       (64U)                                                       /**< @brief Length in bytes of the RX buffer of each logical channel. @note The received bytes that do not fit in it are dropped (see @ref get_hm10clone_mux_rx_dropped ). */
+#endif
+
+#ifndef HM10_CLONE_OTA_BENCHMARK
+#define HM10_CLONE_OTA_BENCHMARK            (0U)                                                        /**< @brief Flag used to enable, with a \c 1 , the always-on measurement of the Over the Air (OTA) data path of the @ref hm10_ble_clone (i.e., goodput, protocol overhead, CPU cycles per delivered byte and a latency histogram for tail latencies of @ref send_hm10clone_ota_data and @ref get_hm10clone_ota_data ). Otherwise, a \c 0 for not compiling that measurement code at all. @note The CPU cycles are read from @ref HM10_CLONE_OTA_BENCHMARK_CLOCK , which is the DWT Cycle Counter of the Cortex-M core by default and which will then be enabled by @ref init_hm10_clone_module whenever this flag is set to \c 1 . */
+#endif
+
+#ifndef HM10_CLONE_OTA_BENCHMARK_CLOCK
+#define HM10_CLONE_OTA_BENCHMARK_CLOCK()    (DWT->CYCCNT)                                               /**< @brief Free-running 32-bit clock with which the calls of the OTA data functions are timed whenever @ref HM10_CLONE_OTA_BENCHMARK is enabled, which is the DWT Cycle Counter of the Cortex-M core by default. @note A host HAL without that counter (e.g., the one at the "tools/posix_hal" folder) defines its own clock, together with @ref HM10_CLONE_OTA_BENCHMARK_CLOCK_HZ . */
+#endif
+
+#ifndef HM10_CLONE_OTA_BENCHMARK_CLOCK_HZ
+#define HM10_CLONE_OTA_BENCHMARK_CLOCK_HZ   (SystemCoreClock)                                           /**< @brief Frequency in Hertz of @ref HM10_CLONE_OTA_BENCHMARK_CLOCK , which must be of at least 1 MHz. */
+#endif
+
+#ifndef HM10_CLONE_OTA_BENCHMARK_HISTOGRAM_BUCKETS
+#define HM10_CLONE_OTA_BENCHMARK_HISTOGRAM_BUCKETS  (20U)                                               /**< @brief Number of buckets of the OTA latency histogram, where the bucket \c i counts the calls whose latency was within \f$[2^i, 2^{i+1})\f$ microseconds (the first bucket also counts latencies below 1 microsecond and the last one counts all the latencies above its lower limit). @note The default value of 20 covers latencies of up to about 1 second with a granularity of a power of two. */
+#endif
+
+#ifndef HM10_CLONE_TIMER
+#define HM10_CLONE_TIMER                    (0U)                                                        /**< @brief Flag used to enable, with a \c 1 , the timer wheel of the @ref hm10_ble_clone , which is driven by the update interrupt of a hardware timer (see @ref set_hm10clone_timer_source ) and which manages the deadlines of the non-blocking AT Command transactions, and any other deadline of the application (see @ref start_hm10clone_timer ), with a resolution of @ref HM10_CLONE_TIMER_TICK_US microseconds instead of by polling the HAL Tick. Otherwise, a \c 0 for not compiling it at all. */
+#endif
+
+#ifndef HM10_CLONE_TIMER_TICK_US
+#define HM10_CLONE_TIMER_TICK_US            (50U)                                                       /**< @brief Resolution in microseconds of the timer wheel, which must be the period of the update event of its hardware timer (e.g., a 1 MHz counter that reloads every 50 counts). @note The default of 50 microseconds is under the time of a single character of the UART at 115200 baud (i.e., about 87 microseconds). */
+#endif
+
+#ifndef HM10_CLONE_TIMER_WHEEL_SLOTS
+#define HM10_CLONE_TIMER_WHEEL_SLOTS        (64U)                                                       /**< @brief Number of slots of the timer wheel, which must be a power of two of up to 32768. @note Each tick of the timer wheel only visits the timers of a single slot, so more slots mean less work per tick whenever many timers are running, at the cost of one pointer of RAM per slot. */
+#endif
+
+#ifndef HM10_CLONE_TIMER_FLUSH_IDLE_US
+#define HM10_CLONE_TIMER_FLUSH_IDLE_US      (HM10_CLONE_CUSTOM_HAL_TIMEOUT * 1000U)                     /**< @brief Time in microseconds during which no byte must be received for the RX of the UART to be considered flushed by the non-blocking AT Command transactions whenever their deadlines are managed by the timer wheel (see @ref HM10_CLONE_TIMER ). @note It can be lowered down to a few characters of the UART (e.g., 300 microseconds at 115200 baud) to skip most of the idle wait before each AT Command. */
+#endif
+
+#ifndef HM10_CLONE_CAPTURE
+#define HM10_CLONE_CAPTURE                  (0U)                                                        /**< @brief Flag used to enable, with a \c 1 , the capture of every transmission and reception of the UART of the @ref hm10_ble_clone , together with the beginning and the end of each AT Command call, as compact binary records with timestamps (see @ref HM10_Clone_Capture_Record ) that can be replayed against the @ref hm10_ble_clone on a host computer with the "tools/AT-09_capture_replayer.c" program. Otherwise, a \c 0 for not compiling that capture code at all. @note Only the transfers made in the Polling mode of the UART (or through the @ref HM10_CLONE_RTOS integration) are captured, and not those of the non-blocking transactions nor those of @ref HM10_CLONE_ZERO_COPY_RX . */
+#endif
+
+#ifndef HM10_CLONE_CAPTURE_BUFFER_SIZE
+#define HM10_CLONE_CAPTURE_BUFFER_SIZE      (1024U)                                                     /**< @brief Length in bytes of the RAM ring buffer into which the capture records are stored whenever no capture sink has been set (see @ref set_hm10clone_capture_sink ), which must be a power of two of up to 32768 bytes. @note The oldest records are discarded whenever a new one does not fit, and a record that is longer than this whole buffer is not stored at all. */
+#endif
+
 /** @} */ // AT_09_config
 
 /** @} */ // main_AT_09_config
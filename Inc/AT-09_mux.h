@@ -0,0 +1,144 @@
+/** @addtogroup hm10_ble_clone
+ * @{
+ */
+
+/**@file
+ * @brief	AT-09 zs040 BLE Driver channel multiplexing layer file.
+ *
+ * @defgroup AT_09_mux AT-09 zs040 BLE Driver Channel Multiplexing Layer
+ * @{
+ *
+ * @brief   This file contains the layer that multiplexes several logical channels over the Over the Air (OTA) data of
+ *          the @ref hm10_ble_clone .
+ *
+ * @details Each logical channel has its own TX queue, RX buffer and priority. The data that is written into a channel
+ *          is queued and then sent by @ref poll_hm10clone_mux in fragments of up to
+ *          @ref HM10_CLONE_MUX_FRAGMENT_PAYLOAD bytes, where the next fragment is always taken from the non-empty
+ *          channel with the highest priority (in round-robin among the channels of the same priority). This way, a
+ *          short control message never has to wait behind a bulk transfer for longer than a single fragment. On the
+ *          other side, each received fragment is demultiplexed into the RX buffer of its channel.
+ *
+ *          Each fragment is sent as a frame with the following layout, which fits in a single BLE packet:
+ *          <table>
+ *          <tr><th>Field</th><th>Size</th><th>Description</th></tr>
+ *          <tr><td>Sync</td><td>1</td><td>@ref HM10_CLONE_MUX_SYNC .</td></tr>
+ *          <tr><td>Channel</td><td>1</td><td>Logical channel of the fragment.</td></tr>
+ *          <tr><td>Length</td><td>1</td><td>Length in bytes of the payload.</td></tr>
+ *          <tr><td>Payload</td><td>Length</td><td>Data of the logical channel.</td></tr>
+ *          <tr><td>CRC</td><td>1</td><td>CRC-8 (polynomial 0x07) of the Channel, Length and Payload fields.</td></tr>
+ *          </table>
+ *
+ * @note    Each logical channel is a byte stream, so the boundaries of the writes are not preserved.
+ * @note    Whenever @ref HM10_CLONE_ZERO_COPY_RX is enabled, the frames are parsed in place from the RX ring buffer,
+ *          which must have been started with @ref start_hm10clone_rx_stream . Otherwise, they are received one byte at
+ *          a time by @ref drain_hm10clone_ota_data , so @ref poll_hm10clone_mux must then be called often enough to not
+ *          miss any received byte.
+ * @note    The functions of this layer must all be called from the same task.
+ *
+ * @date	October 18, 2026.
+ */
+
+#ifndef AT_09_MUX_H_
+#define AT_09_MUX_H_
+
+#include "AT-09_zs040_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from a AT-09 zs040 BLE Device.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if HM10_CLONE_MUX
+#define HM10_CLONE_MUX_SYNC										(0xA5)		/**< @brief Byte with which each multiplexed frame starts. */
+#define HM10_CLONE_MUX_HEADER_SIZE								(3)			/**< @brief Length in bytes of the Sync, Channel and Length fields of a multiplexed frame. */
+#define HM10_CLONE_MUX_FRAGMENT_PAYLOAD							(14)		/**< @brief Length in bytes of the largest payload of a multiplexed frame, so that the whole frame fits in a single BLE packet of 18 bytes. */
+#define HM10_CLONE_MUX_LOWEST_PRIORITY							(255)		/**< @brief Lowest priority that a logical channel can have. */
+
+/**@brief	Initializes the channel multiplexing layer, which empties all the TX queues and RX buffers and gives the
+ *          highest priority (i.e., \c 0 ) to all the logical channels.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status init_hm10clone_mux();
+
+/**@brief	Sets the priority of a logical channel.
+ *
+ * @param channel	Logical channel, which must be lower than @ref HM10_CLONE_MUX_CHANNELS .
+ * @param priority	Priority of the logical channel, where \c 0 is the highest and
+ *                  @ref HM10_CLONE_MUX_LOWEST_PRIORITY is the lowest.
+ *
+ * @retval	HM10_Clone_EC_OK	if the priority was set.
+ * @retval  HM10_Clone_EC_ERR   if the \p channel param is invalid.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status set_hm10clone_mux_priority(uint8_t channel, uint8_t priority);
+
+/**@brief	Queues data into the TX queue of a logical channel, which will be sent by @ref poll_hm10clone_mux .
+ *
+ * @note    Either the whole data is queued or none of it is.
+ *
+ * @param channel		Logical channel, which must be lower than @ref HM10_CLONE_MUX_CHANNELS .
+ * @param[in] data		Pointer to the data that is to be queued.
+ * @param size			Length in bytes of the data that is to be queued.
+ *
+ * @retval	HM10_Clone_EC_OK	if the data was queued.
+ * @retval  HM10_Clone_EC_BUSY  if there is not enough free space in the TX queue of the logical channel.
+ * @retval  HM10_Clone_EC_ERR   if the \p channel param is invalid.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status write_hm10clone_mux_channel(uint8_t channel, const uint8_t *data, uint16_t size);
+
+/**@brief	Reads the data that has been received in a logical channel.
+ *
+ * @param channel		Logical channel, which must be lower than @ref HM10_CLONE_MUX_CHANNELS .
+ * @param[out] data		Pointer to the Memory Address into which the received data will be stored.
+ * @param max_size		Maximum number of bytes that will be read.
+ * @param[out] size		Pointer to the Memory Address into which the number of bytes that were read will be stored.
+ *
+ * @retval	HM10_Clone_EC_OK	if at least one byte was read.
+ * @retval  HM10_Clone_EC_NR    if no data has been received in the logical channel.
+ * @retval  HM10_Clone_EC_ERR   if the \p channel param is invalid.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status read_hm10clone_mux_channel(uint8_t channel, uint8_t *data, uint16_t max_size, uint16_t *size);
+
+/**@brief	Gets the number of received bytes of a logical channel that were dropped because its RX buffer was full.
+ *
+ * @param channel	Logical channel, which must be lower than @ref HM10_CLONE_MUX_CHANNELS .
+ *
+ * @return	The number of dropped bytes, or \c 0 if the \p channel param is invalid.
+ *
+ * @date	October 18, 2026.
+ */
+uint32_t get_hm10clone_mux_rx_dropped(uint8_t channel);
+
+/**@brief	Demultiplexes the received frames into the RX buffers of their logical channels and then sends a single
+ *          fragment from the non-empty TX queue with the highest priority.
+ *
+ * @note    This function only blocks for as long as it takes to send a single fragment and must be called
+ *          periodically. Sending a single fragment per call is what lets a higher priority channel take over the
+ *          link at each fragment boundary.
+ *
+ * @retval	HM10_Clone_EC_OK	if the received data was processed and either a fragment was sent or there was nothing
+ *                              to send.
+ * @retval  HM10_Clone_EC_NR    if the fragment could not be sent in time, in which case it stays queued.
+ * @retval  HM10_Clone_EC_ERR   if anything else went wrong.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status poll_hm10clone_mux();
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT_09_MUX_H_ */
+
+/** @} */ // AT_09_mux
+
+/** @} */ // hm10_ble_clone
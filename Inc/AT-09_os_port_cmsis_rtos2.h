@@ -0,0 +1,48 @@
+/** @addtogroup hm10_ble_clone
+ * @{
+ */
+
+/**@file
+ * @brief	AT-09 zs040 BLE Driver CMSIS-RTOS2 porting file.
+ *
+ * @defgroup AT_09_os_port_cmsis_rtos2 AT-09 zs040 BLE Driver CMSIS-RTOS2 Port
+ * @{
+ *
+ * @brief   This file provides the @ref HM10_Clone_OS_Port of the CMSIS-RTOS2 API (e.g., FreeRTOS or Keil RTX5 through
+ *          the CMSIS-RTOS2 wrapper that is generated by STM32CubeMX).
+ *
+ * @details To integrate the @ref hm10_ble_clone with CMSIS-RTOS2, @ref HM10_CLONE_RTOS has to be enabled and the
+ *          following has to be done after the kernel was initialized:
+ *          @code
+ *          set_hm10clone_os_port(&hm10clone_cmsis_rtos2_os_port);
+ *          init_hm10_clone_module(&huart1);
+ *          @endcode
+ *          In addition, @ref hm10clone_uart_tx_cplt_isr , @ref hm10clone_uart_rx_cplt_isr and
+ *          @ref hm10clone_uart_error_isr have to be called from the @ref HAL_UART_TxCpltCallback ,
+ *          @ref HAL_UART_RxCpltCallback and @ref HAL_UART_ErrorCallback functions of the application.
+ *
+ * @date	October 18, 2026.
+ */
+
+#ifndef AT_09_OS_PORT_CMSIS_RTOS2_H_
+#define AT_09_OS_PORT_CMSIS_RTOS2_H_
+
+#include "AT-09_zs040_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from a AT-09 zs040 BLE Device.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if HM10_CLONE_RTOS
+extern const HM10_Clone_OS_Port hm10clone_cmsis_rtos2_os_port; /**< @brief Porting interface of the CMSIS-RTOS2 API for the @ref hm10_ble_clone . */
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT_09_OS_PORT_CMSIS_RTOS2_H_ */
+
+/** @} */ // AT_09_os_port_cmsis_rtos2
+
+/** @} */ // hm10_ble_clone
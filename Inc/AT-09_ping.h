@@ -0,0 +1,163 @@
+/** @addtogroup hm10_ble_clone
+ * @{
+ */
+
+/**@file
+ * @brief	AT-09 zs040 BLE Driver round-trip latency probe file.
+ *
+ * @defgroup AT_09_ping AT-09 zs040 BLE Driver Round-Trip Latency Probe
+ * @{
+ *
+ * @brief   This file contains the ping layer that measures the end-to-end round-trip latency of the Over the Air (OTA)
+ *          data of the @ref hm10_ble_clone (i.e., from our MCU/MPU through the UART and the BLE Connection up to the
+ *          other side, and back).
+ *
+ * @details Each probe frame carries a timestamp of @ref HM10_CLONE_PING_CLOCK , which the other side echoes back
+ *          untouched from its own @ref poll_hm10clone_ping . Therefore, the round-trip time is measured with the clock
+ *          of the side that sent the probe only, so both sides do not need to have their clocks synchronised. The
+ *          round-trip times are accumulated into a histogram from which their percentiles can be obtained (see
+ *          @ref get_hm10clone_ping_percentile ), which is meant to compare, with real numbers, the effect of changing
+ *          the connection parameters or the baud rate.
+ *
+ *          Each probe or echo is sent as a frame with the following layout, where the multi-byte fields are
+ *          little-endian:
+ *          <table>
+ *          <tr><th>Field</th><th>Size</th><th>Description</th></tr>
+ *          <tr><td>Sync</td><td>1</td><td>@ref HM10_CLONE_PING_SYNC .</td></tr>
+ *          <tr><td>Type</td><td>1</td><td>@ref HM10_CLONE_PING_TYPE_PROBE or @ref HM10_CLONE_PING_TYPE_ECHO .</td></tr>
+ *          <tr><td>Sequence</td><td>2</td><td>Sequence number of the probe.</td></tr>
+ *          <tr><td>Timestamp</td><td>4</td><td>Value of @ref HM10_CLONE_PING_CLOCK at which the probe was sent.</td></tr>
+ *          <tr><td>Length</td><td>1</td><td>Length in bytes of the payload.</td></tr>
+ *          <tr><td>Payload</td><td>Length</td><td>Padding, so that the latency of larger frames can be measured too.</td></tr>
+ *          <tr><td>CRC</td><td>1</td><td>CRC-8 (polynomial 0x07) of all the fields but the Sync and CRC ones.</td></tr>
+ *          </table>
+ *
+ * @note    Whenever @ref HM10_CLONE_ZERO_COPY_RX is enabled, the frames are parsed in place from the RX ring buffer,
+ *          which must have been started with @ref start_hm10clone_rx_stream . Otherwise, they are received one byte at
+ *          a time by @ref drain_hm10clone_ota_data , so @ref poll_hm10clone_ping must then be called often enough to
+ *          not miss any received byte.
+ * @note    The functions of this ping layer must all be called from the same task.
+ *
+ * @date	October 18, 2026.
+ */
+
+#ifndef AT_09_PING_H_
+#define AT_09_PING_H_
+
+#include "AT-09_zs040_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from a AT-09 zs040 BLE Device.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if HM10_CLONE_PING
+#define HM10_CLONE_PING_SYNC									(0xA5)		/**< @brief Byte with which each ping frame starts. */
+#define HM10_CLONE_PING_TYPE_PROBE								(0x01)		/**< @brief Type of the ping frames that are probes. */
+#define HM10_CLONE_PING_TYPE_ECHO								(0x02)		/**< @brief Type of the ping frames that are echoes of a probe. */
+#define HM10_CLONE_PING_HEADER_SIZE								(9)			/**< @brief Length in bytes of the Sync, Type, Sequence, Timestamp and Length fields of a ping frame. */
+
+/**@brief	Round-trip latency measurements of the probe frames.
+ */
+typedef struct
+{
+	uint32_t probes_sent;										//!< Number of probes that were sent with @ref send_hm10clone_ping .
+	uint32_t echoes_received;									//!< Number of probes whose echo was received in time, each of which was accounted into the round-trip time fields.
+	uint32_t timeouts;											//!< Number of probes whose echo was not received in time.
+	uint32_t late_echoes;										//!< Number of echoes that were received after their probe had timed out, which are not accounted into the round-trip time fields.
+	uint32_t probes_echoed;										//!< Number of probes of the other side that were echoed back by @ref poll_hm10clone_ping .
+	uint32_t rtt_min_us;										//!< Shortest round-trip time in microseconds, or \c UINT32_MAX if no echo was received.
+	uint32_t rtt_max_us;										//!< Longest round-trip time in microseconds.
+	uint64_t rtt_sum_us;										//!< Sum of all the round-trip times in microseconds, from which their mean can be obtained.
+	uint32_t rtt_histogram[HM10_CLONE_PING_HISTOGRAM_BUCKETS];	//!< Round-trip time histogram (see @ref HM10_CLONE_PING_HISTOGRAM_BUCKETS ).
+} HM10_Clone_Ping_Stats;
+
+/**@brief	Initializes the ping layer, which clears its measurements and discards any probe that was in flight.
+ *
+ * @note    Whenever the default @ref HM10_CLONE_PING_CLOCK is used, this function also enables the DWT Cycle Counter.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status init_hm10clone_ping();
+
+/**@brief	Sends a probe frame and waits for its echo, which is accounted into the @ref HM10_Clone_Ping_Stats .
+ *
+ * @details The probes of the other side that are received while waiting are echoed back too, so that both sides can
+ *          measure the round-trip latency at the same time.
+ *
+ * @note    This function polls the received data without any delay in between, so that the measured round-trip time
+ *          is not rounded up to the HAL Tick.
+ *
+ * @param payload_size	Length in bytes of the padding payload of the probe, which must be of up to
+ *                      @ref HM10_CLONE_PING_MAX_PAYLOAD .
+ * @param timeout		Time in milliseconds to wait for the echo.
+ * @param[out] rtt_us	Pointer to the Memory Address into which the round-trip time in microseconds will be stored, or
+ *                      \c NULL if not required.
+ *
+ * @retval	HM10_Clone_EC_OK	if the echo of the probe was received in time.
+ * @retval  HM10_Clone_EC_NR    if the echo was not received in time, or if the probe could not be sent in time.
+ * @retval  HM10_Clone_EC_ERR   if the \p payload_size param is too large or if anything else went wrong.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status send_hm10clone_ping(uint8_t payload_size, uint32_t timeout, uint32_t *rtt_us);
+
+/**@brief	Processes the received ping frames, which echoes back the probes of the other side and concludes the probe
+ *          of this side whenever its echo arrives.
+ *
+ * @details This is the echo responder of the ping layer, so it must be called periodically by the side that answers
+ *          the probes.
+ *
+ * @note    This function does not block.
+ *
+ * @retval	HM10_Clone_EC_OK	if the received data was processed.
+ * @retval  HM10_Clone_EC_ERR   if the data could not be received.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status poll_hm10clone_ping();
+
+/**@brief	Gets a snapshot of the round-trip latency measurements of the ping layer.
+ *
+ * @param[out] snapshot	Pointer to the structure into which the current measurements will be copied.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status get_hm10clone_ping_stats(HM10_Clone_Ping_Stats *snapshot);
+
+/**@brief	Clears all the round-trip latency measurements of the ping layer.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status reset_hm10clone_ping_stats();
+
+/**@brief	Gets an upper bound of the round-trip time, in microseconds, below which a desired percentage of the echoes
+ *          were received.
+ *
+ * @param[in] snapshot	Pointer to the measurements of interest (see @ref get_hm10clone_ping_stats ).
+ * @param percentile	Desired percentile, which must be within 1 and 100 (e.g., 99 for the tail latency).
+ *
+ * @return	The upper limit, in microseconds, of the histogram bucket that contains the requested percentile, which is
+ *          capped at the longest round-trip time measured (and which is that longest round-trip time whenever the
+ *          percentile falls into the last bucket, since that one has no upper limit), or \c 0 if there are no echoes
+ *          measured or if the \p percentile param has an invalid value.
+ *
+ * @date	October 18, 2026.
+ */
+uint32_t get_hm10clone_ping_percentile(const HM10_Clone_Ping_Stats *snapshot, uint8_t percentile);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT_09_PING_H_ */
+
+/** @} */ // AT_09_ping
+
+/** @} */ // hm10_ble_clone
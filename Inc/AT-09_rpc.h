@@ -0,0 +1,148 @@
+/** @addtogroup hm10_ble_clone
+ * @{
+ */
+
+/**@file
+ * @brief	AT-09 zs040 BLE Driver RPC layer file.
+ *
+ * @defgroup AT_09_rpc AT-09 zs040 BLE Driver RPC Layer
+ * @{
+ *
+ * @brief   This file contains the request/response RPC layer that runs on top of the Over the Air (OTA) data of the
+ *          @ref hm10_ble_clone .
+ *
+ * @details Each request is given a request ID that the other side echoes back in its response, so that the responses
+ *          can be matched to their requests. This way, several requests can be in flight at the same time and their
+ *          round-trip latencies overlap instead of adding up. Each request has its own timeout and its own completion
+ *          callback, which is called from @ref poll_hm10clone_rpc either with the response or with the timeout.
+ *
+ *          Each request or response is sent as a frame with the following layout:
+ *          <table>
+ *          <tr><th>Field</th><th>Size</th><th>Description</th></tr>
+ *          <tr><td>Sync</td><td>1</td><td>@ref HM10_CLONE_RPC_SYNC .</td></tr>
+ *          <tr><td>ID</td><td>1</td><td>Request ID.</td></tr>
+ *          <tr><td>Flags</td><td>1</td><td>@ref HM10_CLONE_RPC_FLAG_RESPONSE for a response, or zero for a request.</td></tr>
+ *          <tr><td>Length</td><td>1</td><td>Length in bytes of the payload.</td></tr>
+ *          <tr><td>Payload</td><td>Length</td><td>Payload of the request or response.</td></tr>
+ *          <tr><td>CRC</td><td>1</td><td>CRC-8 (polynomial 0x07) of the ID, Flags, Length and Payload fields.</td></tr>
+ *          </table>
+ *
+ * @note    Whenever @ref HM10_CLONE_ZERO_COPY_RX is enabled, the frames are parsed in place from the RX ring buffer,
+ *          which must have been started with @ref start_hm10clone_rx_stream . Otherwise, they are received one byte at
+ *          a time by @ref drain_hm10clone_ota_data , so @ref poll_hm10clone_rpc must then be called often enough to not
+ *          miss any received byte.
+ * @note    The functions of this RPC layer must all be called from the same task.
+ *
+ * @date	October 18, 2026.
+ */
+
+#ifndef AT_09_RPC_H_
+#define AT_09_RPC_H_
+
+#include "AT-09_zs040_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from a AT-09 zs040 BLE Device.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if HM10_CLONE_RPC
+#define HM10_CLONE_RPC_SYNC										(0x7E)		/**< @brief Byte with which each RPC frame starts. */
+#define HM10_CLONE_RPC_FLAG_RESPONSE							(0x01)		/**< @brief Flag of the RPC frames that are responses. */
+#define HM10_CLONE_RPC_HEADER_SIZE								(4)			/**< @brief Length in bytes of the Sync, ID, Flags and Length fields of an RPC frame. */
+
+/**@brief	Function that is called whenever an RPC request concludes.
+ *
+ * @param request_id	Request ID of the concluded request.
+ * @param status		@ref HM10_Clone_EC_OK if its response was received, or @ref HM10_Clone_EC_NR if it timed out.
+ * @param[in] payload	Pointer to the payload of the response, which is only valid during this call (or \c NULL if it
+ *                      timed out).
+ * @param size			Length in bytes of the payload of the response.
+ * @param latency		Time in milliseconds from sending the request until it concluded.
+ * @param context		Pointer that was given together with the request.
+ */
+typedef void (*HM10_Clone_Rpc_Callback)(uint8_t request_id, HM10_Clone_Status status, const uint8_t *payload, uint8_t size, uint32_t latency, void *context);
+
+/**@brief	Function that is called whenever an RPC request is received from the other side, which should answer it
+ *          with @ref send_hm10clone_rpc_response .
+ *
+ * @param request_id	Request ID of the received request.
+ * @param[in] payload	Pointer to the payload of the request, which is only valid during this call.
+ * @param size			Length in bytes of the payload of the request.
+ */
+typedef void (*HM10_Clone_Rpc_Handler)(uint8_t request_id, const uint8_t *payload, uint8_t size);
+
+/**@brief	Initializes the RPC layer, which discards any request that was in flight.
+ *
+ * @param handler	Function that will be called for each received request, or \c NULL if this side only sends
+ *                  requests.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status init_hm10clone_rpc(HM10_Clone_Rpc_Handler handler);
+
+/**@brief	Sends an RPC request without waiting for its response.
+ *
+ * @param[in] payload		Pointer to the payload of the request.
+ * @param size				Length in bytes of the payload, which must be of up to @ref HM10_CLONE_RPC_MAX_PAYLOAD .
+ * @param timeout			Time in milliseconds to wait for the response before concluding the request with
+ *                          @ref HM10_Clone_EC_NR .
+ * @param callback			Function that will be called whenever the request concludes.
+ * @param context			Pointer that will be given to the \p callback param.
+ * @param[out] request_id	Pointer to the Memory Address into which the request ID will be stored, or \c NULL if not
+ *                          required.
+ *
+ * @retval	HM10_Clone_EC_OK	if the request was sent.
+ * @retval  HM10_Clone_EC_BUSY  if @ref HM10_CLONE_RPC_MAX_PENDING requests are already in flight.
+ * @retval  HM10_Clone_EC_NR    if the request could not be sent in time.
+ * @retval  HM10_Clone_EC_ERR   if the \p size param is too large or if anything else went wrong.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status send_hm10clone_rpc_request(const uint8_t *payload, uint8_t size, uint32_t timeout, HM10_Clone_Rpc_Callback callback, void *context, uint8_t *request_id);
+
+/**@brief	Sends the response to an RPC request that was received from the other side.
+ *
+ * @param request_id	Request ID of the request that is being answered.
+ * @param[in] payload	Pointer to the payload of the response.
+ * @param size			Length in bytes of the payload, which must be of up to @ref HM10_CLONE_RPC_MAX_PAYLOAD .
+ *
+ * @retval	HM10_Clone_EC_OK	if the response was sent.
+ * @retval  HM10_Clone_EC_NR    if the response could not be sent in time.
+ * @retval  HM10_Clone_EC_ERR   if the \p size param is too large or if anything else went wrong.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status send_hm10clone_rpc_response(uint8_t request_id, const uint8_t *payload, uint8_t size);
+
+/**@brief	Processes the received RPC frames and the timeouts of the requests that are in flight, which calls their
+ *          callbacks accordingly.
+ *
+ * @note    This function does not block and must be called periodically.
+ *
+ * @retval	HM10_Clone_EC_OK	if the received data was processed.
+ * @retval  HM10_Clone_EC_ERR   if the data could not be received.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status poll_hm10clone_rpc();
+
+/**@brief	Gets the number of RPC requests that are currently in flight.
+ *
+ * @return	The number of requests that have been sent and that have not concluded yet.
+ *
+ * @date	October 18, 2026.
+ */
+uint8_t get_hm10clone_rpc_pending_count();
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT_09_RPC_H_ */
+
+/** @} */ // AT_09_rpc
+
+/** @} */ // hm10_ble_clone
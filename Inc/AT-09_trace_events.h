@@ -0,0 +1,198 @@
+/** @addtogroup hm10_ble_clone
+ * @{
+ */
+
+/**@file
+ * @brief	AT-09 zs040 BLE Driver binary trace events file.
+ *
+ * @defgroup AT_09_trace_events AT-09 zs040 BLE Driver Binary Trace Events
+ * @{
+ *
+ * @brief   This file contains the definitions of the events that the @ref hm10_ble_clone can record into its binary
+ *          trace ring buffer, together with the human-readable message with which each of those events is decoded.
+ *
+ * @details Whenever any of the per-subsystem log levels (e.g., @ref HM10_CLONE_LOG_LEVEL_CMD ) is enabled and
+ *          @ref HM10_CLONE_VERBOSE_BACKEND is set to @ref HM10_CLONE_VERBOSE_BACKEND_TRACE , the @ref hm10_ble_clone
+ *          will not call @ref printf at all. Instead, each message is stored as a fixed-size
+ *          @ref HM10_Clone_Trace_Record into a RAM ring buffer, which takes only a few CPU cycles and, therefore, does
+ *          not distort the timing of the processes that are being traced. The records can then be read with
+ *          @ref read_hm10clone_trace (or dumped from RAM with a debugger) and be turned back into the human-readable
+ *          messages on a host computer with the "tools/AT-09_trace_decoder.c" program.
+ *
+ * @note    This file does not depend on the HAL Driver Library so that it can also be included by the host-side trace
+ *          decoder.
+ *
+ * @date	October 18, 2026.
+ */
+
+#ifndef AT_09_TRACE_EVENTS_H_
+#define AT_09_TRACE_EVENTS_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define HM10_CLONE_TRACE_MAX_ARGS                               (4)         /**< @brief Maximum number of integer arguments that can be stored in a single @ref HM10_Clone_Trace_Record . */
+
+/**@brief	Binary trace record structure.
+ *
+ * @details Each message of the @ref hm10_ble_clone that is traced is stored as one of these 16 bytes records, where the
+ *          \c args field holds the values that would otherwise be given to the @ref printf function together with the
+ *          message of the corresponding event.
+ */
+typedef struct
+{
+	uint32_t timestamp;							//!< Value of the DWT Cycle Counter at the moment that the event was recorded.
+	uint16_t sequence;							//!< Sequence number of the record, which starts at 1 and skips the 0 value whenever it wraps around so that unused records (i.e., whose sequence is 0) can be identified.
+	uint16_t event;								//!< Event that was recorded (see @ref HM10_Clone_Trace_Event ).
+	uint16_t args[HM10_CLONE_TRACE_MAX_ARGS];	//!< Integer arguments of the recorded event, where the unused ones have a value of 0.
+} HM10_Clone_Trace_Record;
+
+/**@brief	X-Macro table with the events of the @ref hm10_ble_clone and their human-readable messages.
+ *
+ * @details Each entry consists of the name of the event, of the subsystem that gives it (i.e., \c CMD , \c DATA ,
+ *          \c CONN or \c FLUSH ), of its log level (i.e., \c ERROR , \c WARN , \c INFO or \c DEBUG ) and of the
+ *          @ref printf format with which that event is displayed, whose arguments are given by the \c args field of its
+ *          @ref HM10_Clone_Trace_Record .
+ *
+ * @note    An event is only compiled into the @ref hm10_ble_clone whenever its log level is enabled by the log level of
+ *          its subsystem (e.g., @ref HM10_CLONE_LOG_LEVEL_CMD ). However, all the events keep their identifier so that
+ *          the host-side trace decoder can decode the records of any build.
+ */
+#define HM10_CLONE_TRACE_EVENTS(X) \
+	X(HM10_CLONE_EV_TEST_CMD_SENDING, CMD, INFO, "Sending Test Command to HM-10 Clone BLE Device...\r\n") \
+	X(HM10_CLONE_EV_TEST_CMD_TX_RETRY, CMD, WARN, "WARNING: Attempt %d to transmit Test Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_TEST_CMD_TX_FAILED, CMD, ERROR, "ERROR: Last attempt for transmitting the Test Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_OK_RESP_RX_RETRY, CMD, WARN, "WARNING: Attempt %d to receive OK Response from HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_OK_RESP_RX_FAILED, CMD, ERROR, "ERROR: An OK Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n") \
+	X(HM10_CLONE_EV_OK_RESP_INVALID, CMD, ERROR, "ERROR: An OK Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n") \
+	X(HM10_CLONE_EV_TEST_CMD_DONE, CMD, INFO, "DONE: A Test Command was successfully sent to the HM-10 Clone BLE Device.\r\n") \
+	X(HM10_CLONE_EV_RESET_CMD_SENDING, CMD, INFO, "Sending Reset Command to HM-10 Clone BLE Device...\r\n") \
+	X(HM10_CLONE_EV_RESET_CMD_TX_RETRY, CMD, WARN, "WARNING: Attempt %d to transmit Reset Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_RESET_CMD_TX_FAILED, CMD, ERROR, "ERROR: Last attempt for transmitting the Reset Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_RESET_CMD_DONE, CMD, INFO, "DONE: A Reset Command was successfully sent to the HM-10 Clone BLE Device.\r\n") \
+	X(HM10_CLONE_EV_INVALID_NAME_SIZE, CMD, ERROR, "ERROR: Requested BLE Name must not exceed a length of %d bytes (i.e., %d ASCII Characters).\r\n") \
+	X(HM10_CLONE_EV_NAME_CMD_SENDING, CMD, INFO, "Sending Name Command to HM-10 Clone BLE Device...\r\n") \
+	X(HM10_CLONE_EV_NAME_CMD_TX_RETRY, CMD, WARN, "WARNING: Attempt %d to transmit Name Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_NAME_CMD_TX_FAILED, CMD, ERROR, "ERROR: Last attempt for transmitting the Name Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_NAME_RESP_RX_RETRY, CMD, WARN, "WARNING: Attempt %d to receive Name Response from HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_NAME_RESP_RX_FAILED, CMD, ERROR, "ERROR: A Name Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n") \
+	X(HM10_CLONE_EV_NAME_RESP_INVALID, CMD, ERROR, "ERROR: A Name Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n") \
+	X(HM10_CLONE_EV_NAME_CMD_DONE, CMD, INFO, "DONE: A Name Command was successfully sent to the HM-10 Clone BLE Device.\r\n") \
+	X(HM10_CLONE_EV_GET_NAME_CMD_SENDING, CMD, INFO, "Sending Get Name Command to HM-10 Clone BLE Device...\r\n") \
+	X(HM10_CLONE_EV_GET_NAME_CMD_TX_RETRY, CMD, WARN, "WARNING: Attempt %d to transmit Get Name Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_GET_NAME_CMD_TX_FAILED, CMD, ERROR, "ERROR: Last attempt for transmitting the Get Name Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_GET_NAME_RESP_RX_RETRY, CMD, WARN, "WARNING: Attempt %d to receive the Get Name Response from HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_GET_NAME_RESP_RX_FAILED, CMD, ERROR, "ERROR: A Get Name Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n") \
+	X(HM10_CLONE_EV_GET_NAME_RESP_INVALID, CMD, ERROR, "ERROR: A Get Name Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n") \
+	X(HM10_CLONE_EV_BLE_NAME_RX_RETRY, CMD, WARN, "WARNING: Attempt %d to receive the BLE Name from HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_BLE_NAME_RX_FAILED, CMD, ERROR, "ERROR: A BLE Name from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n") \
+	X(HM10_CLONE_EV_BLE_NAME_TOO_LONG_RETRY, CMD, WARN, "WARNING: Attempt %d to receive the BLE Name, with a maximum size of %d, from HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_BLE_NAME_TOO_LONG, CMD, ERROR, "ERROR: A BLE Name, with a maximum size of %d, from the HM-10 Clone BLE Device was expected, but a larger name was received instead.\r\n") \
+	X(HM10_CLONE_EV_GET_NAME_DONE, CMD, INFO, "DONE: The BLE Name was successfully received from the HM-10 Clone BLE Device.\r\n") \
+	X(HM10_CLONE_EV_INVALID_ROLE_GIVEN, CMD, ERROR, "ERROR: Requested BLE Role %d is not recognized.\r\n") \
+	X(HM10_CLONE_EV_ROLE_CMD_SENDING, CMD, INFO, "Sending Role Command to HM-10 Clone BLE Device...\r\n") \
+	X(HM10_CLONE_EV_ROLE_CMD_TX_RETRY, CMD, WARN, "WARNING: Attempt %d to transmit Role Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_ROLE_CMD_TX_FAILED, CMD, ERROR, "ERROR: Last attempt for transmitting the Role Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_ROLE_RESP_RX_RETRY, CMD, WARN, "WARNING: Attempt %d to receive Role Response from HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_ROLE_RESP_RX_FAILED, CMD, ERROR, "ERROR: A Role Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n") \
+	X(HM10_CLONE_EV_ROLE_RESP_INVALID, CMD, ERROR, "ERROR: A Role Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n") \
+	X(HM10_CLONE_EV_ROLE_CMD_DONE, CMD, INFO, "DONE: A Role Command was successfully sent to the HM-10 Clone BLE Device.\r\n") \
+	X(HM10_CLONE_EV_GET_ROLE_CMD_SENDING, CMD, INFO, "Sending Get Role Command to HM-10 Clone BLE Device...\r\n") \
+	X(HM10_CLONE_EV_GET_ROLE_CMD_TX_RETRY, CMD, WARN, "WARNING: Attempt %d to transmit Get Role Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_GET_ROLE_CMD_TX_FAILED, CMD, ERROR, "ERROR: Last attempt for transmitting the Get Role Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_GET_ROLE_RESP_RX_RETRY, CMD, WARN, "WARNING: Attempt %d to receive the Get Role Response from HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_GET_ROLE_RESP_RX_FAILED, CMD, ERROR, "ERROR: A Get Role Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n") \
+	X(HM10_CLONE_EV_GET_ROLE_RESP_INVALID, CMD, ERROR, "ERROR: A Get Role Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n") \
+	X(HM10_CLONE_EV_INVALID_ROLE_RECEIVED, CMD, ERROR, "ERROR: Received BLE Role %d is not recognized.\r\n") \
+	X(HM10_CLONE_EV_GET_ROLE_DONE, CMD, INFO, "DONE: The BLE Role was successfully received from the HM-10 Clone BLE Device.\r\n") \
+	X(HM10_CLONE_EV_INVALID_PIN_GIVEN, CMD, ERROR, "ERROR: Expected a number character value in ASCII code on given pin value at index %d, but the following ASCII value was given instead: %c.\r\n") \
+	X(HM10_CLONE_EV_PIN_CMD_SENDING, CMD, INFO, "Sending Pin Command to HM-10 Clone BLE Device...\r\n") \
+	X(HM10_CLONE_EV_PIN_CMD_TX_RETRY, CMD, WARN, "WARNING: Attempt %d to transmit Pin Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_PIN_CMD_TX_FAILED, CMD, ERROR, "ERROR: Last attempt for transmitting the Pin Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_PIN_RESP_RX_RETRY, CMD, WARN, "WARNING: Attempt %d to receive Pin Response from HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_PIN_RESP_RX_FAILED, CMD, ERROR, "ERROR: A Pin Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n") \
+	X(HM10_CLONE_EV_PIN_RESP_INVALID, CMD, ERROR, "ERROR: A Pin Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n") \
+	X(HM10_CLONE_EV_PIN_CMD_DONE, CMD, INFO, "DONE: A Pin Command was successfully sent to the HM-10 Clone BLE Device.\r\n") \
+	X(HM10_CLONE_EV_GET_PIN_CMD_SENDING, CMD, INFO, "Sending Get Pin Command to HM-10 Clone BLE Device...\r\n") \
+	X(HM10_CLONE_EV_GET_PIN_CMD_TX_RETRY, CMD, WARN, "WARNING: Attempt %d to transmit Get Pin Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_GET_PIN_CMD_TX_FAILED, CMD, ERROR, "ERROR: Last attempt for transmitting the Get Pin Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_GET_PIN_RESP_RX_RETRY, CMD, WARN, "WARNING: Attempt %d to receive the Get Pin Response from HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_GET_PIN_RESP_RX_FAILED, CMD, ERROR, "ERROR: A Get Pin Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n") \
+	X(HM10_CLONE_EV_INVALID_PIN_RECEIVED, CMD, ERROR, "ERROR: Expected a number character value in ASCII code on received pin value at index %d, but the following ASCII value was given instead: %c.\r\n") \
+	X(HM10_CLONE_EV_GET_PIN_DONE, CMD, INFO, "DONE: The BLE Pin was successfully received from the HM-10 Clone BLE Device.\r\n") \
+	X(HM10_CLONE_EV_INVALID_PIN_CODE_MODE, CMD, ERROR, "ERROR: An invalid pin code mode value has been given: %c_ASCII.\r\n") \
+	X(HM10_CLONE_EV_TYPE_CMD_SENDING, CMD, INFO, "Sending Type Command to HM-10 Clone BLE Device...\r\n") \
+	X(HM10_CLONE_EV_TYPE_CMD_TX_RETRY, CMD, WARN, "WARNING: Attempt %d to transmit Type Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_TYPE_CMD_TX_FAILED, CMD, ERROR, "ERROR: Last attempt for transmitting the Type Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_TYPE_RESP_RX_RETRY, CMD, WARN, "WARNING: Attempt %d to receive Type Response from HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_TYPE_RESP_RX_FAILED, CMD, ERROR, "ERROR: A Type Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n") \
+	X(HM10_CLONE_EV_TYPE_RESP_INVALID_VALUE, CMD, ERROR, "ERROR: A Type Response from the HM-10 Clone BLE Device was expected, but something else was received instead at index %d. The received value was %c_ASCII and the expected value is %c_ASCII.\r\n") \
+	X(HM10_CLONE_EV_TYPE_RESP_INVALID_CR_LF, CMD, ERROR, "ERROR: A Type Response from the HM-10 Clone BLE Device was expected, but something else was received instead at index %d and %d. The received values were %c_ASCII and %c_ASCII respectively and the expected values were CR and LF respectively.\r\n") \
+	X(HM10_CLONE_EV_TYPE_CMD_DONE, CMD, INFO, "DONE: A Type Command was successfully sent to the HM-10 Clone BLE Device.\r\n") \
+	X(HM10_CLONE_EV_GET_TYPE_CMD_SENDING, CMD, INFO, "Sending Get Type Command to HM-10 Clone BLE Device...\r\n") \
+	X(HM10_CLONE_EV_GET_TYPE_CMD_TX_RETRY, CMD, WARN, "WARNING: Attempt %d to transmit Get Type Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_GET_TYPE_CMD_TX_FAILED, CMD, ERROR, "ERROR: Last attempt for transmitting the Get Type Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_GET_TYPE_RESP_RX_RETRY, CMD, WARN, "WARNING: Attempt %d to receive the Get Type Response from HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_GET_TYPE_RESP_RX_FAILED, CMD, ERROR, "ERROR: A Get Type Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n") \
+	X(HM10_CLONE_EV_TYPE_RESP_INVALID, CMD, ERROR, "ERROR: A Type Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n") \
+	X(HM10_CLONE_EV_GET_PIN_CODE_MODE_DONE, CMD, INFO, "DONE: The BLE Pin Code Mode was successfully received from the HM-10 Clone BLE Device.\r\n") \
+	X(HM10_CLONE_EV_INVALID_OTA_DIRECTION, DATA, ERROR, "ERROR: OTA data path direction %d is not recognized.\r\n") \
+	X(HM10_CLONE_EV_OTA_TX_FAILED, DATA, ERROR, "ERROR: Transmission of %d bytes of OTA data to the HM-10 Clone BLE Device has failed (HM-10 Clone Exception code = %d).\r\n") \
+	X(HM10_CLONE_EV_OTA_RX_FAILED, DATA, ERROR, "ERROR: Reception of %d bytes of OTA data from the HM-10 Clone BLE Device has failed (HM-10 Clone Exception code = %d).\r\n") \
+	X(HM10_CLONE_EV_OTA_TX_DONE, DATA, DEBUG, "DONE: %d bytes of OTA data were transmitted to the HM-10 Clone BLE Device.\r\n") \
+	X(HM10_CLONE_EV_OTA_RX_DONE, DATA, DEBUG, "DONE: %d bytes of OTA data were received from the HM-10 Clone BLE Device.\r\n") \
+	X(HM10_CLONE_EV_RX_OVERRUN, DATA, ERROR, "ERROR: The RX ring buffer overflowed and %d bytes of OTA data were lost before being committed.\r\n") \
+	X(HM10_CLONE_EV_FLUSH_BYTE, FLUSH, DEBUG, "Flushed byte %d from the RX of the UART.\r\n") \
+	X(HM10_CLONE_EV_FLUSH_LIMIT, FLUSH, WARN, "WARNING: The flush of the RX of the UART was stopped after %d bytes, since the HM-10 Clone BLE Device kept sending data.\r\n") \
+	X(HM10_CLONE_EV_TRANSACTION_RETRY, CMD, WARN, "WARNING: Attempt %d of the non-blocking transaction of AT Command %d has failed (HM-10 Clone Exception code = %d).\r\n") \
+	X(HM10_CLONE_EV_TRANSACTION_FAILED, CMD, ERROR, "ERROR: Last attempt of the non-blocking transaction of AT Command %d has failed (HM-10 Clone Exception code = %d).\r\n") \
+	X(HM10_CLONE_EV_TRANSACTION_RESP_INVALID, CMD, ERROR, "ERROR: The Responses of the non-blocking transaction of AT Command %d were expected, but something else was received instead.\r\n") \
+	X(HM10_CLONE_EV_TRANSACTION_DONE, CMD, INFO, "DONE: The non-blocking transaction of AT Command %d was successfully concluded.\r\n") \
+	X(HM10_CLONE_EV_CMD_RX_STREAM, CMD, ERROR, "ERROR: The AT Command %d was not sent because the RX of the UART is taken by the zero-copy reception of the OTA data.\r\n") \
+	X(HM10_CLONE_EV_CMD_BUSY, CMD, WARN, "WARNING: The AT Command %d was not sent because a non-blocking transaction is in progress.\r\n") \
+	X(HM10_CLONE_EV_SCAN_CMD_SENDING, CONN, INFO, "Sending Scan Command to HM-10 Clone BLE Device...\r\n") \
+	X(HM10_CLONE_EV_SCAN_CMD_TX_RETRY, CONN, WARN, "WARNING: Attempt %d to transmit Scan Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_SCAN_CMD_TX_FAILED, CONN, ERROR, "ERROR: Last attempt for transmitting the Scan Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_SCAN_RESP_RX_FAILED, CONN, ERROR, "ERROR: The Scan Responses from the HM-10 Clone BLE Device could not be received (HM-10 Clone Exception code = %d)\r\n") \
+	X(HM10_CLONE_EV_SCAN_DEVICE_FOUND, CONN, INFO, "The BLE Device with address 0x%04X%04X%04X was discovered.\r\n") \
+	X(HM10_CLONE_EV_SCAN_TIMEOUT, CONN, WARN, "WARNING: The scan of the HM-10 Clone BLE Device did not conclude in time, after having discovered %d BLE Devices.\r\n") \
+	X(HM10_CLONE_EV_SCAN_DONE, CONN, INFO, "DONE: The scan of the HM-10 Clone BLE Device concluded after having discovered %d BLE Devices.\r\n") \
+	X(HM10_CLONE_EV_LINE_TOO_LONG, CONN, WARN, "WARNING: A Response line from the HM-10 Clone BLE Device exceeded %d bytes and was discarded.\r\n") \
+	X(HM10_CLONE_EV_STATE_PIN_NOT_SET, CONN, ERROR, "ERROR: The STATE pin of the HM-10 Clone BLE Device has not been set.\r\n") \
+	X(HM10_CLONE_EV_ALREADY_CONNECTED, CONN, WARN, "WARNING: The HM-10 Clone BLE Device is already connected.\r\n") \
+	X(HM10_CLONE_EV_CONNECTED_GUARD, CONN, WARN, "WARNING: The AT Command %d was not sent because the HM-10 Clone BLE Device is connected.\r\n") \
+	X(HM10_CLONE_EV_CONNECTED_WAIT, CONN, INFO, "The AT Command %d is being held until the HM-10 Clone BLE Device disconnects.\r\n") \
+	X(HM10_CLONE_EV_POWER_PIN_NOT_SET, CONN, ERROR, "ERROR: The power pin of the HM-10 Clone BLE Device has not been set.\r\n") \
+	X(HM10_CLONE_EV_POWER_CYCLE_START, CONN, INFO, "Powering off the HM-10 Clone BLE Device for %d ms...\r\n") \
+	X(HM10_CLONE_EV_POWER_READY_TIMEOUT, CONN, ERROR, "ERROR: The HM-10 Clone BLE Device did not answer within %d ms after being powered on.\r\n") \
+	X(HM10_CLONE_EV_POWER_RESTORE_FAILED, CONN, ERROR, "ERROR: The AT Command %d could not restore the configuration of the HM-10 Clone BLE Device (HM-10 Clone Exception code = %d).\r\n") \
+	X(HM10_CLONE_EV_POWER_CYCLE_DONE, CONN, INFO, "DONE: The HM-10 Clone BLE Device was ready %d ms after powering it off (boot = %d ms, restore = %d ms).\r\n") \
+	X(HM10_CLONE_EV_CONNECT_CMD_SENDING, CONN, INFO, "Sending Connect Command to HM-10 Clone BLE Device...\r\n") \
+	X(HM10_CLONE_EV_CONNECT_CMD_TX_RETRY, CONN, WARN, "WARNING: Attempt %d to transmit Connect Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_CONNECT_CMD_TX_FAILED, CONN, ERROR, "ERROR: Last attempt for transmitting the Connect Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_CONNECT_TIMEOUT, CONN, ERROR, "ERROR: The HM-10 Clone BLE Device did not connect within %d ms.\r\n") \
+	X(HM10_CLONE_EV_CONNECT_DONE, CONN, INFO, "DONE: The HM-10 Clone BLE Device connected after %d ms.\r\n") \
+	X(HM10_CLONE_EV_AUTO_RECONNECT_CMD_SENDING, CONN, INFO, "Sending Auto-Reconnect Command to HM-10 Clone BLE Device...\r\n") \
+	X(HM10_CLONE_EV_AUTO_RECONNECT_CMD_TX_RETRY, CONN, WARN, "WARNING: Attempt %d to transmit Auto-Reconnect Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_AUTO_RECONNECT_CMD_TX_FAILED, CONN, ERROR, "ERROR: Last attempt for transmitting the Auto-Reconnect Command to HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_AUTO_RECONNECT_RESP_RX_RETRY, CONN, WARN, "WARNING: Attempt %d to receive Auto-Reconnect Response from HM-10 Clone BLE Device has failed.\r\n") \
+	X(HM10_CLONE_EV_AUTO_RECONNECT_RESP_RX_FAILED, CONN, ERROR, "ERROR: An Auto-Reconnect Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n") \
+	X(HM10_CLONE_EV_AUTO_RECONNECT_RESP_INVALID, CONN, ERROR, "ERROR: An Auto-Reconnect Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n") \
+	X(HM10_CLONE_EV_AUTO_RECONNECT_CMD_DONE, CONN, INFO, "DONE: The automatic reconnection of the HM-10 Clone BLE Device was set to %d.\r\n")
+
+/**@brief	HM-10 Clone binary trace event definitions.
+ *
+ * @details These definitions are generated from the @ref HM10_CLONE_TRACE_EVENTS table.
+ */
+typedef enum
+{
+	#define HM10_CLONE_TRACE_EVENT_ID(event, subsystem, level, format)	event,
+	HM10_CLONE_TRACE_EVENTS(HM10_CLONE_TRACE_EVENT_ID)
+	#undef HM10_CLONE_TRACE_EVENT_ID
+	HM10_CLONE_EV_COUNT		//!< Total number of events defined in @ref HM10_Clone_Trace_Event .
+} HM10_Clone_Trace_Event;
+
+#endif /* AT_09_TRACE_EVENTS_H_ */
+
+/** @} */ // AT_09_trace_events
+
+/** @} */ // hm10_ble_clone
@@ -234,6 +234,10 @@
 					  break;
 				  }
 			  }
+			  #if HM10_CLONE_TX_COALESCING
+			  // Sending the last bytes that did not fill a whole packet without waiting for HM10_CLONE_TX_COALESCING_DELAY_MS.
+			  flush_hm10clone_ota_data(1000);
+			  #endif
 		  }
 	  }
 	  printf("DEBUG: BLE Connection has been lost.\r\n");
@@ -253,9 +257,15 @@
 #include <stdio.h>	// Library from which "printf" is located at.
 #include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
 #include "AT-09_config.h" // This custom Mortrack's library contains configurations of the AT-09 zs040 BLE Driver Library.
+#include "AT-09_trace_events.h" // This custom Mortrack's library contains the events that the AT-09 zs040 BLE Driver Library can record into its binary trace.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 #define HM10_CLONE_MAX_BLE_NAME_SIZE							(12)		/**< @brief Total maximum bytes that the BLE Name of the HM-10 Clone BLE Device can have. */
 #define HM10_CLONE_PIN_VALUE_SIZE								(6)			/**< @brief Length in bytes of the Pin value in a HM-10 Clone BLE device. */
+#define HM10_CLONE_BLE_ADDRESS_SIZE								(6)			/**< @brief Length in bytes of the address of a BLE Device. */
 
 /**@brief	HM-10 Clone Exception codes.
  *
@@ -269,7 +279,9 @@ typedef enum
 	HM10_Clone_EC_STOP  = 1U,    //!< HM-10 Clone Process has been stopped.
 	HM10_Clone_EC_NR	= 2U,	 //!< HM-10 Clone Process has concluded with no response from HM-10 Device.
 	HM10_Clone_EC_NA    = 3U,    //!< HM-10 Clone Data received or to be received Not Applicable.
-	HM10_Clone_EC_ERR   = 4U     //!< HM-10 Clone Process has failed.
+	HM10_Clone_EC_ERR   = 4U,    //!< HM-10 Clone Process has failed.
+	HM10_Clone_EC_BUSY  = 5U,    //!< HM-10 Clone Process is still in progress (see @ref poll_hm10clone_transaction ), or it could not be started because another one (e.g., a non-blocking transaction) is currently in progress.
+	HM10_Clone_EC_CONNECTED	= 6U	//!< HM-10 Clone Process was not executed because the HM-10 Clone BLE Device is connected with an external BLE Device, which would have forwarded its AT Command Over the Air instead of executing it (see @ref set_hm10clone_connected_policy ).
 } HM10_Clone_Status;
 
 /**@brief	HM-10 Clone BLE Role definitions.
@@ -305,6 +317,7 @@ typedef enum
 	HM10_Clone_Pin_Code_ENABLED		= 49U	//!< HM-10 Clone Pin Code enabled during a bonding process with other BLE devices. @note \f$49_d = 1_{ASCII}\f$.
 } HM10_Clone_Pin_Code_Mode;
 
+#if HM10_CLONE_STATE_PIN || HM10_CLONE_POWER_PIN
 /**@brief	GPIO Definition parameters structure.
  *
  * @details This contains all the fields required to associate a certain GPIO pin to either the STATE pin of the HM-10
@@ -319,6 +332,373 @@ typedef struct __attribute__ ((__packed__)) {
 	GPIO_TypeDef *GPIO_Port;	//!< Type Definition of the GPIO peripheral port to which this @ref GPIO_def_t structure will be associated with.
 	uint16_t GPIO_Pin;			//!< Pin number of the GPIO peripheral from to this @ref GPIO_def_t structure will be associated with.
 } GPIO_def_t;
+#endif
+
+#if HM10_CLONE_STATE_PIN
+/**@brief	Policies for the AT Commands that are requested while the HM-10 Clone BLE Device is connected.
+ *
+ * @details Whenever the STATE pin of the HM-10 Clone BLE Device is high (see @ref set_hm10clone_state_pin ), the
+ *          HM-10 Clone BLE Device does not execute the AT Commands that it receives but forwards them Over the Air to
+ *          its peer, so the AT Command would only time out while its peer receives garbage. These policies apply to
+ *          every AT Command function except for @ref connect_hm10clone_device , which already handles that case.
+ */
+typedef enum
+{
+	HM10_Clone_Connected_SEND	= 0U,	//!< Send the AT Commands anyway.
+	HM10_Clone_Connected_REJECT	= 1U,	//!< Conclude the AT Commands right away with @ref HM10_Clone_EC_CONNECTED .
+	HM10_Clone_Connected_WAIT	= 2U	//!< Hold the AT Commands until the HM-10 Clone BLE Device disconnects, concluding them with @ref HM10_Clone_EC_CONNECTED if it does not disconnect in time.
+} HM10_Clone_Connected_Policy;
+#endif
+
+#if HM10_CLONE_POWER_PIN
+/**@brief	Times taken by each phase of a forced disconnection of the HM-10 Clone BLE Device (see
+ *          @ref disconnect_hm10clone_device ).
+ */
+typedef struct
+{
+	uint32_t off_ms;		//!< Time in milliseconds during which the HM-10 Clone BLE Device was kept powered off.
+	uint32_t boot_ms;		//!< Time in milliseconds from powering the HM-10 Clone BLE Device back on until it answered the Test Command.
+	uint32_t restore_ms;	//!< Time in milliseconds that restoring the cached configuration of the HM-10 Clone BLE Device took.
+	uint32_t total_ms;		//!< Time in milliseconds from powering off the HM-10 Clone BLE Device until it was ready again with its configuration restored.
+} HM10_Clone_Teardown_Times;
+#endif
+
+/**@brief	HM-10 Clone AT Command definitions.
+ *
+ * @details These definitions identify each of the AT Commands that the @ref hm10_ble_clone can send to the HM-10 Clone
+ *          BLE Device, which are used for indexing the per-command statistics (see @ref HM10_Clone_Stats ).
+ */
+typedef enum
+{
+	HM10_Clone_Cmd_Test		= 0U,	//!< Test Command (i.e., @ref send_hm10clone_test_cmd ).
+	HM10_Clone_Cmd_Reset	= 1U,	//!< Reset Command (i.e., @ref send_hm10clone_reset_cmd ).
+	HM10_Clone_Cmd_Set_Name	= 2U,	//!< Name Command (i.e., @ref set_hm10clone_name ).
+	HM10_Clone_Cmd_Get_Name	= 3U,	//!< Get Name Command (i.e., @ref get_hm10clone_name ).
+	HM10_Clone_Cmd_Set_Role	= 4U,	//!< Role Command (i.e., @ref set_hm10clone_role ).
+	HM10_Clone_Cmd_Get_Role	= 5U,	//!< Get Role Command (i.e., @ref get_hm10clone_role ).
+	HM10_Clone_Cmd_Set_Pin	= 6U,	//!< Pin Command (i.e., @ref set_hm10clone_pin ).
+	HM10_Clone_Cmd_Get_Pin	= 7U,	//!< Get Pin Command (i.e., @ref get_hm10clone_pin ).
+	HM10_Clone_Cmd_Set_Type	= 8U,	//!< Type Command (i.e., @ref set_hm10clone_pin_code_mode ).
+	HM10_Clone_Cmd_Get_Type	= 9U,	//!< Get Type Command (i.e., @ref get_hm10clone_pin_code_mode ).
+	HM10_Clone_Cmd_Scan		= 10U,	//!< Scan Command (i.e., @ref scan_hm10clone_devices ).
+	HM10_Clone_Cmd_Connect	= 11U,	//!< Connect Command (i.e., @ref connect_hm10clone_device ).
+	HM10_Clone_Cmd_Set_Auto_Reconnect	= 12U,	//!< Auto-Reconnect Command (i.e., @ref set_hm10clone_auto_reconnect ).
+	HM10_Clone_Cmd_Count	= 13U	//!< Total number of AT Commands defined in @ref HM10_Clone_Cmd .
+} HM10_Clone_Cmd;
+
+#if HM10_CLONE_STATS
+/**@brief	Statistics of a single AT Command type.
+ *
+ * @note    All the latencies are measured with the HAL Tick and, therefore, they are given in milliseconds and include
+ *          the RX flushes and retries made during each call.
+ */
+typedef struct
+{
+	uint32_t calls;					//!< Number of calls made to the public function of this AT Command.
+	uint32_t attempts;				//!< Total number of attempts made to send this AT Command (i.e., calls plus retries).
+	uint32_t first_try_successes;	//!< Number of calls that were successful without requiring any retry.
+	uint32_t retries;				//!< Number of retries made to send this AT Command.
+	uint32_t timeouts;				//!< Number of calls that concluded with @ref HM10_Clone_EC_NR .
+	uint32_t validation_failures;	//!< Number of calls that concluded with @ref HM10_Clone_EC_ERR without a UART error (i.e., either the given params or the received Response were invalid).
+	uint32_t connected_rejections;	//!< Number of calls that concluded with @ref HM10_Clone_EC_CONNECTED without sending this AT Command, which are not counted as attempts.
+	uint32_t latency_min_ms;		//!< Lowest latency of a single call in milliseconds (\c UINT32_MAX if there have been no calls).
+	uint32_t latency_max_ms;		//!< Highest latency of a single call in milliseconds.
+	uint32_t latency_sum_ms;		//!< Sum of the latencies of all the calls in milliseconds.
+} HM10_Clone_Cmd_Stats;
+
+/**@brief	Statistics of the UART link with the HM-10 Clone BLE Device.
+ */
+typedef struct
+{
+	uint32_t ota_tx_bytes;			//!< Bytes that went through the UART via @ref send_hm10clone_ota_data and @ref send_hm10clone_ota_data_vectored , which includes the packets that were sent before a call failed.
+	uint32_t ota_rx_bytes;			//!< Bytes successfully received via @ref get_hm10clone_ota_data .
+	uint32_t ota_tx_timeouts;		//!< Calls to @ref send_hm10clone_ota_data that concluded with @ref HM10_Clone_EC_NR .
+	uint32_t ota_rx_timeouts;		//!< Calls to @ref get_hm10clone_ota_data that concluded with @ref HM10_Clone_EC_NR .
+	uint32_t uart_errors;			//!< Number of \c HAL_ERROR statuses given by the UART, either on the AT Commands or on the OTA data path.
+	uint32_t rx_overruns;			//!< Number of times that the DMA overwrote bytes of the RX ring buffer that had not been committed yet, whenever @ref HM10_CLONE_ZERO_COPY_RX is enabled (see @ref peek_hm10clone_rx_data ).
+} HM10_Clone_Link_Stats;
+
+/**@brief	Performance counters and health statistics of the @ref hm10_ble_clone .
+ */
+typedef struct
+{
+	HM10_Clone_Cmd_Stats cmd[HM10_Clone_Cmd_Count];	//!< Statistics of each AT Command type, indexed with @ref HM10_Clone_Cmd .
+	HM10_Clone_Link_Stats link;						//!< Statistics of the UART link.
+} HM10_Clone_Stats;
+#endif
+
+/**@brief	Segment of data of a vectored Over the Air (OTA) transmission (see @ref send_hm10clone_ota_data_vectored ).
+ */
+typedef struct
+{
+	const uint8_t *data;	//!< Pointer to the data of this segment.
+	uint16_t size;			//!< Length in bytes of the data of this segment.
+} HM10_Clone_Tx_Segment;
+
+#define HM10_CLONE_RETRY_BACKOFF_STEPS							(4)			/**< @brief Number of steps of the backoff schedule of a @ref HM10_Clone_Retry_Policy . */
+
+/**@brief	Retry policy of the AT Commands.
+ *
+ * @details Whenever the transmission of an AT Command or the reception of its Responses fails, the @ref hm10_ble_clone
+ *          waits the backoff time of the current step of this policy and then makes a new attempt, for as long as the
+ *          failure status is retryable and the maximum number of attempts has not been reached yet. The attempts are
+ *          made iteratively, so the stack usage of the AT Commands does not grow with the number of attempts. This way,
+ *          the worst-case latency of an AT Command is given by \c max_attempts times the duration of a single attempt
+ *          plus the sum of the backoff times of its retries.
+ *
+ * @note    Responses that are received but whose content is not the expected one are not retried, since they are
+ *          given by a mismatch of the HM-10 Clone BLE Device rather than by a transient condition.
+ */
+typedef struct
+{
+	uint8_t max_attempts;									//!< Maximum number of attempts of each AT Command, which must be at least 1.
+	uint16_t backoff_ms[HM10_CLONE_RETRY_BACKOFF_STEPS];	//!< Time in milliseconds to wait before each retry, where the index \c i gives the wait after \c i+1 failed attempts and the last step is repeated for any further retries.
+	uint8_t retry_on_nr;									//!< \c 1 if attempts that concluded with @ref HM10_Clone_EC_NR are retried. Otherwise, \c 0 .
+	uint8_t retry_on_err;									//!< \c 1 if attempts that concluded with @ref HM10_Clone_EC_ERR due to the UART are retried. Otherwise, \c 0 .
+} HM10_Clone_Retry_Policy;
+
+#if HM10_CLONE_ADAPTIVE_TIMEOUT
+/**@brief	Round-trip time estimate of an AT Command type, which gives its adaptive timeout (see
+ *          @ref HM10_CLONE_ADAPTIVE_TIMEOUT ).
+ */
+typedef struct
+{
+	uint32_t samples;		//!< Number of round-trip time samples that have been taken.
+	uint32_t srtt_ms;		//!< Smoothed round-trip time in milliseconds.
+	uint32_t rttvar_ms;		//!< Round-trip time variation in milliseconds.
+	uint8_t backoff;		//!< Number of consecutive timeouts that have doubled the timeout.
+	uint32_t rx_timeout_ms;	//!< Timeout in milliseconds that is currently given to a Response, without its wire time.
+} HM10_Clone_Timeout_Estimate;
+#endif
+
+#if HM10_CLONE_OTA_BENCHMARK
+/**@brief	OTA data path directions definitions.
+ *
+ * @details These definitions are used to identify whether an OTA data path measurement of the @ref hm10_ble_clone
+ *          refers to the data sent (i.e., @ref send_hm10clone_ota_data ) or to the data received (i.e.,
+ *          @ref get_hm10clone_ota_data ) via the HM-10 Clone BLE Device.
+ */
+typedef enum
+{
+	HM10_Clone_OTA_TX	= 0U,	//!< OTA data sent from our MCU/MPU towards the external BLE Device.
+	HM10_Clone_OTA_RX	= 1U	//!< OTA data received by our MCU/MPU from the external BLE Device.
+} HM10_Clone_OTA_Direction;
+
+/**@brief	OTA data path measurements of a single direction.
+ *
+ * @details The goodput is given by the \c wire_bytes minus the \c overhead_bytes fields divided by the elapsed time
+ *          of the measurement window (see @ref HM10_Clone_OTA_Benchmark ), whereas the CPU cycles per delivered byte
+ *          are given by the \c cycles field divided by that same difference of bytes.
+ */
+typedef struct
+{
+	uint32_t calls;												//!< Number of calls made to the corresponding OTA data function.
+	uint32_t failed_calls;										//!< Number of those calls that did not return @ref HM10_Clone_EC_OK .
+	uint32_t wire_bytes;										//!< Bytes successfully transferred through the UART of the HM-10 Clone BLE Device.
+	uint32_t overhead_bytes;									//!< Bytes out of \c wire_bytes that were reported as protocol overhead via @ref add_hm10clone_ota_benchmark_overhead (e.g., headers, checksums or retransmissions of a framed mode).
+	uint64_t cycles;											//!< Total CPU cycles spent inside the corresponding OTA data function.
+	uint32_t max_latency_cycles;								//!< Largest CPU cycles spent inside a single call of the corresponding OTA data function.
+	uint32_t latency_histogram[HM10_CLONE_OTA_BENCHMARK_HISTOGRAM_BUCKETS];	//!< Latency histogram of the calls made to the corresponding OTA data function (see @ref HM10_CLONE_OTA_BENCHMARK_HISTOGRAM_BUCKETS ).
+} HM10_Clone_OTA_Benchmark_Path;
+
+/**@brief	OTA data path measurements of the @ref hm10_ble_clone .
+ */
+typedef struct
+{
+	uint32_t window_start_tick;									//!< HAL Tick, in milliseconds, at which the measurement window started (i.e., the last time that @ref reset_hm10clone_ota_benchmark was called).
+	uint32_t window_end_tick;									//!< HAL Tick, in milliseconds, at which this snapshot of the measurements was taken.
+	uint32_t core_clock_hz;										//!< Frequency in Hz of @ref HM10_CLONE_OTA_BENCHMARK_CLOCK (i.e., the core clock by default) with which the \c cycles fields were measured.
+	HM10_Clone_OTA_Benchmark_Path path[2];						//!< Measurements of each direction of the OTA data path, indexed with @ref HM10_Clone_OTA_Direction .
+} HM10_Clone_OTA_Benchmark;
+#endif
+
+#if HM10_CLONE_TIMER
+/**@brief	Timer wheel timer states definitions.
+ */
+typedef enum
+{
+	HM10_Clone_Timer_IDLE		= 0U,	//!< The timer is not running.
+	HM10_Clone_Timer_ARMED		= 1U,	//!< The timer is running and its deadline has not been reached yet.
+	HM10_Clone_Timer_PENDING	= 2U,	//!< The deadline of the timer has been reached and its callback has not been called by @ref poll_hm10clone_timers yet.
+	HM10_Clone_Timer_EXPIRED	= 3U	//!< The deadline of the timer has been reached and its callback, if any, has already been called.
+} HM10_Clone_Timer_State;
+
+struct HM10_Clone_Timer;
+
+/**@brief	Function that is called by @ref poll_hm10clone_timers for each timer whose deadline has been reached.
+ *
+ * @param[in,out] timer	Pointer to the timer that expired, which can be started again right from this function.
+ * @param context		Pointer that was given together with the timer (see @ref start_hm10clone_timer ).
+ */
+typedef void (*HM10_Clone_Timer_Callback)(struct HM10_Clone_Timer *timer, void *context);
+
+/**@brief	Timer of the timer wheel of the @ref hm10_ble_clone .
+ *
+ * @details The memory of each timer is given by its owner, which links it into the slot of the timer wheel of its
+ *          deadline while it is running, so that the timer wheel can hold any number of timers. Its fields are managed
+ *          by the @ref hm10_ble_clone and are not meant to be written by the implementer, who can however read its
+ *          \c state field at any time to know whether it has expired.
+ */
+typedef struct HM10_Clone_Timer
+{
+	struct HM10_Clone_Timer *next;				//!< Next timer of the same slot of the timer wheel while armed, or next expired timer whose callback is pending.
+	volatile HM10_Clone_Timer_State state;		//!< Current state of this timer.
+	uint16_t slot;								//!< Slot of the timer wheel at which this timer is while armed.
+	uint32_t rounds;							//!< Remaining revolutions of the timer wheel before this timer expires while armed.
+	HM10_Clone_Timer_Callback callback;			//!< Function that is called whenever this timer expires, or \c NULL if not required.
+	void *context;								//!< Pointer that is given to the \c callback field.
+} HM10_Clone_Timer;
+#endif
+
+#if HM10_CLONE_NONBLOCKING_API
+#define HM10_CLONE_MAX_TRANSACTION_SIZE						(HM10_CLONE_MAX_BLE_NAME_SIZE + 12)	/**< @brief Total maximum bytes of either the AT Command or the expected Responses of a @ref HM10_Clone_Transaction , which is given by the Name Response plus the OK Response that follows it. */
+
+/**@brief	Non-blocking AT Command transaction states definitions.
+ *
+ * @details These definitions are the states through which a @ref HM10_Clone_Transaction goes each time that
+ *          @ref poll_hm10clone_transaction is called.
+ */
+typedef enum
+{
+	HM10_Clone_Transaction_IDLE		= 0U,	//!< The transaction has not been started.
+	HM10_Clone_Transaction_FLUSH	= 1U,	//!< The RX of the UART is being flushed before sending the AT Command.
+	HM10_Clone_Transaction_TX		= 2U,	//!< The AT Command is being transmitted to the HM-10 Clone BLE Device.
+	HM10_Clone_Transaction_RX		= 3U,	//!< The Responses of the HM-10 Clone BLE Device are being received.
+	HM10_Clone_Transaction_DONE		= 4U,	//!< The transaction has concluded and its result is in its \c status field.
+	HM10_Clone_Transaction_BACKOFF	= 5U,	//!< The transaction is waiting for the backoff time of the retry policy before its next attempt (see @ref HM10_Clone_Retry_Policy ).
+	HM10_Clone_Transaction_WAIT_DISCONNECT	= 6U	//!< The transaction is held until the HM-10 Clone BLE Device disconnects (see @ref HM10_Clone_Connected_WAIT ).
+} HM10_Clone_Transaction_State;
+
+/**@brief	Non-blocking AT Command transaction.
+ *
+ * @details This structure holds all the data of an AT Command that is sent with the non-blocking functions of the
+ *          @ref hm10_ble_clone (e.g., @ref begin_hm10clone_set_role ), so it must remain valid until the transaction
+ *          concludes. Its fields are managed by the @ref hm10_ble_clone and are not meant to be written by the
+ *          implementer.
+ */
+typedef struct
+{
+	HM10_Clone_Cmd cmd;										//!< AT Command that is sent in this transaction.
+	HM10_Clone_Transaction_State state;						//!< Current state of this transaction.
+	HM10_Clone_Status status;								//!< Result of this transaction, which is @ref HM10_Clone_EC_BUSY until it concludes.
+	uint8_t retries;										//!< Number of attempts of this transaction that have failed and that were retried.
+	uint32_t start_tick;									//!< HAL Tick, in milliseconds, at which this transaction was started.
+	uint32_t state_tick;									//!< HAL Tick, in milliseconds, at which the current state was entered.
+	uint32_t rx_timeout;									//!< Timeout in milliseconds for receiving all the expected Responses.
+	uint16_t backoff_ms;									//!< Time in milliseconds to wait in the @ref HM10_Clone_Transaction_BACKOFF state.
+	uint16_t flushed_bytes;									//!< Number of bytes that have been flushed from the RX of the UART during the current attempt of this transaction, which is limited to @ref HM10_CLONE_MAX_FLUSH_BYTES .
+	uint8_t flush_byte;										//!< Memory into which the bytes flushed from the RX of the UART are received.
+	uint8_t tx_size;										//!< Length in bytes of the AT Command held at the \c tx field.
+	uint8_t rx_size;										//!< Length in bytes of the Responses held at the \c expected_rx field.
+#if HM10_CLONE_POWER_PIN
+	uint8_t value_size;										//!< Length in bytes of the value that is held right before the Carriage Return and New Line characters of the \c tx field, which is cached whenever this transaction concludes successfully.
+#endif
+	uint8_t tx[HM10_CLONE_MAX_TRANSACTION_SIZE];			//!< AT Command that is transmitted to the HM-10 Clone BLE Device.
+	uint8_t expected_rx[HM10_CLONE_MAX_TRANSACTION_SIZE];	//!< Responses that are expected from the HM-10 Clone BLE Device.
+	uint8_t rx[HM10_CLONE_MAX_TRANSACTION_SIZE];			//!< Responses that were received from the HM-10 Clone BLE Device.
+#if HM10_CLONE_TIMER
+	HM10_Clone_Timer deadline;								//!< Timer of the timer wheel that expires at the deadline of the current state, which is used instead of the \c state_tick field whenever a hardware timer has been set (see @ref set_hm10clone_timer_source ).
+#endif
+} HM10_Clone_Transaction;
+#endif
+
+#if HM10_CLONE_RTOS
+/**@brief	Porting interface of the Operating System primitives that are used by the @ref hm10_ble_clone whenever
+ *          @ref HM10_CLONE_RTOS is enabled.
+ *
+ * @details A single mutex serialises the calls to the @ref hm10_ble_clone , so that it can be used from several tasks
+ *          without having to wrap each call into a mutex of the application. In addition, a transmission semaphore and
+ *          a reception semaphore are given from the UART interrupts (see @ref hm10clone_uart_tx_cplt_isr ,
+ *          @ref hm10clone_uart_rx_cplt_isr and @ref hm10clone_uart_error_isr ), on which the calling task is blocked
+ *          while the UART transfers of the @ref hm10_ble_clone are in progress.
+ *
+ * @note    Since these are plain function pointers, any RTOS can be ported by populating this structure with its own
+ *          primitives (e.g., "AT-09_os_port_cmsis_rtos2.h" for CMSIS-RTOS2), including a POSIX threads shim for
+ *          running the @ref hm10_ble_clone on a host computer.
+ */
+typedef struct
+{
+	void *(*mutex_create)(void);									//!< Creates a mutex and returns it, or \c NULL on failure. @note The mutex must be recursive (i.e., the task that holds it must be able to take it again) and it should have priority inheritance.
+	void (*mutex_lock)(void *mutex);								//!< Takes the given mutex, waiting for as long as it takes.
+	void (*mutex_unlock)(void *mutex);								//!< Gives back the given mutex.
+	void *(*semaphore_create)(void);								//!< Creates a binary semaphore that is initially taken and returns it, or \c NULL on failure.
+	uint8_t (*semaphore_take)(void *semaphore, uint32_t timeout);	//!< Takes the given semaphore, waiting up to \c timeout milliseconds for it (where \c HAL_MAX_DELAY stands for waiting forever), and returns \c 1 if it was taken or \c 0 otherwise.
+	void (*semaphore_give)(void *semaphore);						//!< Gives the given semaphore. @note This function is called from the UART interrupts.
+	void (*delay)(uint32_t ms);										//!< Blocks the calling task for the given number of milliseconds.
+} HM10_Clone_OS_Port;
+#endif
+
+#if HM10_CLONE_CENTRAL_API
+/**@brief	BLE Device that was discovered by the HM-10 Clone BLE Device while scanning in Central mode.
+ */
+typedef struct
+{
+	uint8_t address[HM10_CLONE_BLE_ADDRESS_SIZE];	//!< Address of the discovered BLE Device, from its most significant byte to its least significant byte.
+	uint32_t last_seen_tick;						//!< HAL Tick, in milliseconds, at which the BLE Device was discovered for the last time.
+} HM10_Clone_Scan_Result;
+
+/**@brief	Function that is called by @ref scan_hm10clone_devices for each BLE Device that is discovered, as soon as its
+ *          Response line is received.
+ *
+ * @param[in] result	Pointer to the entry of the scan cache of the discovered BLE Device.
+ */
+typedef void (*HM10_Clone_Scan_Callback)(const HM10_Clone_Scan_Result *result);
+#endif
+
+#if HM10_CLONE_ZERO_COPY_RX
+#define HM10_CLONE_RX_MAX_SPANS									(2)			/**< @brief Maximum number of @ref HM10_Clone_Rx_Span that are given by @ref peek_hm10clone_rx_data , which happens whenever the readable bytes wrap around the end of the RX ring buffer. */
+
+/**@brief	Contiguous span of readable bytes of the RX ring buffer of the @ref hm10_ble_clone .
+ */
+typedef struct
+{
+	const uint8_t *data;	//!< Pointer to the first readable byte of this span, which points directly into the RX ring buffer.
+	uint16_t size;			//!< Length in bytes of this span.
+} HM10_Clone_Rx_Span;
+#endif
+
+#if HM10_CLONE_RPC || HM10_CLONE_MUX || HM10_CLONE_PING
+/**@brief	Function of a framing layer (e.g., @ref AT_09_rpc ) that parses each byte that is given by
+ *          @ref drain_hm10clone_ota_data .
+ *
+ * @param byte	Byte that was received.
+ */
+typedef void (*HM10_Clone_Rx_Feed)(uint8_t byte);
+#endif
+
+#if HM10_CLONE_CAPTURE
+#define HM10_CLONE_CAPTURE_TX									(0x00U)		/**< @brief @ref HM10_Clone_Capture_Record type of a transmission of the UART. */
+#define HM10_CLONE_CAPTURE_RX									(0x40U)		/**< @brief @ref HM10_Clone_Capture_Record type of a reception of the UART. */
+#define HM10_CLONE_CAPTURE_CALL_BEGIN							(0x80U)		/**< @brief @ref HM10_Clone_Capture_Record type of the beginning of a call to a public AT Command function. */
+#define HM10_CLONE_CAPTURE_CALL_END								(0xC0U)		/**< @brief @ref HM10_Clone_Capture_Record type of the end of a call to a public AT Command function. */
+#define HM10_CLONE_CAPTURE_TYPE_MASK							(0xC0U)		/**< @brief Bits of the \c info field of a @ref HM10_Clone_Capture_Record that hold its type. */
+#define HM10_CLONE_CAPTURE_DATA									(0x20U)		/**< @brief Bit of the \c info field of a @ref HM10_Clone_Capture_Record that indicates that it is followed by the \c size bytes that were transferred, which is set for every transmission and for every reception that concluded with \c HAL_OK . */
+#define HM10_CLONE_CAPTURE_STATUS_MASK							(0x1FU)		/**< @brief Bits of the \c info field of a @ref HM10_Clone_Capture_Record that hold its status. */
+
+/**@brief	Capture record structure.
+ *
+ * @details Whenever @ref HM10_CLONE_CAPTURE is enabled, each transmission and reception of the UART of the
+ *          @ref hm10_ble_clone is captured as one of these 9 bytes records, which is immediately followed by the bytes
+ *          that were transferred whenever its @ref HM10_CLONE_CAPTURE_DATA bit is set. The calls to the public AT
+ *          Command functions are also captured with a record at their beginning and another one at their end, so that
+ *          the transfers of each call can be told apart from those of the OTA data functions.
+ */
+typedef struct __attribute__ ((__packed__))
+{
+	uint32_t tick;		//!< HAL Tick, in milliseconds, at which the transfer or the call started.
+	uint16_t duration;	//!< Time in milliseconds that the transfer or the call took, which saturates at 65535 and which is 0 for @ref HM10_CLONE_CAPTURE_CALL_BEGIN .
+	uint16_t size;		//!< Length in bytes of the transfer, or the @ref HM10_Clone_Cmd of the call.
+	uint8_t info;		//!< Type (i.e., @ref HM10_CLONE_CAPTURE_TX , @ref HM10_CLONE_CAPTURE_RX , @ref HM10_CLONE_CAPTURE_CALL_BEGIN or @ref HM10_CLONE_CAPTURE_CALL_END ), @ref HM10_CLONE_CAPTURE_DATA bit and status (i.e., the \c HAL_StatusTypeDef value of a transfer or the @ref HM10_Clone_Status value returned by a call) of the record.
+} HM10_Clone_Capture_Record;
+
+/**@brief	Function to which the capture records are streamed out instead of being stored into the RAM ring buffer of
+ *          the @ref hm10_ble_clone (see @ref set_hm10clone_capture_sink ).
+ *
+ * @param[in] data	Pointer to the bytes of either a @ref HM10_Clone_Capture_Record or of the data that follows it.
+ * @param size		Length in bytes of the \p data param.
+ */
+typedef void (*HM10_Clone_Capture_Sink)(const uint8_t *data, uint16_t size);
+#endif
 
 /**@brief	Sends a Test Command to the HM-10 Clone BLE Device.
  *
@@ -364,14 +744,16 @@ HM10_Clone_Status send_hm10clone_test_cmd();
  */
 HM10_Clone_Status send_hm10clone_reset_cmd();
 
+#if HM10_CLONE_NAME_CMDS
 /**@brief	Sends a Name Command to the HM-10 Clone BLE Device and sets a desired BLE Name to that Device.
  *
  * @note	After calling this function, a 500 milliseconds of time must elapse before sending any other command to the
  *          HM-10 Clone BLE Device (i.e., the implementer must either be sure that this time elapses or to call a delay
  *          function for that amount of time). In addition, it is important to note that the first command attempt,
  *          after those 500 milliseconds, will be ignored by the HM-10 Clone BLE Device. However, all the functions
- *          contained in this header file contemplate attempting to send the corresponding commands two times due to
- *          this explained circumstance (i.e., the implementer does not need to call these functions twice).
+ *          contained in this header file contemplate attempting to send the corresponding commands again, as given by
+ *          the retry policy (see @ref set_hm10clone_retry_policy ), whose default of two attempts is due to this
+ *          explained circumstance (i.e., the implementer does not need to call these functions twice).
  * @note 	This function will reset the value of @ref resp_attempts attempts to zero once before attempting to send the
  *          desired Command to the HM-10 Clone BLE Device.
  *
@@ -389,7 +771,9 @@ HM10_Clone_Status send_hm10clone_reset_cmd();
  * @date	October 17, 2023
  */
 HM10_Clone_Status set_hm10clone_name(uint8_t *hm10_name, uint8_t size);
+#endif
 
+#if HM10_CLONE_NAME_CMDS && HM10_CLONE_GETTER_CMDS
 /**@brief	Gets the Name of the HM-10 Clone BLE Device.
  *
  * @note 	This function will reset the value of @ref resp_attempts attempts to zero once before attempting to send the
@@ -407,15 +791,18 @@ HM10_Clone_Status set_hm10clone_name(uint8_t *hm10_name, uint8_t size);
  * @date	October 20, 2023
  */
 HM10_Clone_Status get_hm10clone_name(uint8_t *hm10_name, uint8_t *size);
+#endif
 
+#if HM10_CLONE_ROLE_CMDS
 /**@brief	Sends a Role Command to the HM-10 Clone BLE Device and sets a desired BLE Role to that Device.
  *
  * @note	After calling this function, a 500 milliseconds of time must elapse before sending any other command to the
  *          HM-10 Clone BLE Device (i.e., the implementer must either be sure that this time elapses or to call a delay
  *          function for that amount of time). In addition, it is important to note that the first command attempt,
  *          after those 500 milliseconds, will be ignored by the HM-10 Clone BLE Device. However, all the functions
- *          contained in this header file contemplate attempting to send the corresponding commands two times due to
- *          this explained circumstance (i.e., the implementer does not need to call these functions twice).
+ *          contained in this header file contemplate attempting to send the corresponding commands again, as given by
+ *          the retry policy (see @ref set_hm10clone_retry_policy ), whose default of two attempts is due to this
+ *          explained circumstance (i.e., the implementer does not need to call these functions twice).
  * @note 	This function will reset the value of @ref resp_attempts attempts to zero once before attempting to send the
  *          desired Command to the HM-10 Clone BLE Device.
  *
@@ -430,7 +817,9 @@ HM10_Clone_Status get_hm10clone_name(uint8_t *hm10_name, uint8_t *size);
  * @date	October 23, 2023
  */
 HM10_Clone_Status set_hm10clone_role(HM10_Clone_Role ble_role);
+#endif
 
+#if HM10_CLONE_ROLE_CMDS && HM10_CLONE_GETTER_CMDS
 /**@brief	Gets the Role of the HM-10 Clone BLE Device.
  *
  * @note 	This function will reset the value of @ref resp_attempts attempts to zero once before attempting to send the
@@ -447,15 +836,18 @@ HM10_Clone_Status set_hm10clone_role(HM10_Clone_Role ble_role);
  * @date	October 23, 2023
  */
 HM10_Clone_Status get_hm10clone_role(HM10_Clone_Role *ble_role);
+#endif
 
+#if HM10_CLONE_PIN_CMDS
 /**@brief	Sends a Pin Command to the HM-10 Clone BLE Device and sets a desired BLE Pin to that Device.
  *
  * @note	After calling this function, a 500 milliseconds of time must elapse before sending any other command to the
  *          HM-10 Clone BLE Device (i.e., the implementer must either be sure that this time elapses or to call a delay
  *          function for that amount of time). In addition, it is important to note that the first command attempt,
  *          after those 500 milliseconds, will be ignored by the HM-10 Clone BLE Device. However, all the functions
- *          contained in this header file contemplate attempting to send the corresponding commands two times due to
- *          this explained circumstance (i.e., the implementer does not need to call these functions twice).
+ *          contained in this header file contemplate attempting to send the corresponding commands again, as given by
+ *          the retry policy (see @ref set_hm10clone_retry_policy ), whose default of two attempts is due to this
+ *          explained circumstance (i.e., the implementer does not need to call these functions twice).
  * @note 	This function will reset the value of @ref resp_attempts attempts to zero once before attempting to send the
  *          desired Command to the HM-10 Clone BLE Device.
  *
@@ -472,7 +864,9 @@ HM10_Clone_Status get_hm10clone_role(HM10_Clone_Role *ble_role);
  * @date	October 23, 2023
  */
 HM10_Clone_Status set_hm10clone_pin(uint8_t *pin);
+#endif
 
+#if HM10_CLONE_PIN_CMDS && HM10_CLONE_GETTER_CMDS
 /**@brief	Gets the Pin of the HM-10 Clone BLE Device.
  *
  * @note 	This function will reset the value of @ref resp_attempts attempts to zero once before attempting to send the
@@ -490,7 +884,9 @@ HM10_Clone_Status set_hm10clone_pin(uint8_t *pin);
  * @date	October 23, 2023
  */
 HM10_Clone_Status get_hm10clone_pin(uint8_t *pin);
+#endif
 
+#if HM10_CLONE_TYPE_CMDS
 /**@brief	Sends a Type Command to the HM-10 Clone BLE Device and sets a desired Pin Code Mode to that Device.
  *
  * @note    Although this function has been correctly programmed and is able to flawlessly configure the HM-10 Clone
@@ -503,8 +899,9 @@ HM10_Clone_Status get_hm10clone_pin(uint8_t *pin);
  *          HM-10 Clone BLE Device (i.e., the implementer must either be sure that this time elapses or to call a delay
  *          function for that amount of time). In addition, it is important to note that the first command attempt,
  *          after those 500 milliseconds, will be ignored by the HM-10 Clone BLE Device. However, all the functions
- *          contained in this header file contemplate attempting to send the corresponding commands two times due to
- *          this explained circumstance (i.e., the implementer does not need to call these functions twice).
+ *          contained in this header file contemplate attempting to send the corresponding commands again, as given by
+ *          the retry policy (see @ref set_hm10clone_retry_policy ), whose default of two attempts is due to this
+ *          explained circumstance (i.e., the implementer does not need to call these functions twice).
  * @note 	This function will reset the value of @ref resp_attempts attempts to zero once before attempting to send the
  *          desired Command to the HM-10 Clone BLE Device.
  *
@@ -519,7 +916,9 @@ HM10_Clone_Status get_hm10clone_pin(uint8_t *pin);
  * @date	October 24, 2023
  */
 HM10_Clone_Status set_hm10clone_pin_code_mode(HM10_Clone_Pin_Code_Mode pin_code_mode);
+#endif
 
+#if HM10_CLONE_TYPE_CMDS && HM10_CLONE_GETTER_CMDS
 /**@brief	Gets the Pin Code Mode that is currently configured in the HM-10 Clone BLE Device.
  *
  * @note 	This function will reset the value of @ref resp_attempts attempts to zero once before attempting to send the
@@ -536,12 +935,20 @@ HM10_Clone_Status set_hm10clone_pin_code_mode(HM10_Clone_Pin_Code_Mode pin_code_
  * @date	October 24, 2023
  */
 HM10_Clone_Status get_hm10clone_pin_code_mode(HM10_Clone_Pin_Code_Mode *pin_code_mode);
+#endif
 
 /**@brief   Sends some desired data Over the Air (OTA) via the HM-10 Clone BLE Device.
  *
  * @details The way the data will be sent is via the Polling mode of the UART in the HM-10 Clone BLE module.
  *
  * @note    No interrupt mode or non-blocking mode version of this function has yet been implemented.
+ * @note    Whenever @ref HM10_CLONE_TX_COALESCING is enabled, the data is gathered into packets of
+ *          @ref HM10_CLONE_MAX_PACKET_SIZE bytes, where only the whole packets are sent right away and the remaining
+ *          bytes are kept until either they fill a packet, @ref HM10_CLONE_TX_COALESCING_DELAY_MS expires (see
+ *          @ref poll_hm10clone_ota_tx ) or @ref flush_hm10clone_ota_data is called. In that mode, a
+ *          @ref HM10_Clone_EC_OK only means that the data was accepted, where a failure to send the bytes that were
+ *          kept is given later by whichever of those functions sends them, and any other status means that none of
+ *          the data was accepted.
  *
  * @param[out] ble_ota_data Pointer to the data that is desired to send OTA via the HM-10 Clone BLE Device.
  * @param size              Length in bytes of the data towards which the \p ble_ota_data param points to.
@@ -550,6 +957,8 @@ HM10_Clone_Status get_hm10clone_pin_code_mode(HM10_Clone_Pin_Code_Mode *pin_code
  * @retval	HM10_Clone_EC_OK	if the requested data was successfully send OTA via the HM-10 Clone BLE Device.
  * @retval  HM10_Clone_EC_NR    if there was no response from the HM-10 Clone BLE Device whenever attempting to send the
  *                              requested data OTA.
+ * @retval  HM10_Clone_EC_BUSY   if a non-blocking AT Command transaction is currently using the UART (see
+ *                              @ref poll_hm10clone_transaction ), in which case nothing is done.
  * @retval  HM10_Clone_EC_ERR   otherwise.
  *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
@@ -557,6 +966,65 @@ HM10_Clone_Status get_hm10clone_pin_code_mode(HM10_Clone_Pin_Code_Mode *pin_code
  */
 HM10_Clone_Status send_hm10clone_ota_data(uint8_t *ble_ota_data, uint16_t size, uint32_t timeout);
 
+/**@brief   Sends several segments of data back to back Over the Air (OTA) via the HM-10 Clone BLE Device, as if they
+ *          were a single contiguous block of data (e.g., the header and the payload of a message).
+ *
+ * @details The segments are streamed straight from their own memory, so that they do not have to be copied into a
+ *          staging buffer first. Each write to the UART holds at most @ref HM10_CLONE_MAX_PACKET_SIZE bytes, where the
+ *          boundaries of those writes are given by the whole stream of data rather than by each segment (i.e., the
+ *          bytes of a segment that does not fill a packet are completed with the bytes of the next segments).
+ *
+ * @note    Whenever @ref HM10_CLONE_TX_COALESCING is enabled, the bytes that @ref send_hm10clone_ota_data has coalesced
+ *          are sent first, so that the order of the data is kept.
+ *
+ * @param[in] segments      Pointer to the segments of data that are desired to send OTA, in the order in which they
+ *                          are desired to be sent.
+ * @param segments_count    Number of segments towards which the \p segments param points to.
+ * @param timeout           Timeout duration for sending all the segments OTA via the HM-10 Clone BLE Device.
+ *
+ * @retval	HM10_Clone_EC_OK	if all the segments were successfully send OTA via the HM-10 Clone BLE Device.
+ * @retval  HM10_Clone_EC_NR    if there was no response from the HM-10 Clone BLE Device whenever attempting to send the
+ *                              segments OTA within the \p timeout param.
+ * @retval  HM10_Clone_EC_BUSY   if a non-blocking AT Command transaction is currently using the UART (see
+ *                              @ref poll_hm10clone_transaction ), in which case nothing is done.
+ * @retval  HM10_Clone_EC_ERR   otherwise.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status send_hm10clone_ota_data_vectored(const HM10_Clone_Tx_Segment *segments, uint8_t segments_count, uint32_t timeout);
+
+#if HM10_CLONE_TX_COALESCING
+/**@brief   Sends right away the bytes that @ref send_hm10clone_ota_data has coalesced and that have not been sent yet,
+ *          if there are any.
+ *
+ * @param timeout   Timeout duration for sending the coalesced bytes OTA via the HM-10 Clone BLE Device.
+ *
+ * @retval	HM10_Clone_EC_OK	if there was nothing to send or if the coalesced bytes were successfully sent.
+ * @retval  HM10_Clone_EC_NR    if there was no response from the HM-10 Clone BLE Device whenever attempting to send the
+ *                              coalesced bytes, which are then kept to be sent later.
+ * @retval  HM10_Clone_EC_BUSY   if a non-blocking AT Command transaction is currently using the UART (see
+ *                              @ref poll_hm10clone_transaction ), in which case nothing is done.
+ * @retval  HM10_Clone_EC_ERR   otherwise.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status flush_hm10clone_ota_data(uint32_t timeout);
+
+/**@brief   Sends the bytes that @ref send_hm10clone_ota_data has coalesced only if the oldest of them has waited for at
+ *          least @ref HM10_CLONE_TX_COALESCING_DELAY_MS .
+ *
+ * @note    This function must be called periodically, since otherwise the coalesced bytes of a packet that never
+ *          fills would only be sent on the next call to @ref send_hm10clone_ota_data .
+ *
+ * @param timeout   Timeout duration for sending the coalesced bytes OTA via the HM-10 Clone BLE Device.
+ *
+ * @return	The same values as @ref flush_hm10clone_ota_data .
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status poll_hm10clone_ota_tx(uint32_t timeout);
+#endif
+
 /**@brief   Gets the HM-10 Clone Device's BLE data that is received Over the Air (OTA), if there is any within the
  *          specified timeout.
  *
@@ -577,6 +1045,8 @@ HM10_Clone_Status send_hm10clone_ota_data(uint8_t *ble_ota_data, uint16_t size,
  *
  * @retval	HM10_Clone_EC_OK	if some BLE data was successfully received OTA from the HM-10 Clone BLE Device.
  * @retval  HM10_Clone_EC_NR    if no BLE data was received OTA from the HM-10 Clone BLE Device.
+ * @retval  HM10_Clone_EC_BUSY   if a non-blocking AT Command transaction is currently using the UART (see
+ *                              @ref poll_hm10clone_transaction ), in which case nothing is done.
  * @retval  HM10_Clone_EC_ERR   otherwise.
  *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
@@ -584,24 +1054,801 @@ HM10_Clone_Status send_hm10clone_ota_data(uint8_t *ble_ota_data, uint16_t size,
  */
 HM10_Clone_Status get_hm10clone_ota_data(uint8_t *ble_ota_data, uint16_t size, uint32_t timeout);
 
+#if HM10_CLONE_STATE_PIN
+/**@brief	Sets the GPIO pin of our MCU/MPU that is connected to the STATE pin of the HM-10 Clone BLE Device, which is
+ *          high whenever the HM-10 Clone BLE Device is connected with an external BLE Device.
+ *
+ * @param[in] state_pin	Pointer to the GPIO definition of the STATE pin, which is copied by this function.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status set_hm10clone_state_pin(GPIO_def_t *state_pin);
+
+/**@brief	Gets whether the HM-10 Clone BLE Device is currently connected with an external BLE Device, as given by its
+ *          STATE pin (see @ref set_hm10clone_state_pin ).
+ *
+ * @param[out] connected	Pointer to the Memory Address into which a \c 1 will be stored if the HM-10 Clone BLE
+ *                          Device is connected, or a \c 0 otherwise.
+ *
+ * @retval	HM10_Clone_EC_OK	if the connection state was successfully read.
+ * @retval  HM10_Clone_EC_ERR   if the STATE pin has not been set.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status get_hm10clone_connection_state(uint8_t *connected);
+
+/**@brief	Sets what the AT Command functions do whenever they are called while the HM-10 Clone BLE Device is
+ *          connected, as given by its STATE pin (see @ref HM10_Clone_Connected_Policy ).
+ *
+ * @details With the @ref HM10_Clone_Connected_WAIT policy, the blocking AT Command functions poll the STATE pin every
+ *          millisecond without holding the mutex of the @ref hm10_ble_clone , so that the OTA data can keep flowing
+ *          meanwhile, whereas the non-blocking transactions are held at their
+ *          @ref HM10_Clone_Transaction_WAIT_DISCONNECT state, during which the OTA data functions can also be used.
+ *
+ * @note    No policy applies until the STATE pin has been set with @ref set_hm10clone_state_pin .
+ *
+ * @param policy		Desired policy.
+ * @param wait_timeout	Time in milliseconds that the @ref HM10_Clone_Connected_WAIT policy holds each AT Command
+ *                      before concluding it with @ref HM10_Clone_EC_CONNECTED , which is ignored by the other policies.
+ *
+ * @retval	HM10_Clone_EC_OK	if the policy was set.
+ * @retval  HM10_Clone_EC_ERR   if the \p policy param has an invalid value.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status set_hm10clone_connected_policy(HM10_Clone_Connected_Policy policy, uint32_t wait_timeout);
+#endif
+
+#if HM10_CLONE_POWER_PIN
+/**@brief	Sets the GPIO pin of our MCU/MPU that switches the power supply of the HM-10 Clone BLE Device, or that
+ *          drives its reset line, via an external circuitry (e.g., a high-side switch).
+ *
+ * @details The pin is driven to \p on_state right away, so that the HM-10 Clone BLE Device is powered on.
+ *
+ * @note    The GPIO pin must have been configured as an output by the implementer before calling this function.
+ *
+ * @param[in] power_pin	Pointer to the GPIO definition of the power pin, which is copied by this function.
+ * @param on_state		Logic level of the power pin that keeps the HM-10 Clone BLE Device powered on, whereas the
+ *                      opposite level powers it off (or holds it in reset).
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status set_hm10clone_power_pin(GPIO_def_t *power_pin, GPIO_PinState on_state);
+
+/**@brief	Forces the HM-10 Clone BLE Device to drop its BLE Connection, if any, by power-cycling it via its power pin
+ *          (see @ref set_hm10clone_power_pin ), since it cannot be disconnected with an AT Command.
+ *
+ * @details The HM-10 Clone BLE Device is kept powered off for @ref HM10_CLONE_POWER_OFF_TIME milliseconds. Then, instead
+ *          of waiting for its worst-case boot time, it is polled with the Test Command until it answers. Finally, the
+ *          last name, role, pin and pin code mode that were successfully set to it since @ref init_hm10_clone_module
+ *          was called, either with the blocking or with the non-blocking functions, are set to it again.
+ *
+ * @note    The mutex of the @ref hm10_ble_clone is held during the whole process.
+ *
+ * @param[out] times	Pointer to the Memory Address into which the times taken by each phase will be stored.
+ *
+ * @retval	HM10_Clone_EC_OK	if the HM-10 Clone BLE Device was power-cycled and its configuration was restored.
+ * @retval  HM10_Clone_EC_NR    if the HM-10 Clone BLE Device did not answer the Test Command within
+ *                              @ref HM10_CLONE_POWER_READY_TIMEOUT milliseconds after being powered on.
+ * @retval  HM10_Clone_EC_BUSY  if a non-blocking transaction is currently in progress.
+ * @retval  HM10_Clone_EC_ERR   if the power pin has not been set, or if the configuration could not be restored.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status disconnect_hm10clone_device(HM10_Clone_Teardown_Times *times);
+#endif
+
+#if HM10_CLONE_CENTRAL_API
+/**@brief	Scans for BLE Devices with the HM-10 Clone BLE Device, which must be in Central mode.
+ *
+ * @details The @ref HM10_CLONE_SCAN_CMD AT Command is sent and then, instead of waiting for a Response of a fixed
+ *          length, the Responses are parsed line by line as they arrive, so that each discovered BLE Device is stored
+ *          in the scan cache and given to the \p callback param right away. The scan concludes whenever the
+ *          @ref HM10_CLONE_SCAN_END_PREFIX Response line is received.
+ *
+ * @note    Since scanning takes several seconds, the scan cache (see @ref get_hm10clone_scan_cache ) can be used
+ *          afterwards to pick the BLE Device to connect to without having to scan again.
+ *
+ * @param timeout			Timeout duration, in milliseconds, for the whole scan.
+ * @param callback			Function that will be called for each discovered BLE Device, or \c NULL if not required.
+ * @param[out] devices_found	Pointer to the Memory Address into which the number of BLE Devices that were discovered
+ *                              will be stored.
+ *
+ * @retval	HM10_Clone_EC_OK	if the scan concluded successfully.
+ * @retval  HM10_Clone_EC_NR    if the scan did not conclude within the \p timeout param, in which case the BLE Devices
+ *                              that were discovered until then are still stored in the scan cache.
+ * @retval  HM10_Clone_EC_ERR   otherwise.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status scan_hm10clone_devices(uint32_t timeout, HM10_Clone_Scan_Callback callback, uint8_t *devices_found);
+
+/**@brief	Gets the BLE Devices of the scan cache that were seen within a certain amount of time.
+ *
+ * @param[out] results			Pointer to the Memory Address into which the BLE Devices will be stored, from the most
+ *                              recently seen one to the least recently seen one.
+ * @param max_results			Maximum number of BLE Devices that can be stored at the \p results param.
+ * @param max_age				Maximum time, in milliseconds, since the BLE Devices were last seen (where
+ *                              \c HAL_MAX_DELAY stands for any time).
+ * @param[out] results_count	Pointer to the Memory Address into which the number of BLE Devices that were stored at
+ *                              the \p results param will be stored.
+ *
+ * @retval	HM10_Clone_EC_OK	if at least one BLE Device was stored at the \p results param.
+ * @retval  HM10_Clone_EC_NR    if no BLE Device was seen within the \p max_age param.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status get_hm10clone_scan_cache(HM10_Clone_Scan_Result *results, uint8_t max_results, uint32_t max_age, uint8_t *results_count);
+
+/**@brief	Clears the scan cache.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status clear_hm10clone_scan_cache();
+
+/**@brief	Connects the HM-10 Clone BLE Device, which must be in Central mode, directly to the BLE Device of a known
+ *          address without scanning for it first.
+ *
+ * @details The @ref HM10_CLONE_CONNECT_CMD AT Command is sent with the given address and then the STATE pin (see
+ *          @ref set_hm10clone_state_pin ) is polled until it goes high, which is when the connection was established.
+ *          Whenever @ref HM10_CLONE_RTOS is enabled, the calling task sleeps between each poll.
+ *
+ * @note    The address can be taken from the scan cache (see @ref get_hm10clone_scan_cache ) or be a fixed one that was
+ *          stored by the application.
+ *
+ * @param[in] address			Address of the BLE Device to connect to, from its most significant byte to its least
+ *                              significant byte.
+ * @param timeout				Timeout duration, in milliseconds, for establishing the connection.
+ * @param[out] connect_time		Pointer to the Memory Address into which the time, in milliseconds, that it took to
+ *                              establish the connection will be stored (i.e., from sending the AT Command until the
+ *                              STATE pin went high).
+ *
+ * @retval	HM10_Clone_EC_OK	if the connection was successfully established, or if the HM-10 Clone BLE Device was
+ *                              already connected, in which case the \p connect_time param is set to zero.
+ * @retval  HM10_Clone_EC_NR    if there was no response from the HM-10 Clone BLE Device or if the connection was not
+ *                              established within the \p timeout param.
+ * @retval  HM10_Clone_EC_ERR   if the STATE pin has not been set or if anything else went wrong.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status connect_hm10clone_device(const uint8_t address[HM10_CLONE_BLE_ADDRESS_SIZE], uint32_t timeout, uint32_t *connect_time);
+
+/**@brief	Enables or disables the automatic reconnection of the HM-10 Clone BLE Device to its last peer, so that it
+ *          does not interfere with the connections requested with @ref connect_hm10clone_device .
+ *
+ * @param enable	\c 1 to send @ref HM10_CLONE_AUTO_RECONNECT_ON_CMD or \c 0 to send
+ *                  @ref HM10_CLONE_AUTO_RECONNECT_OFF_CMD .
+ *
+ * @retval	HM10_Clone_EC_OK	if the AT Command was accepted by the HM-10 Clone BLE Device.
+ * @retval  HM10_Clone_EC_NR    if there was no response from the HM-10 Clone BLE Device.
+ * @retval  HM10_Clone_EC_ERR   otherwise.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status set_hm10clone_auto_reconnect(uint8_t enable);
+#endif
+
+#if HM10_CLONE_ZERO_COPY_RX
+/**@brief	Starts receiving the HM-10 Clone Device's BLE data that is received Over the Air (OTA) into the internal RX
+ *          ring buffer of the @ref hm10_ble_clone via DMA.
+ *
+ * @details From then on, the received bytes can be parsed in place with @ref peek_hm10clone_rx_data and then released
+ *          with @ref commit_hm10clone_rx_data , without copying them into a buffer of the application.
+ *
+ * @note    The DMA channel of the RX of the UART must be configured in Circular mode, and
+ *          @ref hm10clone_uart_rx_half_cplt_isr and @ref hm10clone_uart_rx_cplt_isr must be called from the
+ *          @ref HAL_UART_RxHalfCpltCallback and @ref HAL_UART_RxCpltCallback functions of the application, since
+ *          they are the ones with which the overruns of the RX ring buffer are detected.
+ * @note    While the reception is in progress, the RX of the UART is taken by it, so the AT Commands return
+ *          @ref HM10_Clone_EC_ERR without sending anything and @ref get_hm10clone_ota_data cannot be used until
+ *          @ref stop_hm10clone_rx_stream is called.
+ *
+ * @retval	HM10_Clone_EC_OK	if the reception was successfully started.
+ * @retval  HM10_Clone_EC_NR    if the RX of the UART is busy.
+ * @retval  HM10_Clone_EC_ERR   if the RX of the UART has no DMA channel in Circular mode or if the reception could not
+ *                              be started.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status start_hm10clone_rx_stream();
+
+/**@brief	Stops the reception that was started with @ref start_hm10clone_rx_stream , which discards any bytes of the RX
+ *          ring buffer that have not been committed yet.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status stop_hm10clone_rx_stream();
+
+/**@brief	Gets the bytes that have been received into the RX ring buffer and that have not been committed yet, without
+ *          copying them.
+ *
+ * @details The readable bytes are given as up to @ref HM10_CLONE_RX_MAX_SPANS contiguous spans that point directly
+ *          into the RX ring buffer, where a second span is only given whenever those bytes wrap around the end of that
+ *          buffer. These spans remain valid until they are released with @ref commit_hm10clone_rx_data .
+ *
+ * @param[out] spans		Pointer to the Memory Address into which the @ref HM10_CLONE_RX_MAX_SPANS spans will be
+ *                          stored.
+ * @param[out] spans_count	Pointer to the Memory Address into which the number of valid spans will be stored.
+ *
+ * @retval	HM10_Clone_EC_OK	if there are readable bytes.
+ * @retval  HM10_Clone_EC_NR    if there are no readable bytes yet.
+ * @retval  HM10_Clone_EC_ERR   if the reception has not been started, or if the DMA overwrote bytes that had not been
+ *                              committed yet, in which case the overrun is counted in the \c rx_overruns field of
+ *                              the @ref HM10_Clone_Link_Stats and all the bytes of the RX ring buffer are discarded,
+ *                              so that the next calls give the bytes that are received from then on.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status peek_hm10clone_rx_data(HM10_Clone_Rx_Span spans[HM10_CLONE_RX_MAX_SPANS], uint8_t *spans_count);
+
+/**@brief	Releases the oldest bytes of the RX ring buffer, which were given by @ref peek_hm10clone_rx_data , so that
+ *          the DMA can reuse their memory.
+ *
+ * @param size	Length in bytes of the data that is desired to be released, which can be less than the readable bytes
+ *              whenever the application has only parsed part of them.
+ *
+ * @retval	HM10_Clone_EC_OK	if the requested bytes were released.
+ * @retval  HM10_Clone_EC_ERR   if the reception has not been started, if the \p size param is greater than the
+ *                              number of readable bytes or if the DMA overwrote bytes that had not been committed yet,
+ *                              which might include the ones that were parsed (see @ref peek_hm10clone_rx_data ).
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status commit_hm10clone_rx_data(uint16_t size);
+
+/**@brief	Counts a half of the RX ring buffer that has been filled by the DMA, so that the overruns of that buffer can
+ *          be detected.
+ *
+ * @note    This function must be called from the @ref HAL_UART_RxHalfCpltCallback function of the application, which
+ *          is the one that is called from the DMA interrupt.
+ *
+ * @param[in] huart	Pointer to the UART Handle Structure of the UART whose reception has filled half of its buffer,
+ *                  which is ignored if it is not the one of the @ref hm10_ble_clone .
+ *
+ * @date	October 18, 2026.
+ */
+void hm10clone_uart_rx_half_cplt_isr(UART_HandleTypeDef *huart);
+#endif
+
+#if HM10_CLONE_RPC || HM10_CLONE_MUX || HM10_CLONE_PING
+/**@brief	Updates a CRC-8 (polynomial 0x07) with a byte, which is the CRC of the frames of the framing layers of the
+ *          @ref hm10_ble_clone (e.g., @ref AT_09_rpc ).
+ *
+ * @param crc	Current value of the CRC.
+ * @param byte	Byte with which the CRC is updated.
+ *
+ * @return	The updated value of the CRC.
+ *
+ * @date	October 18, 2026.
+ */
+uint8_t update_hm10clone_crc8(uint8_t crc, uint8_t byte);
+
+/**@brief	Feeds every byte of OTA data that has been received so far into the parser of a framing layer of the
+ *          @ref hm10_ble_clone (e.g., @ref AT_09_rpc ), without waiting for any more bytes.
+ *
+ * @details Whenever @ref HM10_CLONE_ZERO_COPY_RX is enabled, the bytes are parsed in place from the RX ring buffer
+ *          and then committed. Otherwise, they are received one at a time without any timeout, where finding no
+ *          more bytes is not counted as a timeout of @ref get_hm10clone_ota_data in the @ref HM10_Clone_Stats nor
+ *          in the @ref HM10_Clone_OTA_Benchmark , and it is not logged either, since it is the normal outcome of
+ *          each of these calls.
+ *
+ * @param feed	Function into which each received byte is fed, in the order in which they were received.
+ *
+ * @retval	HM10_Clone_EC_OK	if all the received bytes were fed, even if there were none.
+ * @retval  HM10_Clone_EC_ERR   if the UART failed or, whenever @ref HM10_CLONE_ZERO_COPY_RX is enabled, if the
+ *                              reception of the RX ring buffer has not been started or if that buffer overflowed.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status drain_hm10clone_ota_data(HM10_Clone_Rx_Feed feed);
+#endif
+
+#if HM10_CLONE_LOG_ENABLED && (HM10_CLONE_VERBOSE_BACKEND == HM10_CLONE_VERBOSE_BACKEND_TRACE)
+/**@brief	Reads, from the oldest to the newest, the records that are currently stored in the binary trace ring buffer
+ *          of the @ref hm10_ble_clone and removes them from it.
+ *
+ * @details The records read can be sent to a host computer (e.g., via the UART1 whenever the timing of the application
+ *          is no longer relevant) and be turned back into the human-readable messages with the
+ *          "tools/AT-09_trace_decoder.c" program.
+ *
+ * @param[out] records      Pointer to the Memory Address into which the records will be copied.
+ * @param max_records       Maximum number of records that can be copied into the Memory Address towards which the
+ *                          \p records param points to.
+ * @param[out] records_read Number of records that were copied into the Memory Address towards which the \p records
+ *                          param points to.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status read_hm10clone_trace(HM10_Clone_Trace_Record *records, uint16_t max_records, uint16_t *records_read);
+#endif
+
+#if HM10_CLONE_CAPTURE
+/**@brief	Sets the function to which the capture records of the @ref hm10_ble_clone are streamed out (e.g., to write
+ *          them into an external FLASH memory or to send them through the UART1 as they are made).
+ *
+ * @param sink	Function to which each capture record is streamed out, which is called first with the
+ *              @ref HM10_Clone_Capture_Record and then with its data (if any), or \c NULL for storing the capture
+ *              records into the RAM ring buffer of the @ref hm10_ble_clone instead (see @ref read_hm10clone_capture ).
+ *
+ * @note    The \p sink param is called right after each transfer, so it should return quickly for the timing of the
+ *          captured traffic to remain the same as without the capture.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status set_hm10clone_capture_sink(HM10_Clone_Capture_Sink sink);
+
+/**@brief	Reads, from the oldest to the newest, the whole capture records that are currently stored in the RAM ring
+ *          buffer of the @ref hm10_ble_clone and removes them from it.
+ *
+ * @details The bytes read can be appended to a file on a host computer and be replayed against the
+ *          @ref hm10_ble_clone with the "tools/AT-09_capture_replayer.c" program.
+ *
+ * @param[out] data     Pointer to the Memory Address into which the capture records will be copied.
+ * @param max_size      Length in bytes of the Memory Address towards which the \p data param points to.
+ * @param[out] size_read Number of bytes that were copied into the Memory Address towards which the \p data param
+ *                      points to, which always consist of whole capture records.
+ *
+ * @retval	HM10_Clone_EC_OK	if all the capture records were read or if at least one of them was read.
+ * @retval	HM10_Clone_EC_ERR	if the oldest capture record does not fit into the \p max_size param.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status read_hm10clone_capture(uint8_t *data, uint16_t max_size, uint16_t *size_read);
+#endif
+
+#if HM10_CLONE_STATS
+/**@brief	Gets a snapshot of the performance counters and health statistics of the @ref hm10_ble_clone .
+ *
+ * @details These statistics make visible the retries that are otherwise silently made by each AT Command function,
+ *          so that degrading HM-10 Clone BLE Devices can be identified before they fail outright.
+ *
+ * @param[out] snapshot	Pointer to the structure into which the current statistics will be copied.
+ * @param reset			\c 1 to clear all the statistics right after having taken the snapshot, or \c 0 to keep
+ *                      accumulating them.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status get_hm10clone_stats(HM10_Clone_Stats *snapshot, uint8_t reset);
+#endif
+
+/**@brief	Sets the retry policy with which the failed attempts of the AT Commands are retried.
+ *
+ * @param[in] policy	Pointer to the desired retry policy, which is copied by this function.
+ *
+ * @retval	HM10_Clone_EC_OK	if the retry policy was successfully set.
+ * @retval  HM10_Clone_EC_ERR   if the \c max_attempts field of the \p policy param is zero.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status set_hm10clone_retry_policy(HM10_Clone_Retry_Policy *policy);
+
+/**@brief	Gets the retry policy with which the failed attempts of the AT Commands are retried.
+ *
+ * @param[out] policy	Pointer to the Memory Address into which the current retry policy will be copied.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status get_hm10clone_retry_policy(HM10_Clone_Retry_Policy *policy);
+
+#if HM10_CLONE_ADAPTIVE_TIMEOUT
+/**@brief	Gets the round-trip time estimate with which the adaptive timeouts of a certain AT Command type are given.
+ *
+ * @param cmd				AT Command type whose estimate is desired.
+ * @param[out] estimate		Pointer to the Memory Address into which the estimate will be copied.
+ *
+ * @retval	HM10_Clone_EC_OK	if the estimate was successfully copied.
+ * @retval  HM10_Clone_EC_ERR   if the \p cmd param has an invalid value.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status get_hm10clone_timeout_estimate(HM10_Clone_Cmd cmd, HM10_Clone_Timeout_Estimate *estimate);
+#endif
+
+#if HM10_CLONE_OTA_BENCHMARK
+/**@brief	Gets a snapshot of the OTA data path measurements made by the @ref hm10_ble_clone .
+ *
+ * @param[out] snapshot	Pointer to the structure into which the current measurements will be copied.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status get_hm10clone_ota_benchmark(HM10_Clone_OTA_Benchmark *snapshot);
+
+/**@brief	Clears all the OTA data path measurements and starts a new measurement window.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status reset_hm10clone_ota_benchmark();
+
+/**@brief	Reports a number of bytes, out of the ones already transferred via the OTA data functions, as protocol
+ *          overhead.
+ *
+ * @details This is meant to be called by any framed or reliable mode built over @ref send_hm10clone_ota_data and
+ *          @ref get_hm10clone_ota_data so that their headers, checksums and retransmissions are not accounted as
+ *          goodput.
+ *
+ * @param direction			OTA data path direction to which the overhead bytes belong to.
+ * @param overhead_bytes	Number of bytes to be accounted as protocol overhead.
+ *
+ * @retval	HM10_Clone_EC_OK	if the overhead bytes were accounted successfully.
+ * @retval  HM10_Clone_EC_ERR   if the \p direction param has an invalid value.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status add_hm10clone_ota_benchmark_overhead(HM10_Clone_OTA_Direction direction, uint32_t overhead_bytes);
+
+/**@brief	Gets an upper bound of the latency, in microseconds, below which a desired percentage of the calls made to
+ *          an OTA data function were completed.
+ *
+ * @param[in] path		Pointer to the measurements of the OTA data path direction of interest.
+ * @param percentile	Desired percentile, which must be within 1 and 100 (e.g., 99 for the tail latency).
+ *
+ * @return	The upper limit, in microseconds, of the histogram bucket that contains the requested percentile, or \c 0
+ *          if there are no calls measured or if the \p percentile param has an invalid value.
+ *
+ * @date	October 18, 2026.
+ */
+uint32_t get_hm10clone_ota_latency_percentile(HM10_Clone_OTA_Benchmark_Path *path, uint8_t percentile);
+#endif
+
+#if HM10_CLONE_NONBLOCKING_API
+/**@brief	Starts the non-blocking equivalent of @ref send_hm10clone_test_cmd .
+ *
+ * @details The transaction that is started by this function has to be driven to its conclusion by calling
+ *          @ref poll_hm10clone_transaction over and over (e.g., once per iteration of the control loop of the
+ *          application), which will never block the caller.
+ *
+ * @param[out] transaction	Pointer to the transaction that is desired to be started, which must remain valid until it
+ *                          concludes.
+ *
+ * @retval	HM10_Clone_EC_OK	if the transaction was successfully started.
+ * @retval  HM10_Clone_EC_BUSY  if another transaction is currently in progress.
+ * @retval  HM10_Clone_EC_ERR   otherwise.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status begin_hm10clone_test_cmd(HM10_Clone_Transaction *transaction);
+
+/**@brief	Starts the non-blocking equivalent of @ref send_hm10clone_reset_cmd .
+ *
+ * @param[out] transaction	Pointer to the transaction that is desired to be started, which must remain valid until it
+ *                          concludes (see @ref poll_hm10clone_transaction ).
+ *
+ * @retval	HM10_Clone_EC_OK	if the transaction was successfully started.
+ * @retval  HM10_Clone_EC_BUSY  if another transaction is currently in progress.
+ * @retval  HM10_Clone_EC_ERR   otherwise.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status begin_hm10clone_reset_cmd(HM10_Clone_Transaction *transaction);
+
+#if HM10_CLONE_NAME_CMDS
+/**@brief	Starts the non-blocking equivalent of @ref set_hm10clone_name .
+ *
+ * @param[out] transaction	Pointer to the transaction that is desired to be started, which must remain valid until it
+ *                          concludes (see @ref poll_hm10clone_transaction ).
+ * @param[in] hm10_name     Pointer to the ASCII Code data representing the desired BLE Name that wants to be given to
+ *                          the HM-10 Clone BLE Device, which is copied into the \p transaction param.
+ * @param size              Length in bytes of the data towards which the \p hm10_name param points to, which has to
+ *                          be @ref HM10_CLONE_MAX_BLE_NAME_SIZE at the most.
+ *
+ * @retval	HM10_Clone_EC_OK	if the transaction was successfully started.
+ * @retval  HM10_Clone_EC_BUSY  if another transaction is currently in progress.
+ * @retval  HM10_Clone_EC_ERR   if the \p size param has a value greater than @ref HM10_CLONE_MAX_BLE_NAME_SIZE , or
+ *                              if anything else went wrong.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status begin_hm10clone_set_name(HM10_Clone_Transaction *transaction, uint8_t *hm10_name, uint8_t size);
+#endif
+
+#if HM10_CLONE_ROLE_CMDS
+/**@brief	Starts the non-blocking equivalent of @ref set_hm10clone_role .
+ *
+ * @param[out] transaction	Pointer to the transaction that is desired to be started, which must remain valid until it
+ *                          concludes (see @ref poll_hm10clone_transaction ).
+ * @param ble_role          BLE Role that wants to be set on the HM-10 Clone BLE Device.
+ *
+ * @retval	HM10_Clone_EC_OK	if the transaction was successfully started.
+ * @retval  HM10_Clone_EC_BUSY  if another transaction is currently in progress.
+ * @retval  HM10_Clone_EC_ERR   if the \p ble_role param has an invalid value, or if anything else went wrong.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status begin_hm10clone_set_role(HM10_Clone_Transaction *transaction, HM10_Clone_Role ble_role);
+#endif
+
+#if HM10_CLONE_PIN_CMDS
+/**@brief	Starts the non-blocking equivalent of @ref set_hm10clone_pin .
+ *
+ * @param[out] transaction	Pointer to the transaction that is desired to be started, which must remain valid until it
+ *                          concludes (see @ref poll_hm10clone_transaction ).
+ * @param[in] pin           Pointer to the ASCII Code data representing the desired BLE Pin, which must consist of
+ *                          @ref HM10_CLONE_PIN_VALUE_SIZE number characters in ASCII Code.
+ *
+ * @retval	HM10_Clone_EC_OK	if the transaction was successfully started.
+ * @retval  HM10_Clone_EC_BUSY  if another transaction is currently in progress.
+ * @retval  HM10_Clone_EC_ERR   if the \p pin param points to data where one of its bytes does not correspond to a
+ *                              number character in ASCII Code, or if anything else went wrong.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status begin_hm10clone_set_pin(HM10_Clone_Transaction *transaction, uint8_t *pin);
+#endif
+
+#if HM10_CLONE_TYPE_CMDS
+/**@brief	Starts the non-blocking equivalent of @ref set_hm10clone_pin_code_mode .
+ *
+ * @param[out] transaction	Pointer to the transaction that is desired to be started, which must remain valid until it
+ *                          concludes (see @ref poll_hm10clone_transaction ).
+ * @param pin_code_mode     Pin Code Mode that is desired to set in the HM-10 Clone BLE Device.
+ *
+ * @retval	HM10_Clone_EC_OK	if the transaction was successfully started.
+ * @retval  HM10_Clone_EC_BUSY  if another transaction is currently in progress.
+ * @retval  HM10_Clone_EC_ERR   if the \p pin_code_mode param contains an invalid value, or if anything else went
+ *                              wrong.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status begin_hm10clone_set_pin_code_mode(HM10_Clone_Transaction *transaction, HM10_Clone_Pin_Code_Mode pin_code_mode);
+#endif
+
+/**@brief	Advances a non-blocking AT Command transaction through its states, without ever blocking the caller.
+ *
+ * @details Each call checks whether the interrupt driven UART operation of the current state of the transaction has
+ *          completed or timed out and, if so, it starts the operation of the next state. The RX of the UART is first
+ *          flushed until no byte is received during @ref HM10_CLONE_CUSTOM_HAL_TIMEOUT milliseconds, then the AT
+ *          Command is transmitted and finally all the expected Responses are received and validated. Just like with
+ *          the blocking functions, a transaction whose transmission or reception fails is retried once.
+ *
+ * @note    The non-blocking functions use the interrupt mode of the UART of the HM-10 Clone BLE Device, so its global
+ *          interrupt must be enabled in the NVIC. However, no HAL UART callback has to be implemented for them, except
+ *          that their round-trip time samples for @ref HM10_CLONE_ADAPTIVE_TIMEOUT are only taken whenever
+ *          @ref hm10clone_uart_rx_cplt_isr (and, preferably, @ref hm10clone_uart_tx_cplt_isr ) is called from them.
+ * @note    Whenever @ref HM10_CLONE_TIMER is enabled and a hardware timer has been set with
+ *          @ref set_hm10clone_timer_source , the deadline of each state is managed by the timer wheel with a resolution
+ *          of @ref HM10_CLONE_TIMER_TICK_US microseconds, where the RX of the UART is considered flushed after
+ *          @ref HM10_CLONE_TIMER_FLUSH_IDLE_US microseconds instead. Each call then only reads the state of that timer
+ *          instead of comparing the HAL Tick against each timeout.
+ * @note    While a transaction is in progress, the blocking AT Command functions of the @ref hm10_ble_clone return
+ *          @ref HM10_Clone_EC_BUSY without sending anything, and so do its OTA data functions while the transaction
+ *          is flushing the RX of the UART, sending its AT Command or receiving its Responses.
+ *
+ * @code
+  HM10_Clone_Transaction transaction;
+  begin_hm10clone_set_role(&transaction, HM10_Clone_Role_Peripheral);
+  while (1)
+  {
+	  if (poll_hm10clone_transaction(&transaction) != HM10_Clone_EC_BUSY)
+	  {
+		  // The Role Command has concluded and its result is at transaction.status .
+	  }
+	  // Run the real-time tasks of the application here.
+  }
+ * @endcode
+ *
+ * @param[in,out] transaction	Pointer to the transaction that is desired to be advanced.
+ *
+ * @retval	HM10_Clone_EC_BUSY	if the transaction is still in progress.
+ * @retval	HM10_Clone_EC_OK	if the transaction concluded successfully.
+ * @retval  HM10_Clone_EC_NR    if there was no response from the HM-10 Clone BLE Device.
+ * @retval  HM10_Clone_EC_ERR   if the validation of the Responses of the HM-10 Clone BLE Device was unsuccessful, if
+ *                              the transaction was never started or if anything else went wrong.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status poll_hm10clone_transaction(HM10_Clone_Transaction *transaction);
+
+/**@brief	Aborts a non-blocking AT Command transaction that is in progress.
+ *
+ * @param[in,out] transaction	Pointer to the transaction that is desired to be aborted.
+ *
+ * @retval	HM10_Clone_EC_OK	if the transaction was successfully aborted, or if it had already concluded.
+ * @retval  HM10_Clone_EC_ERR   if the transaction was never started.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status abort_hm10clone_transaction(HM10_Clone_Transaction *transaction);
+#endif
+
+#if HM10_CLONE_RTOS
+/**@brief	Sets the Operating System primitives with which the @ref hm10_ble_clone will serialise its calls and block
+ *          the calling tasks during its UART transfers.
+ *
+ * @note    This function must be called before @ref init_hm10_clone_module , which is the one that creates the mutex
+ *          and the semaphores through the given \p port .
+ * @note    The mutex of the @ref hm10_ble_clone is only held during each call, including each call to
+ *          @ref poll_hm10clone_transaction , so a non-blocking AT Command transaction can be polled or aborted from any
+ *          task while the other tasks keep using the OTA data functions in between those calls.
+ *
+ * @param[in] port	Pointer to the porting interface of the desired RTOS, which must remain valid from then on.
+ *
+ * @retval	HM10_Clone_EC_OK	if the porting interface was successfully set.
+ * @retval  HM10_Clone_EC_ERR   if any of the functions of the \p port param is missing.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status set_hm10clone_os_port(const HM10_Clone_OS_Port *port);
+#endif
+
+#if HM10_CLONE_RTOS || HM10_CLONE_NONBLOCKING_API
+/**@brief	Signals the end of a transmission of the @ref hm10_ble_clone to the task that is waiting for it, and records
+ *          the HAL Tick at which it ended for the round-trip time samples of the non-blocking transactions.
+ *
+ * @note    This function must be called from the @ref HAL_UART_TxCpltCallback function of the application, which is
+ *          the one that is called from the UART interrupt, whenever @ref HM10_CLONE_RTOS is enabled. Otherwise, it is
+ *          only needed for the samples of @ref HM10_CLONE_ADAPTIVE_TIMEOUT to exclude the time of the AT Command
+ *          that elapsed before @ref poll_hm10clone_transaction noticed that it was sent.
+ *
+ * @param[in] huart	Pointer to the UART Handle Structure of the UART whose transmission has ended, which is ignored if
+ *                  it is not the one of the @ref hm10_ble_clone .
+ *
+ * @date	October 18, 2026.
+ */
+void hm10clone_uart_tx_cplt_isr(UART_HandleTypeDef *huart);
+#endif
+
+#if HM10_CLONE_RTOS || HM10_CLONE_NONBLOCKING_API || HM10_CLONE_ZERO_COPY_RX
+/**@brief	Signals the end of a reception of the @ref hm10_ble_clone to the task that is waiting for it, and records
+ *          the HAL Tick at which it ended for the round-trip time samples of the non-blocking transactions.
+ *
+ * @details While the reception of @ref start_hm10clone_rx_stream is in progress, this function counts instead the
+ *          upper half of the RX ring buffer that the DMA has filled (see @ref hm10clone_uart_rx_half_cplt_isr ).
+ *
+ * @note    This function must be called from the @ref HAL_UART_RxCpltCallback function of the application, which is
+ *          the one that is called from the UART interrupt, whenever @ref HM10_CLONE_RTOS or
+ *          @ref HM10_CLONE_ZERO_COPY_RX is enabled. Otherwise, it is only needed for the non-blocking transactions to
+ *          give samples to @ref HM10_CLONE_ADAPTIVE_TIMEOUT , since the time at which
+ *          @ref poll_hm10clone_transaction is called says nothing about when the Responses arrived.
+ *
+ * @param[in] huart	Pointer to the UART Handle Structure of the UART whose reception has ended, which is ignored if it
+ *                  is not the one of the @ref hm10_ble_clone .
+ *
+ * @date	October 18, 2026.
+ */
+void hm10clone_uart_rx_cplt_isr(UART_HandleTypeDef *huart);
+#endif
+
+#if HM10_CLONE_RTOS
+
+/**@brief	Signals an error of the UART of the @ref hm10_ble_clone to the task that is waiting for its transfer, which
+ *          will then conclude that transfer with @ref HM10_Clone_EC_ERR .
+ *
+ * @note    This function must be called from the @ref HAL_UART_ErrorCallback function of the application, which is
+ *          the one that is called from the UART interrupt.
+ *
+ * @param[in] huart	Pointer to the UART Handle Structure of the UART that had an error, which is ignored if it is not
+ *                  the one of the @ref hm10_ble_clone .
+ *
+ * @date	October 18, 2026.
+ */
+void hm10clone_uart_error_isr(UART_HandleTypeDef *huart);
+#endif
+
+#if HM10_CLONE_TIMER
+/**@brief	Sets the hardware timer that drives the timer wheel of the @ref hm10_ble_clone , which stops every timer
+ *          that was running.
+ *
+ * @details The hardware timer must have been configured so that its update event happens every
+ *          @ref HM10_CLONE_TIMER_TICK_US microseconds, with its update interrupt enabled in the NVIC. The
+ *          @ref hm10_ble_clone starts it whenever a timer is started and stops it again whenever no timer is running,
+ *          so that it does not interrupt the CPU while there are no deadlines to wait for.
+ *
+ * @param[in] htim	Pointer to the TIM Handle Structure of the hardware timer, or \c NULL to stop using the timer
+ *                  wheel, in which case the non-blocking AT Command transactions go back to polling the HAL Tick.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status set_hm10clone_timer_source(TIM_HandleTypeDef *htim);
+
+/**@brief	Starts a timer of the timer wheel, or restarts it if it was already running.
+ *
+ * @details The timer expires no earlier than \p timeout_us microseconds from now and at most
+ *          @ref HM10_CLONE_TIMER_TICK_US microseconds after that. Its \c state field then changes to
+ *          @ref HM10_Clone_Timer_PENDING from the interrupt of the hardware timer, without the CPU having to poll for it,
+ *          and its \p callback param is called by the next @ref poll_hm10clone_timers .
+ *
+ * @param[in,out] timer	Pointer to the timer that is desired to be started, which must remain valid until it expires or
+ *                      until it is stopped. @note Its \c state field should have been zeroed (e.g., by declaring it as
+ *                      a static variable) before it is started for the first time, although a timer with leftover
+ *                      contents is also accepted, since it is only unlinked from the timer wheel once it is found there.
+ * @param timeout_us	Time in microseconds from now until the deadline of the timer, which can be up to about 71
+ *                      minutes.
+ * @param callback		Function that will be called whenever the timer expires, or \c NULL if not required.
+ * @param context		Pointer that will be given to the \p callback param.
+ *
+ * @retval	HM10_Clone_EC_OK	if the timer was started.
+ * @retval  HM10_Clone_EC_ERR   if no hardware timer has been set (see @ref set_hm10clone_timer_source ) or if it could
+ *                              not be started.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status start_hm10clone_timer(HM10_Clone_Timer *timer, uint32_t timeout_us, HM10_Clone_Timer_Callback callback, void *context);
+
+/**@brief	Stops a timer of the timer wheel, which discards its callback if it had expired and it had not been called
+ *          yet.
+ *
+ * @param[in,out] timer	Pointer to the timer that is desired to be stopped.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status stop_hm10clone_timer(HM10_Clone_Timer *timer);
+
+/**@brief	Calls the callbacks of the timers of the timer wheel that have expired, in the order in which they expired.
+ *
+ * @note    This function does not block and it is meant to be called from the main loop or from a task (e.g., right
+ *          after waking up from a \c __WFI() ), so that the callbacks do not run in the interrupt of the hardware
+ *          timer.
+ *
+ * @retval	HM10_Clone_EC_OK	always.
+ *
+ * @date	October 18, 2026.
+ */
+HM10_Clone_Status poll_hm10clone_timers();
+
+/**@brief	Advances the timer wheel of the @ref hm10_ble_clone by one tick, which expires the timers whose deadline has
+ *          been reached.
+ *
+ * @note    This function must be called from the @ref HAL_TIM_PeriodElapsedCallback function of the application, which
+ *          is the one that is called from the update interrupt of the hardware timer.
+ *
+ * @param[in] htim	Pointer to the TIM Handle Structure of the hardware timer whose period has elapsed, which is ignored
+ *                  if it is not the one of the timer wheel.
+ *
+ * @date	October 18, 2026.
+ */
+void hm10clone_timer_tick_isr(TIM_HandleTypeDef *htim);
+#endif
+
 /**@brief	Initializes the @ref hm10_ble_clone in order to be able to use its provided functions.
  *
  * @details This function stores in the @ref p_huart Global Static Pointer the address of the UART Handle Structure of
  *          the UART that is desired to be used in the @ref hm10_ble_clone to send/receive data to/from the HM-10 Clone
  *          BLE Device in Polling mode.
  *
- * @note    No interrupt mode or non-blocking mode version of this function/feature has yet been implemented.
+ * @note    Whenever @ref HM10_CLONE_RTOS is enabled, the UART is used in Interrupt mode instead and this function will
+ *          also create the mutex and the semaphores of the @ref hm10_ble_clone through the porting interface that was
+ *          given to @ref set_hm10clone_os_port .
  *
  * @param[in] huart	Pointer to the UART Handle Structure of the UART that it is desired to use in the
  *                  @ref hm10_ble_clone to send/receive data to/from the HM-10 Clone BLE Device.
  *
  * @retval	HM10_Clone_EC_OK	if the initialization of the @ref hm10_ble_clone was successful.
+ * @retval  HM10_Clone_EC_ERR   if @ref HM10_CLONE_RTOS is enabled and either no porting interface was given or the
+ *                              Operating System primitives could not be created.
  *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date	December 03, 2023
  */
 HM10_Clone_Status init_hm10_clone_module(UART_HandleTypeDef *huart);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* AT_09_ZS040_BLE_DRIVER_H_ */
 
 /** @} */
@@ -0,0 +1,493 @@
+/** @addtogroup hm10_ble_clone
+ * @{
+ */
+
+/**@file
+ * @brief	AT-09 zs040 BLE Driver C++ front-end Header file.
+ *
+ * @defgroup AT_09_cpp AT-09 zs040 BLE Driver C++ Front-End
+ * @{
+ *
+ * @brief   This header-only file provides a type-safe C++17 interface to the @ref hm10_ble_clone , which adds no
+ *          overhead over calling its C functions directly.
+ *
+ * @details The @ref hm10clone::Module class template is given a Transport policy and a Clock policy, whose functions
+ *          are all static and inline so that the compiler can inline the I/O path of the chosen backend:
+ *          <table>
+ *          <tr><th>Policy</th><th>Required static functions</th></tr>
+ *          <tr><td>Transport</td><td><tt>UART_HandleTypeDef *uart()</tt>: UART that is connected to the HM-10 Clone BLE Device.<br>
+ *                                    <tt>HM10_Clone_Status attach()</tt>: Called before @ref init_hm10_clone_module .<br>
+ *                                    <tt>HM10_Clone_Status start()</tt>: Called after @ref init_hm10_clone_module .<br>
+ *                                    <tt>template<class Clock> HM10_Clone_Status receive(uint8_t *data, uint16_t size, uint32_t timeout)</tt>: Receives the OTA data.</td></tr>
+ *          <tr><td>Clock</td><td><tt>uint32_t now_ms()</tt>: Current time in milliseconds.<br>
+ *                                <tt>void delay_ms(uint32_t ms)</tt>: Waits for the given number of milliseconds.</td></tr>
+ *          </table>
+ *          The following policies are given by this file: @ref hm10clone::HalTransport (UART in Polling mode, which also
+ *          runs on a host computer with a pty or a simulator through the POSIX HAL shim of the "tools/posix_hal"
+ *          folder), @ref hm10clone::RtosTransport (UART in Interrupt mode whenever @ref HM10_CLONE_RTOS is enabled),
+ *          @ref hm10clone::DmaRxTransport (RX ring buffer via DMA whenever @ref HM10_CLONE_ZERO_COPY_RX is enabled) and
+ *          @ref hm10clone::HalClock . For example:
+ *          @code
+ *          extern UART_HandleTypeDef huart1;
+ *          using Ble = hm10clone::Module<hm10clone::HalTransport<&huart1>>;
+ *
+ *          Ble::init();
+ *          Ble::set_name(hm10clone::Name("BLE Device")); // A name longer than 12 characters does not compile.
+ *          Ble::set_role(hm10clone::Role::Peripheral);
+ *          Ble::set_pin(hm10clone::Pin("123456")); // A pin that is not 6 characters long does not compile.
+ *          @endcode
+ *
+ * @note    No function of this file allocates memory from the heap, since all of its buffers have a fixed capacity.
+ * @note    The @ref hm10_ble_clone has a single global state, so all the functions of @ref hm10clone::Module are
+ *          static and only one backend can be used per program.
+ *
+ * @date	October 18, 2026.
+ */
+
+#ifndef AT_09_ZS040_BLE_DRIVER_HPP_
+#define AT_09_ZS040_BLE_DRIVER_HPP_
+
+#include <cstddef> // Library from which "std::size_t" is located at.
+#include <cstring> // Library from which "std::memcpy" is located at.
+#include "AT-09_zs040_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from a AT-09 zs040 BLE Device.
+
+namespace hm10clone
+{
+
+/**@brief	Strongly typed @ref HM10_Clone_Status .
+ */
+enum class Status : uint8_t
+{
+	Ok				= HM10_Clone_EC_OK,		//!< @ref HM10_Clone_EC_OK .
+	Stop			= HM10_Clone_EC_STOP,	//!< @ref HM10_Clone_EC_STOP .
+	NoResponse		= HM10_Clone_EC_NR,		//!< @ref HM10_Clone_EC_NR .
+	NotApplicable	= HM10_Clone_EC_NA,		//!< @ref HM10_Clone_EC_NA .
+	Error			= HM10_Clone_EC_ERR,	//!< @ref HM10_Clone_EC_ERR .
+	Busy			= HM10_Clone_EC_BUSY,	//!< @ref HM10_Clone_EC_BUSY .
+	Connected		= HM10_Clone_EC_CONNECTED	//!< @ref HM10_Clone_EC_CONNECTED .
+};
+
+/**@brief	Strongly typed @ref HM10_Clone_Role .
+ */
+enum class Role : uint8_t
+{
+	Peripheral	= HM10_Clone_Role_Peripheral,	//!< @ref HM10_Clone_Role_Peripheral .
+	Central		= HM10_Clone_Role_Central		//!< @ref HM10_Clone_Role_Central .
+};
+
+/**@brief	Strongly typed @ref HM10_Clone_Pin_Code_Mode .
+ */
+enum class PinCodeMode : uint8_t
+{
+	Disabled	= HM10_Clone_Pin_Code_DISABLED,	//!< @ref HM10_Clone_Pin_Code_DISABLED .
+	Enabled		= HM10_Clone_Pin_Code_ENABLED	//!< @ref HM10_Clone_Pin_Code_ENABLED .
+};
+
+/**@brief	Converts a @ref HM10_Clone_Status into its @ref hm10clone::Status .
+ */
+constexpr Status to_status(HM10_Clone_Status status)
+{
+	return static_cast<Status>(status);
+}
+
+/**@brief	Compile-time descriptor of an AT Command of the HM-10 Clone BLE Device.
+ */
+struct CommandDescriptor
+{
+	HM10_Clone_Cmd id;		//!< Identifier of the AT Command, which indexes the per-command statistics (see @ref HM10_Clone_Stats ).
+	const char *mnemonic;	//!< AT Command without its value and without its Carriage Return and New Line characters.
+	uint8_t max_value_size;	//!< Maximum length in bytes of the value that goes after the \c mnemonic .
+};
+
+/**@brief	Compile-time descriptors of the AT Commands of the HM-10 Clone BLE Device.
+ */
+namespace commands
+{
+inline constexpr CommandDescriptor test		{HM10_Clone_Cmd_Test,		"AT",		0};
+inline constexpr CommandDescriptor reset	{HM10_Clone_Cmd_Reset,		"AT+RESET",	0};
+inline constexpr CommandDescriptor set_name	{HM10_Clone_Cmd_Set_Name,	"AT+NAME",	HM10_CLONE_MAX_BLE_NAME_SIZE};
+inline constexpr CommandDescriptor get_name	{HM10_Clone_Cmd_Get_Name,	"AT+NAME",	0};
+inline constexpr CommandDescriptor set_role	{HM10_Clone_Cmd_Set_Role,	"AT+ROLE",	1};
+inline constexpr CommandDescriptor get_role	{HM10_Clone_Cmd_Get_Role,	"AT+ROLE",	0};
+inline constexpr CommandDescriptor set_pin	{HM10_Clone_Cmd_Set_Pin,	"AT+PIN",	HM10_CLONE_PIN_VALUE_SIZE};
+inline constexpr CommandDescriptor get_pin	{HM10_Clone_Cmd_Get_Pin,	"AT+PIN",	0};
+inline constexpr CommandDescriptor set_type	{HM10_Clone_Cmd_Set_Type,	"AT+TYPE",	1};
+inline constexpr CommandDescriptor get_type	{HM10_Clone_Cmd_Get_Type,	"AT+TYPE",	0};
+}
+
+/**@brief	Fixed-capacity buffer of bytes, which never allocates memory from the heap.
+ *
+ * @tparam Capacity	Maximum length in bytes of the data that this buffer can hold.
+ */
+template<std::size_t Capacity>
+class StaticBuffer
+{
+public:
+	static constexpr std::size_t capacity = Capacity;	//!< Maximum length in bytes of the data that this buffer can hold.
+
+	constexpr StaticBuffer() : data_{}, size_(0) {}
+
+	/**@brief	Creates this buffer from a string literal, whose length is validated at compile time.
+	 */
+	template<std::size_t N>
+	constexpr StaticBuffer(const char (&text)[N]) : data_{}, size_(N - 1)
+	{
+		static_assert(N - 1 <= Capacity, "The given string literal does not fit in this StaticBuffer.");
+		for (std::size_t i=0; i<N-1; i++)
+		{
+			data_[i] = static_cast<uint8_t>(text[i]);
+		}
+	}
+
+	/**@brief	Replaces the data of this buffer with the given one.
+	 *
+	 * @return	\c true if the given data was copied, or \c false if it does not fit in this buffer.
+	 */
+	bool assign(const uint8_t *data, std::size_t size)
+	{
+		if (size > Capacity)
+		{
+			return false;
+		}
+		std::memcpy(data_, data, size);
+		size_ = size;
+		return true;
+	}
+
+	uint8_t *data() { return data_; }
+	constexpr const uint8_t *data() const { return data_; }
+	constexpr std::size_t size() const { return size_; }
+
+	/**@brief	Sets the length in bytes of the data of this buffer, which is truncated to its \c capacity .
+	 */
+	void resize(std::size_t size) { size_ = (size < Capacity) ? size : Capacity; }
+
+private:
+	uint8_t data_[Capacity];
+	std::size_t size_;
+};
+
+/**@brief	BLE Name of the HM-10 Clone BLE Device, whose capacity is given by @ref commands::set_name .
+ */
+using Name = StaticBuffer<commands::set_name.max_value_size>;
+
+/**@brief	Pin of the HM-10 Clone BLE Device, whose length is always @ref HM10_CLONE_PIN_VALUE_SIZE .
+ */
+class Pin
+{
+public:
+	static constexpr std::size_t size = commands::set_pin.max_value_size;	//!< Length in bytes of the Pin.
+
+	constexpr Pin() : data_{} {}
+
+	/**@brief	Creates this Pin from a string literal, whose length is validated at compile time.
+	 */
+	template<std::size_t N>
+	constexpr Pin(const char (&text)[N]) : data_{}
+	{
+		static_assert(N - 1 == size, "A Pin must be exactly HM10_CLONE_PIN_VALUE_SIZE characters long.");
+		for (std::size_t i=0; i<size; i++)
+		{
+			data_[i] = static_cast<uint8_t>(text[i]);
+		}
+	}
+
+	uint8_t *data() { return data_; }
+	constexpr const uint8_t *data() const { return data_; }
+
+private:
+	uint8_t data_[size];
+};
+
+/**@brief	Clock policy of the STM32 HAL.
+ */
+struct HalClock
+{
+	static uint32_t now_ms() { return HAL_GetTick(); }
+	static void delay_ms(uint32_t ms) { HAL_Delay(ms); }
+};
+
+/**@brief	Transport policy that receives the OTA data in Polling mode (see @ref get_hm10clone_ota_data ).
+ *
+ * @tparam Huart	UART that is connected to the HM-10 Clone BLE Device.
+ */
+template<UART_HandleTypeDef *Huart>
+struct HalTransport
+{
+	static UART_HandleTypeDef *uart() { return Huart; }
+	static HM10_Clone_Status attach() { return HM10_Clone_EC_OK; }
+	static HM10_Clone_Status start() { return HM10_Clone_EC_OK; }
+
+	template<class Clock>
+	static HM10_Clone_Status receive(uint8_t *data, uint16_t size, uint32_t timeout)
+	{
+		return get_hm10clone_ota_data(data, size, timeout);
+	}
+};
+
+#if HM10_CLONE_RTOS
+/**@brief	Transport policy that blocks the calling task on the UART interrupts (see @ref HM10_CLONE_RTOS ).
+ *
+ * @tparam Huart	UART that is connected to the HM-10 Clone BLE Device.
+ * @tparam Port		Porting interface of the RTOS (e.g., @ref hm10clone_cmsis_rtos2_os_port ).
+ */
+template<UART_HandleTypeDef *Huart, const HM10_Clone_OS_Port *Port>
+struct RtosTransport : HalTransport<Huart>
+{
+	static HM10_Clone_Status attach() { return set_hm10clone_os_port(Port); }
+};
+#endif
+
+#if HM10_CLONE_ZERO_COPY_RX
+/**@brief	Transport policy that receives the OTA data into the RX ring buffer via DMA (see
+ *          @ref start_hm10clone_rx_stream ).
+ *
+ * @note    The AT Commands cannot be sent while the RX ring buffer is being received, so the HM-10 Clone BLE Device
+ *          must be configured before calling @ref hm10clone::Module::init with this policy, or in between
+ *          @ref stop_hm10clone_rx_stream and @ref start_hm10clone_rx_stream .
+ *
+ * @tparam Huart	UART that is connected to the HM-10 Clone BLE Device.
+ */
+template<UART_HandleTypeDef *Huart>
+struct DmaRxTransport : HalTransport<Huart>
+{
+	static HM10_Clone_Status start() { return start_hm10clone_rx_stream(); }
+
+	template<class Clock>
+	static HM10_Clone_Status receive(uint8_t *data, uint16_t size, uint32_t timeout)
+	{
+		HM10_Clone_Rx_Span spans[HM10_CLONE_RX_MAX_SPANS];
+		uint8_t spans_count;
+		uint32_t start_ms = Clock::now_ms();
+		for (;;)
+		{
+			HM10_Clone_Status ret = peek_hm10clone_rx_data(spans, &spans_count);
+			if (ret == HM10_Clone_EC_ERR)
+			{
+				return ret;
+			}
+			uint16_t readable = 0;
+			for (uint8_t i=0; (ret==HM10_Clone_EC_OK) && (i<spans_count); i++)
+			{
+				readable += spans[i].size;
+			}
+			if (readable >= size)
+			{
+				break;
+			}
+			if ((Clock::now_ms() - start_ms) >= timeout)
+			{
+				return HM10_Clone_EC_NR;
+			}
+		}
+
+		uint16_t copied = 0;
+		for (uint8_t i=0; copied<size; i++)
+		{
+			uint16_t chunk = ((size - copied) < spans[i].size) ? (size - copied) : spans[i].size;
+			std::memcpy(&data[copied], spans[i].data, chunk);
+			copied += chunk;
+		}
+		return commit_hm10clone_rx_data(size);
+	}
+};
+#endif
+
+/**@brief	Type-safe interface to the @ref hm10_ble_clone .
+ *
+ * @tparam Transport	Transport policy (e.g., @ref hm10clone::HalTransport ).
+ * @tparam Clock		Clock policy (e.g., @ref hm10clone::HalClock ).
+ */
+template<class Transport, class Clock = HalClock>
+class Module
+{
+public:
+	Module() = delete;
+
+	/**@brief	Attaches the Transport, initializes the @ref hm10_ble_clone (see @ref init_hm10_clone_module ) and
+	 *          then starts the Transport.
+	 */
+	static Status init()
+	{
+		HM10_Clone_Status ret = Transport::attach();
+		if (ret != HM10_Clone_EC_OK)
+		{
+			return to_status(ret);
+		}
+		ret = init_hm10_clone_module(Transport::uart());
+		if (ret != HM10_Clone_EC_OK)
+		{
+			return to_status(ret);
+		}
+		return to_status(Transport::start());
+	}
+
+	static Status test() { return to_status(send_hm10clone_test_cmd()); }
+	static Status reset() { return to_status(send_hm10clone_reset_cmd()); }
+
+	/* NOTE: The C functions below do not write to their input buffers even though they are not declared const. */
+
+#if HM10_CLONE_NAME_CMDS
+	static Status set_name(const Name &name)
+	{
+		return to_status(set_hm10clone_name(const_cast<uint8_t *>(name.data()), static_cast<uint8_t>(name.size())));
+	}
+#endif
+
+#if HM10_CLONE_NAME_CMDS && HM10_CLONE_GETTER_CMDS
+	static Status get_name(Name &name)
+	{
+		uint8_t size = 0;
+		Status ret = to_status(get_hm10clone_name(name.data(), &size));
+		name.resize((ret == Status::Ok) ? size : 0);
+		return ret;
+	}
+#endif
+
+#if HM10_CLONE_ROLE_CMDS
+	static Status set_role(Role role) { return to_status(set_hm10clone_role(static_cast<HM10_Clone_Role>(role))); }
+#endif
+
+#if HM10_CLONE_ROLE_CMDS && HM10_CLONE_GETTER_CMDS
+	static Status get_role(Role &role)
+	{
+		HM10_Clone_Role ble_role;
+		Status ret = to_status(get_hm10clone_role(&ble_role));
+		if (ret == Status::Ok)
+		{
+			role = static_cast<Role>(ble_role);
+		}
+		return ret;
+	}
+#endif
+
+#if HM10_CLONE_PIN_CMDS
+	static Status set_pin(const Pin &pin) { return to_status(set_hm10clone_pin(const_cast<uint8_t *>(pin.data()))); }
+#endif
+
+#if HM10_CLONE_PIN_CMDS && HM10_CLONE_GETTER_CMDS
+	static Status get_pin(Pin &pin) { return to_status(get_hm10clone_pin(pin.data())); }
+#endif
+
+#if HM10_CLONE_TYPE_CMDS
+	static Status set_pin_code_mode(PinCodeMode mode)
+	{
+		return to_status(set_hm10clone_pin_code_mode(static_cast<HM10_Clone_Pin_Code_Mode>(mode)));
+	}
+#endif
+
+#if HM10_CLONE_TYPE_CMDS && HM10_CLONE_GETTER_CMDS
+	static Status get_pin_code_mode(PinCodeMode &mode)
+	{
+		HM10_Clone_Pin_Code_Mode pin_code_mode;
+		Status ret = to_status(get_hm10clone_pin_code_mode(&pin_code_mode));
+		if (ret == Status::Ok)
+		{
+			mode = static_cast<PinCodeMode>(pin_code_mode);
+		}
+		return ret;
+	}
+#endif
+
+	/**@brief	Sends OTA data (see @ref send_hm10clone_ota_data ).
+	 */
+	static Status send(const uint8_t *data, uint16_t size, uint32_t timeout)
+	{
+		return to_status(send_hm10clone_ota_data(const_cast<uint8_t *>(data), size, timeout));
+	}
+
+	template<std::size_t Capacity>
+	static Status send(const StaticBuffer<Capacity> &buffer, uint32_t timeout)
+	{
+		static_assert(Capacity <= UINT16_MAX, "The StaticBuffer is too large to be sent at once.");
+		return send(buffer.data(), static_cast<uint16_t>(buffer.size()), timeout);
+	}
+
+	/**@brief	Receives exactly \p size bytes of OTA data through the Transport.
+	 */
+	static Status receive(uint8_t *data, uint16_t size, uint32_t timeout)
+	{
+		return to_status(Transport::template receive<Clock>(data, size, timeout));
+	}
+
+	/**@brief	Receives as many bytes of OTA data as the capacity of the given buffer.
+	 */
+	template<std::size_t Capacity>
+	static Status receive(StaticBuffer<Capacity> &buffer, uint32_t timeout)
+	{
+		static_assert(Capacity <= UINT16_MAX, "The StaticBuffer is too large to be received at once.");
+		Status ret = receive(buffer.data(), static_cast<uint16_t>(Capacity), timeout);
+		buffer.resize((ret == Status::Ok) ? Capacity : 0);
+		return ret;
+	}
+
+#if HM10_CLONE_STATE_PIN
+	/**@brief	Waits until the STATE pin reports a connection (see @ref get_hm10clone_connection_state ).
+	 *
+	 * @retval	Status::Ok			if the HM-10 Clone BLE Device got connected within the given timeout.
+	 * @retval  Status::NoResponse	if it did not get connected within the given timeout.
+	 * @retval  Status::Error		if the STATE pin has not been set.
+	 */
+	static Status wait_connected(uint32_t timeout, uint32_t poll_interval_ms = 10)
+	{
+		uint32_t start_ms = Clock::now_ms();
+		for (;;)
+		{
+			uint8_t connected;
+			HM10_Clone_Status ret = get_hm10clone_connection_state(&connected);
+			if ((ret != HM10_Clone_EC_OK) || connected)
+			{
+				return to_status(ret);
+			}
+			if ((Clock::now_ms() - start_ms) >= timeout)
+			{
+				return Status::NoResponse;
+			}
+			Clock::delay_ms(poll_interval_ms);
+		}
+	}
+#endif
+
+#if HM10_CLONE_NONBLOCKING_API
+	/**@brief	Polls a transaction that was started with one of the begin_hm10clone_* functions until it concludes,
+	 *          which is aborted if it does not conclude within the given timeout.
+	 */
+	static Status run(HM10_Clone_Transaction &transaction, uint32_t timeout)
+	{
+		uint32_t start_ms = Clock::now_ms();
+		HM10_Clone_Status ret;
+		while ((ret = poll_hm10clone_transaction(&transaction)) == HM10_Clone_EC_BUSY)
+		{
+			if ((Clock::now_ms() - start_ms) >= timeout)
+			{
+				abort_hm10clone_transaction(&transaction);
+				return Status::NoResponse;
+			}
+		}
+		return to_status(ret);
+	}
+#endif
+
+#if HM10_CLONE_STATS
+	/**@brief	Gets the statistics of the AT Command of the given descriptor (see @ref get_hm10clone_stats ).
+	 */
+	static Status get_command_stats(const CommandDescriptor &command, HM10_Clone_Cmd_Stats &stats)
+	{
+		HM10_Clone_Stats snapshot;
+		Status ret = to_status(get_hm10clone_stats(&snapshot, 0));
+		if (ret == Status::Ok)
+		{
+			stats = snapshot.cmd[command.id];
+		}
+		return ret;
+	}
+#endif
+};
+
+}
+
+#endif /* AT_09_ZS040_BLE_DRIVER_HPP_ */
+
+/** @} */ // AT_09_cpp
+
+/** @} */ // hm10_ble_clone
@@ -0,0 +1,304 @@
+/** @addtogroup AT_09_mux
+ * @{
+ */
+
+#include "AT-09_mux.h"
+#include <string.h>	// Library from which "memset()" is located at.
+
+#if HM10_CLONE_MUX
+_Static_assert((HM10_CLONE_MUX_CHANNELS >= 1) && (HM10_CLONE_MUX_CHANNELS <= 255), "HM10_CLONE_MUX_CHANNELS must be from 1 up to 255.");
+_Static_assert(HM10_CLONE_MUX_TX_QUEUE_SIZE <= 65535, "HM10_CLONE_MUX_TX_QUEUE_SIZE must be of up to 65535 bytes.");
+_Static_assert(HM10_CLONE_MUX_RX_BUFFER_SIZE <= 65535, "HM10_CLONE_MUX_RX_BUFFER_SIZE must be of up to 65535 bytes.");
+
+/**@brief	States of the reception of a multiplexed frame, which are named after the field that is expected next.
+ */
+typedef enum
+{
+	Mux_Rx_SYNC		= 0U,	//!< Waiting for the Sync field.
+	Mux_Rx_CHANNEL	= 1U,	//!< Waiting for the Channel field.
+	Mux_Rx_LENGTH	= 2U,	//!< Waiting for the Length field.
+	Mux_Rx_PAYLOAD	= 3U,	//!< Waiting for the remaining bytes of the Payload field.
+	Mux_Rx_CRC		= 4U	//!< Waiting for the CRC field.
+} Mux_Rx_State;
+
+/**@brief	Multiplexed frame that is being received.
+ */
+typedef struct
+{
+	Mux_Rx_State state;								//!< Field of the frame that is expected next.
+	uint8_t channel;								//!< Channel field of the frame.
+	uint8_t size;									//!< Length field of the frame.
+	uint8_t received;								//!< Number of bytes of the Payload field that have been received.
+	uint8_t crc;									//!< CRC of the fields that have been received.
+	uint8_t payload[HM10_CLONE_MUX_FRAGMENT_PAYLOAD];	//!< Payload field of the frame.
+} Mux_Rx_Frame;
+
+/**@brief	Logical channel.
+ */
+typedef struct
+{
+	uint8_t priority;									//!< Priority of the logical channel, where \c 0 is the highest.
+	uint8_t tx_queue[HM10_CLONE_MUX_TX_QUEUE_SIZE];		//!< Ring buffer with the data that is waiting to be sent.
+	uint16_t tx_head;									//!< Index of the oldest byte of the \c tx_queue field.
+	uint16_t tx_count;									//!< Number of bytes in the \c tx_queue field.
+	uint8_t rx_buffer[HM10_CLONE_MUX_RX_BUFFER_SIZE];	//!< Ring buffer with the data that has been received.
+	uint16_t rx_head;									//!< Index of the oldest byte of the \c rx_buffer field.
+	uint16_t rx_count;									//!< Number of bytes in the \c rx_buffer field.
+	uint32_t rx_dropped;								//!< Number of received bytes that did not fit in the \c rx_buffer field.
+} Mux_Channel;
+
+static Mux_Channel channels[HM10_CLONE_MUX_CHANNELS];						/**< @brief Logical channels that are multiplexed. */
+static Mux_Rx_Frame rx_frame;												/**< @brief Multiplexed frame that is being received. */
+static uint8_t last_tx_channel;												/**< @brief Logical channel from which the last fragment was sent, which is used to round-robin among the channels of the same priority. */
+
+/**@brief	Feeds a received byte into the @ref rx_frame , which demultiplexes the frame whenever it is complete.
+ *
+ * @param byte	Byte that was received.
+ *
+ * @date	October 18, 2026.
+ */
+static void mux_feed(uint8_t byte);
+
+/**@brief	Stores the payload of the complete @ref rx_frame into the RX buffer of its logical channel.
+ *
+ * @date	October 18, 2026.
+ */
+static void mux_demux();
+
+/**@brief	Sends a single fragment from the non-empty TX queue with the highest priority, if any.
+ *
+ * @return	The @ref HM10_Clone_Status value of @ref send_hm10clone_ota_data_vectored , or @ref HM10_Clone_EC_OK if
+ *          all the TX queues are empty.
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status mux_send_fragment();
+
+HM10_Clone_Status init_hm10clone_mux()
+{
+	memset(channels, 0, sizeof(channels));
+	rx_frame.state = Mux_Rx_SYNC;
+	last_tx_channel = HM10_CLONE_MUX_CHANNELS - 1;
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status set_hm10clone_mux_priority(uint8_t channel, uint8_t priority)
+{
+	if (channel >= HM10_CLONE_MUX_CHANNELS)
+	{
+		return HM10_Clone_EC_ERR;
+	}
+	channels[channel].priority = priority;
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status write_hm10clone_mux_channel(uint8_t channel, const uint8_t *data, uint16_t size)
+{
+	/** <b>Local variable ch:</b> Logical channel into which the data is queued. */
+	Mux_Channel *ch;
+	/** <b>Local variable tail:</b> Index of the TX queue into which the next byte is queued. */
+	uint16_t tail;
+
+	if (channel >= HM10_CLONE_MUX_CHANNELS)
+	{
+		return HM10_Clone_EC_ERR;
+	}
+	ch = &channels[channel];
+	if (size > (HM10_CLONE_MUX_TX_QUEUE_SIZE - ch->tx_count))
+	{
+		return HM10_Clone_EC_BUSY;
+	}
+
+	tail = (ch->tx_head + ch->tx_count) % HM10_CLONE_MUX_TX_QUEUE_SIZE;
+	for (uint16_t i=0; i<size; i++)
+	{
+		ch->tx_queue[tail] = data[i];
+		tail = (tail + 1) % HM10_CLONE_MUX_TX_QUEUE_SIZE;
+	}
+	ch->tx_count += size;
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status read_hm10clone_mux_channel(uint8_t channel, uint8_t *data, uint16_t max_size, uint16_t *size)
+{
+	/** <b>Local variable ch:</b> Logical channel from which the data is read. */
+	Mux_Channel *ch;
+	/** <b>Local variable n:</b> Number of bytes that are read. */
+	uint16_t n;
+
+	if (channel >= HM10_CLONE_MUX_CHANNELS)
+	{
+		return HM10_Clone_EC_ERR;
+	}
+	ch = &channels[channel];
+	n = (ch->rx_count < max_size) ? ch->rx_count : max_size;
+	for (uint16_t i=0; i<n; i++)
+	{
+		data[i] = ch->rx_buffer[ch->rx_head];
+		ch->rx_head = (ch->rx_head + 1) % HM10_CLONE_MUX_RX_BUFFER_SIZE;
+	}
+	ch->rx_count -= n;
+	*size = n;
+
+	return (n > 0) ? HM10_Clone_EC_OK : HM10_Clone_EC_NR;
+}
+
+uint32_t get_hm10clone_mux_rx_dropped(uint8_t channel)
+{
+	return (channel < HM10_CLONE_MUX_CHANNELS) ? channels[channel].rx_dropped : 0;
+}
+
+HM10_Clone_Status poll_hm10clone_mux()
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	ret = drain_hm10clone_ota_data(mux_feed);
+	if (ret == HM10_Clone_EC_ERR)
+	{
+		return ret;
+	}
+
+	return mux_send_fragment();
+}
+
+static void mux_feed(uint8_t byte)
+{
+	switch (rx_frame.state)
+	{
+		case Mux_Rx_SYNC:
+			if (byte == HM10_CLONE_MUX_SYNC)
+			{
+				rx_frame.crc = 0;
+				rx_frame.state = Mux_Rx_CHANNEL;
+			}
+			return;
+		case Mux_Rx_CHANNEL:
+			rx_frame.channel = byte;
+			rx_frame.state = Mux_Rx_LENGTH;
+			break;
+		case Mux_Rx_LENGTH:
+			if ((byte == 0) || (byte > HM10_CLONE_MUX_FRAGMENT_PAYLOAD))
+			{
+				rx_frame.state = Mux_Rx_SYNC; // Resynchronise, since this cannot be a valid frame.
+				return;
+			}
+			rx_frame.size = byte;
+			rx_frame.received = 0;
+			rx_frame.state = Mux_Rx_PAYLOAD;
+			break;
+		case Mux_Rx_PAYLOAD:
+			rx_frame.payload[rx_frame.received++] = byte;
+			if (rx_frame.received == rx_frame.size)
+			{
+				rx_frame.state = Mux_Rx_CRC;
+			}
+			break;
+		case Mux_Rx_CRC:
+			rx_frame.state = Mux_Rx_SYNC;
+			if ((byte == rx_frame.crc) && (rx_frame.channel < HM10_CLONE_MUX_CHANNELS))
+			{
+				mux_demux();
+			}
+			return;
+		default:
+			rx_frame.state = Mux_Rx_SYNC;
+			return;
+	}
+	rx_frame.crc = update_hm10clone_crc8(rx_frame.crc, byte);
+}
+
+static void mux_demux()
+{
+	/** <b>Local variable ch:</b> Logical channel of the received frame. */
+	Mux_Channel *ch = &channels[rx_frame.channel];
+	/** <b>Local variable tail:</b> Index of the RX buffer into which the next byte is stored. */
+	uint16_t tail = (ch->rx_head + ch->rx_count) % HM10_CLONE_MUX_RX_BUFFER_SIZE;
+
+	for (uint8_t i=0; i<rx_frame.size; i++)
+	{
+		if (ch->rx_count == HM10_CLONE_MUX_RX_BUFFER_SIZE)
+		{
+			ch->rx_dropped += rx_frame.size - i;
+			return;
+		}
+		ch->rx_buffer[tail] = rx_frame.payload[i];
+		tail = (tail + 1) % HM10_CLONE_MUX_RX_BUFFER_SIZE;
+		ch->rx_count++;
+	}
+}
+
+static HM10_Clone_Status mux_send_fragment()
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+	/** <b>Local variable channel:</b> Logical channel from which the fragment is sent. */
+	uint8_t channel = HM10_CLONE_MUX_CHANNELS;
+	/** <b>Local variable ch:</b> Pointer to the logical channel from which the fragment is sent. */
+	Mux_Channel *ch;
+	/** <b>Local variable size:</b> Length in bytes of the payload of the fragment. */
+	uint8_t size;
+	/** <b>Local variable first_size:</b> Length in bytes of the part of the payload that lies before the end of the TX queue. */
+	uint16_t first_size;
+	/** <b>Local variable header:</b> Sync, Channel and Length fields of the frame. */
+	uint8_t header[HM10_CLONE_MUX_HEADER_SIZE];
+	/** <b>Local variable crc:</b> CRC field of the frame. */
+	uint8_t crc = 0;
+
+	/* Pick the non-empty channel with the highest priority, starting right after the last one that sent a fragment so that the channels of the same priority take turns. */
+	for (uint8_t n=1; n<=HM10_CLONE_MUX_CHANNELS; n++)
+	{
+		uint8_t candidate = (last_tx_channel + n) % HM10_CLONE_MUX_CHANNELS;
+		if ((channels[candidate].tx_count > 0) && ((channel == HM10_CLONE_MUX_CHANNELS) || (channels[candidate].priority < channels[channel].priority)))
+		{
+			channel = candidate;
+		}
+	}
+	if (channel == HM10_CLONE_MUX_CHANNELS)
+	{
+		return HM10_Clone_EC_OK;
+	}
+	ch = &channels[channel];
+
+	size = (ch->tx_count < HM10_CLONE_MUX_FRAGMENT_PAYLOAD) ? ch->tx_count : HM10_CLONE_MUX_FRAGMENT_PAYLOAD;
+	first_size = HM10_CLONE_MUX_TX_QUEUE_SIZE - ch->tx_head;
+	if (first_size > size)
+	{
+		first_size = size;
+	}
+	header[0] = HM10_CLONE_MUX_SYNC;
+	header[1] = channel;
+	header[2] = size;
+	crc = update_hm10clone_crc8(crc, header[1]);
+	crc = update_hm10clone_crc8(crc, header[2]);
+	for (uint8_t i=0; i<size; i++)
+	{
+		crc = update_hm10clone_crc8(crc, ch->tx_queue[(ch->tx_head + i) % HM10_CLONE_MUX_TX_QUEUE_SIZE]);
+	}
+
+	/* Send the payload straight from the TX queue, whose data may wrap around its end. */
+	/** <b>Local variable segments:</b> Segments of the frame. */
+	HM10_Clone_Tx_Segment segments[] =
+	{
+		{header, HM10_CLONE_MUX_HEADER_SIZE},
+		{&ch->tx_queue[ch->tx_head], first_size},
+		{ch->tx_queue, size - first_size},
+		{&crc, 1}
+	};
+	ret = send_hm10clone_ota_data_vectored(segments, sizeof(segments) / sizeof(segments[0]), HM10_CLONE_CUSTOM_HAL_TIMEOUT);
+	if (ret != HM10_Clone_EC_OK)
+	{
+		return ret;
+	}
+	ch->tx_head = (ch->tx_head + size) % HM10_CLONE_MUX_TX_QUEUE_SIZE;
+	ch->tx_count -= size;
+	last_tx_channel = channel;
+
+	return HM10_Clone_EC_OK;
+}
+#endif
+
+/** @} */
@@ -0,0 +1,82 @@
+/** @addtogroup AT_09_os_port_cmsis_rtos2
+ * @{
+ */
+
+#include "AT-09_os_port_cmsis_rtos2.h"
+
+#if HM10_CLONE_RTOS
+#include "cmsis_os2.h" // This is the CMSIS-RTOS2 API, which is provided by the RTOS of the application.
+
+/**@brief	Converts milliseconds into kernel ticks, rounding up so that a timeout is never shortened.
+ *
+ * @param ms	Number of milliseconds, where \c HAL_MAX_DELAY stands for waiting forever.
+ *
+ * @return	The equivalent number of kernel ticks.
+ *
+ * @date	October 18, 2026.
+ */
+static uint32_t ms_to_ticks(uint32_t ms)
+{
+	/** <b>Local variable ticks:</b> Number of kernel ticks that is equivalent to the \p ms param. */
+	uint64_t ticks;
+
+	if (ms == HAL_MAX_DELAY)
+	{
+		return osWaitForever;
+	}
+	ticks = ((uint64_t) ms * osKernelGetTickFreq() + 999U) / 1000U;
+
+	return (ticks < osWaitForever) ? (uint32_t) ticks : (osWaitForever - 1U);
+}
+
+static void *mutex_create(void)
+{
+	/** <b>Local variable attr:</b> Attributes of the mutex of the @ref hm10_ble_clone . */
+	const osMutexAttr_t attr = {.name = "hm10clone", .attr_bits = osMutexRecursive | osMutexPrioInherit};
+
+	return osMutexNew(&attr);
+}
+
+static void mutex_lock(void *mutex)
+{
+	osMutexAcquire((osMutexId_t) mutex, osWaitForever);
+}
+
+static void mutex_unlock(void *mutex)
+{
+	osMutexRelease((osMutexId_t) mutex);
+}
+
+static void *semaphore_create(void)
+{
+	return osSemaphoreNew(1U, 0U, NULL);
+}
+
+static uint8_t semaphore_take(void *semaphore, uint32_t timeout)
+{
+	return osSemaphoreAcquire((osSemaphoreId_t) semaphore, ms_to_ticks(timeout)) == osOK;
+}
+
+static void semaphore_give(void *semaphore)
+{
+	osSemaphoreRelease((osSemaphoreId_t) semaphore); // This is safe to be called from an interrupt in CMSIS-RTOS2.
+}
+
+static void delay(uint32_t ms)
+{
+	osDelay(ms_to_ticks(ms));
+}
+
+const HM10_Clone_OS_Port hm10clone_cmsis_rtos2_os_port =
+{
+	.mutex_create = mutex_create,
+	.mutex_lock = mutex_lock,
+	.mutex_unlock = mutex_unlock,
+	.semaphore_create = semaphore_create,
+	.semaphore_take = semaphore_take,
+	.semaphore_give = semaphore_give,
+	.delay = delay
+};
+#endif
+
+/** @} */
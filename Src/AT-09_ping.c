@@ -0,0 +1,342 @@
+/** @addtogroup AT_09_ping
+ * @{
+ */
+
+#include "AT-09_ping.h"
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+
+#if HM10_CLONE_PING
+_Static_assert(HM10_CLONE_PING_MAX_PAYLOAD <= 255, "HM10_CLONE_PING_MAX_PAYLOAD must be of up to 255 bytes.");
+
+/**@brief	States of the reception of a ping frame, which are named after the field that is expected next.
+ */
+typedef enum
+{
+	Ping_Rx_SYNC		= 0U,	//!< Waiting for the Sync field.
+	Ping_Rx_HEADER		= 1U,	//!< Waiting for the remaining bytes of the Type, Sequence, Timestamp and Length fields.
+	Ping_Rx_PAYLOAD		= 2U,	//!< Waiting for the remaining bytes of the Payload field.
+	Ping_Rx_CRC			= 3U	//!< Waiting for the CRC field.
+} Ping_Rx_State;
+
+/**@brief	Ping frame that is being received.
+ */
+typedef struct
+{
+	Ping_Rx_State state;											//!< Field of the frame that is expected next.
+	uint8_t header[HM10_CLONE_PING_HEADER_SIZE];					//!< Sync, Type, Sequence, Timestamp and Length fields of the frame.
+	uint8_t received;												//!< Number of bytes of the current field that have been received.
+	uint8_t crc;													//!< CRC of the fields that have been received.
+	uint8_t payload[HM10_CLONE_PING_MAX_PAYLOAD];					//!< Payload field of the frame.
+} Ping_Rx_Frame;
+
+static HM10_Clone_Ping_Stats stats;											/**< @brief Round-trip latency measurements of the ping layer. */
+static Ping_Rx_Frame rx_frame;												/**< @brief Ping frame that is being received. */
+static uint16_t next_sequence;												/**< @brief Sequence number that will be given to the next probe. */
+static uint16_t awaited_sequence;											/**< @brief Sequence number of the probe that is in flight. */
+static uint8_t awaiting_echo;												/**< @brief Flag that indicates whether a probe is in flight. */
+static uint32_t echo_rtt_us;												/**< @brief Round-trip time in microseconds of the probe that concluded last. */
+static HM10_Clone_Status poll_status;										/**< @brief Status of the last transmission of an echo made while processing the received frames. */
+
+/**@brief	Sends a ping frame.
+ *
+ * @param type			Type field of the frame.
+ * @param sequence		Sequence field of the frame.
+ * @param timestamp		Timestamp field of the frame.
+ * @param[in] payload	Pointer to the Payload field of the frame.
+ * @param size			Length in bytes of the Payload field of the frame.
+ *
+ * @return	The @ref HM10_Clone_Status value of @ref send_hm10clone_ota_data_vectored .
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status ping_send_frame(uint8_t type, uint16_t sequence, uint32_t timestamp, const uint8_t *payload, uint8_t size);
+
+/**@brief	Feeds a received byte into the @ref rx_frame , which dispatches the frame whenever it is complete.
+ *
+ * @param byte	Byte that was received.
+ *
+ * @date	October 18, 2026.
+ */
+static void ping_feed(uint8_t byte);
+
+/**@brief	Dispatches the complete @ref rx_frame , which either echoes it back whenever it is a probe or concludes the
+ *          probe that is in flight whenever it is its echo.
+ *
+ * @date	October 18, 2026.
+ */
+static void ping_dispatch();
+
+/**@brief	Accounts a round-trip time into the @ref stats .
+ *
+ * @param rtt_us	Round-trip time in microseconds.
+ *
+ * @date	October 18, 2026.
+ */
+static void ping_record(uint32_t rtt_us);
+
+HM10_Clone_Status init_hm10clone_ping()
+{
+	#ifdef DWT_CTRL_CYCCNTENA_Msk
+		/* Enable the DWT Cycle Counter, which is the default clock of the probe frames. */
+		CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+		DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	#endif
+	rx_frame.state = Ping_Rx_SYNC;
+	awaiting_echo = 0;
+
+	return reset_hm10clone_ping_stats();
+}
+
+HM10_Clone_Status send_hm10clone_ping(uint8_t payload_size, uint32_t timeout, uint32_t *rtt_us)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+	/** <b>Local variable payload:</b> Padding payload of the probe. */
+	uint8_t payload[HM10_CLONE_PING_MAX_PAYLOAD];
+	/** <b>Local variable start_tick:</b> HAL Tick at which the probe was sent. */
+	uint32_t start_tick;
+
+	if (payload_size > HM10_CLONE_PING_MAX_PAYLOAD)
+	{
+		return HM10_Clone_EC_ERR;
+	}
+	for (uint8_t i=0; i<payload_size; i++)
+	{
+		payload[i] = (uint8_t) (next_sequence + i);
+	}
+
+	/* Register the probe before sending it, so that a fast echo can never be missed. */
+	awaited_sequence = next_sequence++;
+	awaiting_echo = 1;
+	start_tick = HAL_GetTick();
+	ret = ping_send_frame(HM10_CLONE_PING_TYPE_PROBE, awaited_sequence, HM10_CLONE_PING_CLOCK(), payload, payload_size);
+	if (ret != HM10_Clone_EC_OK)
+	{
+		awaiting_echo = 0;
+		return ret;
+	}
+	stats.probes_sent++;
+
+	/* Wait for the echo, while echoing back the probes of the other side. */
+	do
+	{
+		ret = poll_hm10clone_ping();
+		if (ret != HM10_Clone_EC_OK)
+		{
+			awaiting_echo = 0;
+			return ret;
+		}
+		if (!awaiting_echo)
+		{
+			if (rtt_us != NULL)
+			{
+				*rtt_us = echo_rtt_us;
+			}
+			return HM10_Clone_EC_OK;
+		}
+	}
+	while ((HAL_GetTick() - start_tick) < timeout);
+	awaiting_echo = 0;
+	stats.timeouts++;
+
+	return HM10_Clone_EC_NR;
+}
+
+HM10_Clone_Status poll_hm10clone_ping()
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	poll_status = HM10_Clone_EC_OK;
+	ret = drain_hm10clone_ota_data(ping_feed);
+	if (ret == HM10_Clone_EC_ERR)
+	{
+		return ret;
+	}
+
+	return (poll_status == HM10_Clone_EC_OK) ? HM10_Clone_EC_OK : HM10_Clone_EC_ERR;
+}
+
+HM10_Clone_Status get_hm10clone_ping_stats(HM10_Clone_Ping_Stats *snapshot)
+{
+	memcpy(snapshot, &stats, sizeof(HM10_Clone_Ping_Stats));
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status reset_hm10clone_ping_stats()
+{
+	memset(&stats, 0, sizeof(HM10_Clone_Ping_Stats));
+	stats.rtt_min_us = UINT32_MAX;
+
+	return HM10_Clone_EC_OK;
+}
+
+uint32_t get_hm10clone_ping_percentile(const HM10_Clone_Ping_Stats *snapshot, uint8_t percentile)
+{
+	if ((percentile == 0) || (percentile > 100) || (snapshot->echoes_received == 0))
+	{
+		return 0;
+	}
+
+	/** <b>Local variable echoes_needed:</b> Number of echoes, rounded up, that must be covered by the histogram buckets to reach the requested percentile. */
+	uint32_t echoes_needed = (uint32_t) ((((uint64_t) snapshot->echoes_received) * percentile + 99) / 100);
+	/** <b>Local variable echoes_covered:</b> Accumulated number of echoes counted by the histogram buckets that have been visited. */
+	uint32_t echoes_covered = 0;
+	/** <b>Local variable bucket:</b> Index of the histogram bucket that contains the requested percentile. */
+	uint8_t bucket = 0;
+	while ((bucket < (HM10_CLONE_PING_HISTOGRAM_BUCKETS - 1)) && ((echoes_covered += snapshot->rtt_histogram[bucket]) < echoes_needed))
+	{
+		bucket++;
+	}
+
+	/* The last bucket counts every round-trip time above its lower limit, so only the longest one measured bounds it.
+	 * Otherwise, no round-trip time can be longer than the longest one measured either. */
+	if ((bucket == (HM10_CLONE_PING_HISTOGRAM_BUCKETS - 1)) || (bucket >= 31)
+		|| ((((uint32_t) 1) << (bucket + 1)) > snapshot->rtt_max_us))
+	{
+		return snapshot->rtt_max_us;
+	}
+
+	return ((uint32_t) 1) << (bucket + 1);
+}
+
+static HM10_Clone_Status ping_send_frame(uint8_t type, uint16_t sequence, uint32_t timestamp, const uint8_t *payload, uint8_t size)
+{
+	/** <b>Local variable header:</b> Sync, Type, Sequence, Timestamp and Length fields of the frame. */
+	uint8_t header[HM10_CLONE_PING_HEADER_SIZE] =
+	{
+		HM10_CLONE_PING_SYNC, type,
+		(uint8_t) sequence, (uint8_t) (sequence >> 8),
+		(uint8_t) timestamp, (uint8_t) (timestamp >> 8), (uint8_t) (timestamp >> 16), (uint8_t) (timestamp >> 24),
+		size
+	};
+	/** <b>Local variable crc:</b> CRC field of the frame. */
+	uint8_t crc = 0;
+
+	for (uint8_t i=1; i<HM10_CLONE_PING_HEADER_SIZE; i++)
+	{
+		crc = update_hm10clone_crc8(crc, header[i]);
+	}
+	for (uint8_t i=0; i<size; i++)
+	{
+		crc = update_hm10clone_crc8(crc, payload[i]);
+	}
+
+	/* Send the fields of the frame straight from where they are, without assembling them into a buffer first. */
+	/** <b>Local variable segments:</b> Segments of the frame. */
+	HM10_Clone_Tx_Segment segments[] =
+	{
+		{header, HM10_CLONE_PING_HEADER_SIZE},
+		{payload, size},
+		{&crc, 1}
+	};
+
+	return send_hm10clone_ota_data_vectored(segments, sizeof(segments) / sizeof(segments[0]), HM10_CLONE_CUSTOM_HAL_TIMEOUT);
+}
+
+static void ping_feed(uint8_t byte)
+{
+	switch (rx_frame.state)
+	{
+		case Ping_Rx_SYNC:
+			if (byte == HM10_CLONE_PING_SYNC)
+			{
+				rx_frame.header[0] = byte;
+				rx_frame.received = 1;
+				rx_frame.crc = 0;
+				rx_frame.state = Ping_Rx_HEADER;
+			}
+			return;
+		case Ping_Rx_HEADER:
+			rx_frame.header[rx_frame.received++] = byte;
+			if (rx_frame.received == HM10_CLONE_PING_HEADER_SIZE)
+			{
+				if (((rx_frame.header[1] != HM10_CLONE_PING_TYPE_PROBE) && (rx_frame.header[1] != HM10_CLONE_PING_TYPE_ECHO)) || (byte > HM10_CLONE_PING_MAX_PAYLOAD))
+				{
+					rx_frame.state = Ping_Rx_SYNC; // Resynchronise, since this cannot be a valid frame.
+					return;
+				}
+				rx_frame.received = 0;
+				rx_frame.state = (byte > 0) ? Ping_Rx_PAYLOAD : Ping_Rx_CRC;
+			}
+			break;
+		case Ping_Rx_PAYLOAD:
+			rx_frame.payload[rx_frame.received++] = byte;
+			if (rx_frame.received == rx_frame.header[HM10_CLONE_PING_HEADER_SIZE - 1])
+			{
+				rx_frame.state = Ping_Rx_CRC;
+			}
+			break;
+		case Ping_Rx_CRC:
+			rx_frame.state = Ping_Rx_SYNC;
+			if (byte == rx_frame.crc)
+			{
+				ping_dispatch();
+			}
+			return;
+		default:
+			rx_frame.state = Ping_Rx_SYNC;
+			return;
+	}
+	rx_frame.crc = update_hm10clone_crc8(rx_frame.crc, byte);
+}
+
+static void ping_dispatch()
+{
+	/** <b>Local variable sequence:</b> Sequence field of the frame. */
+	uint16_t sequence = (uint16_t) (rx_frame.header[2] | (rx_frame.header[3] << 8));
+	/** <b>Local variable timestamp:</b> Timestamp field of the frame. */
+	uint32_t timestamp = ((uint32_t) rx_frame.header[4]) | ((uint32_t) rx_frame.header[5] << 8) | ((uint32_t) rx_frame.header[6] << 16) | ((uint32_t) rx_frame.header[7] << 24);
+
+	if (rx_frame.header[1] == HM10_CLONE_PING_TYPE_PROBE)
+	{
+		/* Echo the probe back untouched, so that the other side measures its round-trip time with its own clock. */
+		if (ping_send_frame(HM10_CLONE_PING_TYPE_ECHO, sequence, timestamp, rx_frame.payload, rx_frame.header[HM10_CLONE_PING_HEADER_SIZE - 1]) == HM10_Clone_EC_OK)
+		{
+			stats.probes_echoed++;
+		}
+		else
+		{
+			poll_status = HM10_Clone_EC_ERR;
+		}
+		return;
+	}
+
+	/* Conclude the probe of the echo, which is ignored whenever that probe has already timed out. */
+	if (!awaiting_echo || (sequence != awaited_sequence))
+	{
+		stats.late_echoes++;
+		return;
+	}
+	awaiting_echo = 0;
+	echo_rtt_us = (uint32_t) (((uint64_t) (uint32_t) (HM10_CLONE_PING_CLOCK() - timestamp)) * 1000000U / HM10_CLONE_PING_CLOCK_HZ);
+	ping_record(echo_rtt_us);
+}
+
+static void ping_record(uint32_t rtt_us)
+{
+	stats.echoes_received++;
+	stats.rtt_sum_us += rtt_us;
+	if (rtt_us < stats.rtt_min_us)
+	{
+		stats.rtt_min_us = rtt_us;
+	}
+	if (rtt_us > stats.rtt_max_us)
+	{
+		stats.rtt_max_us = rtt_us;
+	}
+
+	/* Place the round-trip time into its corresponding power of two bucket of microseconds. */
+	/** <b>Local variable bucket:</b> Index of the histogram bucket into which the round-trip time falls. */
+	uint8_t bucket = 0;
+	while ((rtt_us > 1) && (bucket < (HM10_CLONE_PING_HISTOGRAM_BUCKETS - 1)))
+	{
+		rtt_us >>= 1;
+		bucket++;
+	}
+	stats.rtt_histogram[bucket]++;
+}
+#endif
+
+/** @} */
@@ -0,0 +1,307 @@
+/** @addtogroup AT_09_rpc
+ * @{
+ */
+
+#include "AT-09_rpc.h"
+#include <string.h>	// Library from which "memset()" is located at.
+
+#if HM10_CLONE_RPC
+_Static_assert(HM10_CLONE_RPC_MAX_PAYLOAD <= 255, "HM10_CLONE_RPC_MAX_PAYLOAD must be of up to 255 bytes.");
+
+/**@brief	States of the reception of an RPC frame, which are named after the field that is expected next.
+ */
+typedef enum
+{
+	Rpc_Rx_SYNC		= 0U,	//!< Waiting for the Sync field.
+	Rpc_Rx_ID		= 1U,	//!< Waiting for the ID field.
+	Rpc_Rx_FLAGS	= 2U,	//!< Waiting for the Flags field.
+	Rpc_Rx_LENGTH	= 3U,	//!< Waiting for the Length field.
+	Rpc_Rx_PAYLOAD	= 4U,	//!< Waiting for the remaining bytes of the Payload field.
+	Rpc_Rx_CRC		= 5U	//!< Waiting for the CRC field.
+} Rpc_Rx_State;
+
+/**@brief	RPC frame that is being received.
+ */
+typedef struct
+{
+	Rpc_Rx_State state;							//!< Field of the frame that is expected next.
+	uint8_t id;									//!< ID field of the frame.
+	uint8_t flags;								//!< Flags field of the frame.
+	uint8_t size;								//!< Length field of the frame.
+	uint8_t received;							//!< Number of bytes of the Payload field that have been received.
+	uint8_t crc;								//!< CRC of the fields that have been received.
+	uint8_t payload[HM10_CLONE_RPC_MAX_PAYLOAD];	//!< Payload field of the frame.
+} Rpc_Rx_Frame;
+
+/**@brief	RPC request that is in flight.
+ */
+typedef struct
+{
+	uint8_t in_use;						//!< Flag that indicates whether this entry holds a request that is in flight.
+	uint8_t id;							//!< Request ID of the request.
+	uint32_t start_tick;				//!< HAL Tick at which the request was sent.
+	uint32_t timeout;					//!< Time in milliseconds to wait for the response.
+	HM10_Clone_Rpc_Callback callback;	//!< Function that is called whenever the request concludes.
+	void *context;						//!< Pointer that is given to the \c callback field.
+} Rpc_Pending;
+
+static Rpc_Pending pending[HM10_CLONE_RPC_MAX_PENDING];						/**< @brief Table of the RPC requests that are in flight. */
+static Rpc_Rx_Frame rx_frame;												/**< @brief RPC frame that is being received. */
+static HM10_Clone_Rpc_Handler request_handler;								/**< @brief Function that is called for each received RPC request. */
+static uint8_t next_id;														/**< @brief Request ID that will be tried first for the next RPC request. */
+
+/**@brief	Sends an RPC frame.
+ *
+ * @param id			ID field of the frame.
+ * @param flags			Flags field of the frame.
+ * @param[in] payload	Pointer to the Payload field of the frame.
+ * @param size			Length in bytes of the Payload field of the frame.
+ *
+ * @return	The @ref HM10_Clone_Status value of @ref send_hm10clone_ota_data_vectored .
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status rpc_send_frame(uint8_t id, uint8_t flags, const uint8_t *payload, uint8_t size);
+
+/**@brief	Feeds a received byte into the @ref rx_frame , which dispatches the frame whenever it is complete.
+ *
+ * @param byte	Byte that was received.
+ *
+ * @date	October 18, 2026.
+ */
+static void rpc_feed(uint8_t byte);
+
+/**@brief	Dispatches the complete @ref rx_frame either to the callback of its request or to the @ref request_handler .
+ *
+ * @date	October 18, 2026.
+ */
+static void rpc_dispatch();
+
+HM10_Clone_Status init_hm10clone_rpc(HM10_Clone_Rpc_Handler handler)
+{
+	memset(pending, 0, sizeof(pending));
+	rx_frame.state = Rpc_Rx_SYNC;
+	request_handler = handler;
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status send_hm10clone_rpc_request(const uint8_t *payload, uint8_t size, uint32_t timeout, HM10_Clone_Rpc_Callback callback, void *context, uint8_t *request_id)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+	/** <b>Local variable entry:</b> Entry of the @ref pending table that is given to the request. */
+	Rpc_Pending *entry = NULL;
+
+	if (size > HM10_CLONE_RPC_MAX_PAYLOAD)
+	{
+		return HM10_Clone_EC_ERR;
+	}
+	for (uint8_t i=0; i<HM10_CLONE_RPC_MAX_PENDING; i++)
+	{
+		if (!pending[i].in_use)
+		{
+			entry = &pending[i];
+			break;
+		}
+	}
+	if (entry == NULL)
+	{
+		return HM10_Clone_EC_BUSY;
+	}
+
+	/* Give the request an ID that is not being used by any other request that is in flight. */
+	for (uint8_t in_use=1; in_use; next_id++)
+	{
+		in_use = 0;
+		for (uint8_t i=0; i<HM10_CLONE_RPC_MAX_PENDING; i++)
+		{
+			if (pending[i].in_use && (pending[i].id == next_id))
+			{
+				in_use = 1;
+				break;
+			}
+		}
+		entry->id = next_id;
+	}
+
+	/* Register the request before sending it, so that a fast response can never be missed. */
+	entry->start_tick = HAL_GetTick();
+	entry->timeout = timeout;
+	entry->callback = callback;
+	entry->context = context;
+	entry->in_use = 1;
+	ret = rpc_send_frame(entry->id, 0, payload, size);
+	if (ret != HM10_Clone_EC_OK)
+	{
+		entry->in_use = 0;
+		return ret;
+	}
+	if (request_id != NULL)
+	{
+		*request_id = entry->id;
+	}
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status send_hm10clone_rpc_response(uint8_t request_id, const uint8_t *payload, uint8_t size)
+{
+	if (size > HM10_CLONE_RPC_MAX_PAYLOAD)
+	{
+		return HM10_Clone_EC_ERR;
+	}
+
+	return rpc_send_frame(request_id, HM10_CLONE_RPC_FLAG_RESPONSE, payload, size);
+}
+
+HM10_Clone_Status poll_hm10clone_rpc()
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+	/** <b>Local variable now:</b> Current HAL Tick. */
+	uint32_t now;
+
+	/* Process the received bytes before the timeouts, so that a response that arrived in time is not expired. */
+	ret = drain_hm10clone_ota_data(rpc_feed);
+	if (ret == HM10_Clone_EC_ERR)
+	{
+		return ret;
+	}
+
+	/* Conclude the requests whose response did not arrive in time. */
+	now = HAL_GetTick();
+	for (uint8_t i=0; i<HM10_CLONE_RPC_MAX_PENDING; i++)
+	{
+		if (pending[i].in_use && ((now - pending[i].start_tick) >= pending[i].timeout))
+		{
+			pending[i].in_use = 0;
+			if (pending[i].callback != NULL)
+			{
+				pending[i].callback(pending[i].id, HM10_Clone_EC_NR, NULL, 0, now - pending[i].start_tick, pending[i].context);
+			}
+		}
+	}
+
+	return HM10_Clone_EC_OK;
+}
+
+uint8_t get_hm10clone_rpc_pending_count()
+{
+	/** <b>Local variable count:</b> Number of requests that are in flight. */
+	uint8_t count = 0;
+
+	for (uint8_t i=0; i<HM10_CLONE_RPC_MAX_PENDING; i++)
+	{
+		count += pending[i].in_use;
+	}
+
+	return count;
+}
+
+static HM10_Clone_Status rpc_send_frame(uint8_t id, uint8_t flags, const uint8_t *payload, uint8_t size)
+{
+	/** <b>Local variable header:</b> Sync, ID, Flags and Length fields of the frame. */
+	uint8_t header[HM10_CLONE_RPC_HEADER_SIZE] = {HM10_CLONE_RPC_SYNC, id, flags, size};
+	/** <b>Local variable crc:</b> CRC field of the frame. */
+	uint8_t crc = 0;
+
+	for (uint8_t i=1; i<HM10_CLONE_RPC_HEADER_SIZE; i++)
+	{
+		crc = update_hm10clone_crc8(crc, header[i]);
+	}
+	for (uint8_t i=0; i<size; i++)
+	{
+		crc = update_hm10clone_crc8(crc, payload[i]);
+	}
+
+	/* Send the fields of the frame straight from where they are, without assembling them into a buffer first. */
+	/** <b>Local variable segments:</b> Segments of the frame. */
+	HM10_Clone_Tx_Segment segments[] =
+	{
+		{header, HM10_CLONE_RPC_HEADER_SIZE},
+		{payload, size},
+		{&crc, 1}
+	};
+
+	return send_hm10clone_ota_data_vectored(segments, sizeof(segments) / sizeof(segments[0]), HM10_CLONE_CUSTOM_HAL_TIMEOUT);
+}
+
+static void rpc_feed(uint8_t byte)
+{
+	switch (rx_frame.state)
+	{
+		case Rpc_Rx_SYNC:
+			if (byte == HM10_CLONE_RPC_SYNC)
+			{
+				rx_frame.crc = 0;
+				rx_frame.state = Rpc_Rx_ID;
+			}
+			return;
+		case Rpc_Rx_ID:
+			rx_frame.id = byte;
+			rx_frame.state = Rpc_Rx_FLAGS;
+			break;
+		case Rpc_Rx_FLAGS:
+			rx_frame.flags = byte;
+			rx_frame.state = Rpc_Rx_LENGTH;
+			break;
+		case Rpc_Rx_LENGTH:
+			if (byte > HM10_CLONE_RPC_MAX_PAYLOAD)
+			{
+				rx_frame.state = Rpc_Rx_SYNC; // Resynchronise, since this cannot be a valid frame.
+				return;
+			}
+			rx_frame.size = byte;
+			rx_frame.received = 0;
+			rx_frame.state = (byte > 0) ? Rpc_Rx_PAYLOAD : Rpc_Rx_CRC;
+			break;
+		case Rpc_Rx_PAYLOAD:
+			rx_frame.payload[rx_frame.received++] = byte;
+			if (rx_frame.received == rx_frame.size)
+			{
+				rx_frame.state = Rpc_Rx_CRC;
+			}
+			break;
+		case Rpc_Rx_CRC:
+			rx_frame.state = Rpc_Rx_SYNC;
+			if (byte == rx_frame.crc)
+			{
+				rpc_dispatch();
+			}
+			return;
+		default:
+			rx_frame.state = Rpc_Rx_SYNC;
+			return;
+	}
+	rx_frame.crc = update_hm10clone_crc8(rx_frame.crc, byte);
+}
+
+static void rpc_dispatch()
+{
+	if (!(rx_frame.flags & HM10_CLONE_RPC_FLAG_RESPONSE))
+	{
+		if (request_handler != NULL)
+		{
+			request_handler(rx_frame.id, rx_frame.payload, rx_frame.size);
+		}
+		return;
+	}
+
+	/* Conclude the request of the response, which is ignored whenever that request has already timed out. */
+	for (uint8_t i=0; i<HM10_CLONE_RPC_MAX_PENDING; i++)
+	{
+		if (pending[i].in_use && (pending[i].id == rx_frame.id))
+		{
+			pending[i].in_use = 0;
+			if (pending[i].callback != NULL)
+			{
+				pending[i].callback(pending[i].id, HM10_Clone_EC_OK, rx_frame.payload, rx_frame.size, HAL_GetTick() - pending[i].start_tick, pending[i].context);
+			}
+			return;
+		}
+	}
+}
+#endif
+
+/** @} */
@@ -3,9 +3,28 @@
  */
 
 #include "AT-09_zs040_ble_driver.h"
-#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
-
-#define HM10_CLONE_MAX_AT_COMMAND_SIZE							(21)		/**< @brief Total maximum bytes in a Tx/Rx AT Command of the HM-10 Clone BLE Device. */
+#include <string.h>	// Library from which "memset()", "memcpy()" and "memcmp()" are located at.
+
+#define HM10_CLONE_TRACE_ENABLED								(HM10_CLONE_LOG_ENABLED && (HM10_CLONE_VERBOSE_BACKEND == HM10_CLONE_VERBOSE_BACKEND_TRACE))	/**< @brief Flag that indicates whether the messages of this @ref hm10_ble_clone are recorded into the binary trace ring buffer. */
+#define HM10_CLONE_TRACE_ARGS(unused, a0, a1, a2, a3, ...)		(a0), (a1), (a2), (a3)	/**< @brief Gives the first four arguments given after the \p unused param, which is used to pad with zeros the arguments of a @ref HM10_CLONE_LOG call. */
+#if HM10_CLONE_TRACE_ENABLED
+#define HM10_CLONE_LOG(event, ...)								do { if (event##_ENABLED) { trace_record((event), HM10_CLONE_TRACE_ARGS(_, ##__VA_ARGS__, 0, 0, 0, 0)); } } while (0)	/**< @brief Records a message of this @ref hm10_ble_clone into the binary trace ring buffer, if its log level is enabled. */
+#elif HM10_CLONE_LOG_ENABLED
+#define HM10_CLONE_LOG(event, ...)								do { if (event##_ENABLED) { printf(trace_formats[(event)], ##__VA_ARGS__); } } while (0)					/**< @brief Displays a message of this @ref hm10_ble_clone via @ref printf , if its log level is enabled. */
+#else
+#define HM10_CLONE_LOG(event, ...)								do { } while (0)																							/**< @brief Messages of this @ref hm10_ble_clone are disabled. */
+#endif
+
+#define HM10_CLONE_ADAPTIVE_TIMEOUT_MAX_BACKOFF					(3)			/**< @brief Maximum number of times that the adaptive timeout of an AT Command is doubled after consecutive timeouts. */
+#define HM10_CLONE_NO_DEADLINE_US								(UINT32_MAX)	/**< @brief Timeout in microseconds with which @ref transaction_enter leaves the timer of a transaction idle, so that the deadline of its state is given by the HAL Tick instead (see @ref timer_us_from_ms ). */
+#define HM10_CLONE_SIZE_MAX(a, b)								(((a) > (b)) ? (a) : (b))	/**< @brief Greater of two lengths in bytes, which can be used in constant expressions. */
+#define HM10_CLONE_BASE_AT_COMMAND_SIZE							HM10_CLONE_SIZE_MAX(HM10_CLONE_SIZE_MAX(HM10_CLONE_TEST_CMD_SIZE, HM10_CLONE_RESET_CMD_SIZE), HM10_CLONE_OK_RESPONSE_SIZE)	/**< @brief Total maximum bytes in a Tx/Rx of the Test and Reset Commands, which are always compiled in. */
+#define HM10_CLONE_NAME_AT_COMMAND_SIZE							(HM10_CLONE_NAME_CMDS ? (HM10_CLONE_GET_NAME_CMD_SIZE + HM10_CLONE_MAX_BLE_NAME_SIZE) : 0)	/**< @brief Total maximum bytes in a Tx/Rx of the Name Commands, which is given by a Name Command with the longest name. */
+#define HM10_CLONE_ROLE_AT_COMMAND_SIZE							(HM10_CLONE_ROLE_CMDS ? HM10_CLONE_SIZE_MAX(HM10_CLONE_SET_ROLE_CMD_SIZE, HM10_CLONE_ROLE_RESPONSE_SIZE) : 0)	/**< @brief Total maximum bytes in a Tx/Rx of the Role Commands. */
+#define HM10_CLONE_PIN_AT_COMMAND_SIZE							(HM10_CLONE_PIN_CMDS ? HM10_CLONE_SIZE_MAX(HM10_CLONE_SET_PIN_CMD_SIZE, HM10_CLONE_PIN_RESPONSE_SIZE) : 0)	/**< @brief Total maximum bytes in a Tx/Rx of the Pin Commands. */
+#define HM10_CLONE_TYPE_AT_COMMAND_SIZE							(HM10_CLONE_TYPE_CMDS ? HM10_CLONE_SIZE_MAX(HM10_CLONE_SET_TYPE_CMD_SIZE, HM10_CLONE_TYPE_RESPONSE_SIZE) : 0)	/**< @brief Total maximum bytes in a Tx/Rx of the Type Commands. */
+#define HM10_CLONE_CENTRAL_AT_COMMAND_SIZE						(HM10_CLONE_CENTRAL_API ? (HM10_CLONE_SIZE_MAX(sizeof(HM10_CLONE_SCAN_CMD), HM10_CLONE_SIZE_MAX(sizeof(HM10_CLONE_AUTO_RECONNECT_ON_CMD), sizeof(HM10_CLONE_AUTO_RECONNECT_OFF_CMD))) - 1 + 2) : 0)	/**< @brief Total maximum bytes in a Tx of the Scan and Auto-Reconnect Commands, whose Responses are received with the incremental parser instead. */
+#define HM10_CLONE_MAX_AT_COMMAND_SIZE							HM10_CLONE_SIZE_MAX(HM10_CLONE_SIZE_MAX(HM10_CLONE_SIZE_MAX(HM10_CLONE_BASE_AT_COMMAND_SIZE, HM10_CLONE_NAME_AT_COMMAND_SIZE), HM10_CLONE_SIZE_MAX(HM10_CLONE_ROLE_AT_COMMAND_SIZE, HM10_CLONE_PIN_AT_COMMAND_SIZE)), HM10_CLONE_SIZE_MAX(HM10_CLONE_TYPE_AT_COMMAND_SIZE, HM10_CLONE_CENTRAL_AT_COMMAND_SIZE))	/**< @brief Total maximum bytes in a Tx/Rx AT Command of the HM-10 Clone BLE Device, which is given by the AT Commands that are compiled in and which is the length of the @ref TxRx_Buffer . */
 #define HM10_CLONE_MAX_PACKET_SIZE								(18)		/**< @brief Total maximum bytes in a Tx/Rx packet/Payload to/from the HM-10 Clone BLE Device. @note Due to the lack of documentation for the HM-10 CTFZ54812 ZS-040 Clone BLE Device, several empirical tests were conducted, from which it was concluded that although the device had no restrictions on the maximum amount of data that is desired to be transmitted from the HM-10 Clone device to an external BLE Device, this is not the case for receiving data. It was concluded that the HM-10 Clone BLE device could only receive a maximum of 18 ASCII characters from a single request, which means that if more data is to be received, this would have to be broke into several parts with a maximum size of 18 bytes each. @note Since the restriction of receiving data is of 18 bytes per request, to manage things homogeneously, both the transmit and receive requests will be managed with the same size of 18 bytes. */
 #define HM10_CLONE_TEST_CMD_SIZE								(4)			/**< @brief	Length in bytes of a Test Command in the HM-10 Clone BLE device. */
 #define HM10_CLONE_RESET_CMD_SIZE								(10)		/**< @brief	Length in bytes of a Reset Command in the HM-10 Clone BLE device. */
@@ -24,13 +43,192 @@
 
 static UART_HandleTypeDef *p_huart;												                /**< @brief Pointer to the UART Handle Structure of the UART that will be used in this @ref hm10_ble_clone to communicate with the HM-10 Clone BLE device. @details This pointer's value is defined in the @ref init_hm10_clone_module function. */
 static uint8_t TxRx_Buffer[HM10_CLONE_MAX_AT_COMMAND_SIZE];					                    /**< @brief Global buffer that will be used by our MCU/MPU to hold the whole data of a received response or a request to be send from/to the HM-10 Clone BLE Device. */
-static uint8_t HM10_Clone_Name_resp[] = {'+', 'N', 'A', 'M', 'E', '='};	/**< @brief Pointer to the equivalent data of a BLE Name Response that the HM-10 Clone BLE device sends back to our MCU/MPU whenever a Get Name or Set Name request to the HM-10 Clone BLE device was processed successfully. */
-static uint8_t HM10_Clone_Role_resp[] = {'+', 'R', 'O', 'L', 'E', '='};	/**< @brief Pointer to the equivalent data of a BLE Role Response that the HM-10 Clone BLE device sends back to our MCU/MPU whenever a Get Role or Set Role request to the HM-10 Clone BLE device was processed successfully. */
-static uint8_t HM10_Clone_Pin_resp[] = {'+', 'P', 'I', 'N', '='};			/**< @brief Pointer to the equivalent data of a BLE Pin Response that the HM-10 Clone BLE device sends back to our MCU/MPU whenever a Get Pin or Set Pin request to the HM-10 Clone BLE device was processed successfully. */
-static uint8_t HM10_Clone_Type_resp[] = {'+', 'T', 'Y', 'P', 'E', '='};	/**< @brief Pointer to the equivalent data of a BLE Type Response that the HM-10 Clone BLE device sends back to our MCU/MPU whenever a Get Type or Set Type request to the HM-10 Clone BLE device was processed successfully. */
-static uint8_t HM10_Clone_OK_resp[] = {'O', 'K', '\r', '\n'};				    /**< @brief Pointer to the equivalent data of an OK Response that the HM-10 Clone BLE device sends back to our MCU/MPU whenever a request to set a new setting on the HM-10 Clone BLE device was processed successfully. */
-static uint8_t resp_attempts;												                    /**< @brief Counter for the number of attempts for receiving an expected Response from the HM-10 Clone BLE device after having send to it a certain command. */
+static const uint8_t HM10_Clone_Test_cmd[] = {'A', 'T'};									/**< @brief ASCII Code data of the Test Command that our MCU/MPU sends to the HM-10 Clone BLE device, without its Carriage Return and New Line characters. */
+static const uint8_t HM10_Clone_Reset_cmd[] = {'A', 'T', '+', 'R', 'E', 'S', 'E', 'T'};	/**< @brief ASCII Code data of the Reset Command that our MCU/MPU sends to the HM-10 Clone BLE device, without its Carriage Return and New Line characters. */
+static const uint8_t HM10_Clone_CR_LF[] = {'\r', '\n'};									/**< @brief ASCII Code data of the Carriage Return and New Line characters with which every AT Command and every Response ends. */
+static const uint8_t HM10_Clone_OK_resp[] = {'O', 'K', '\r', '\n'};				    /**< @brief Pointer to the equivalent data of an OK Response that the HM-10 Clone BLE device sends back to our MCU/MPU whenever a request to set a new setting on the HM-10 Clone BLE device was processed successfully. */
+_Static_assert(sizeof(HM10_Clone_Test_cmd) + sizeof(HM10_Clone_CR_LF) == HM10_CLONE_TEST_CMD_SIZE, "HM10_Clone_Test_cmd does not match HM10_CLONE_TEST_CMD_SIZE.");
+_Static_assert(sizeof(HM10_Clone_Reset_cmd) + sizeof(HM10_Clone_CR_LF) == HM10_CLONE_RESET_CMD_SIZE, "HM10_Clone_Reset_cmd does not match HM10_CLONE_RESET_CMD_SIZE.");
+_Static_assert(sizeof(HM10_Clone_OK_resp) == HM10_CLONE_OK_RESPONSE_SIZE, "HM10_Clone_OK_resp does not match HM10_CLONE_OK_RESPONSE_SIZE.");
+#if HM10_CLONE_NAME_CMDS
+static const uint8_t HM10_Clone_Name_cmd[] = {'A', 'T', '+', 'N', 'A', 'M', 'E'};		/**< @brief ASCII Code data of the Name Command that goes before the requested name, which is also the whole Get Name Command without its Carriage Return and New Line characters. */
+static const uint8_t HM10_Clone_Name_resp[] = {'+', 'N', 'A', 'M', 'E', '='};	/**< @brief Pointer to the equivalent data of a BLE Name Response that the HM-10 Clone BLE device sends back to our MCU/MPU whenever a Get Name or Set Name request to the HM-10 Clone BLE device was processed successfully. */
+_Static_assert(sizeof(HM10_Clone_Name_cmd) + sizeof(HM10_Clone_CR_LF) == HM10_CLONE_GET_NAME_CMD_SIZE, "HM10_Clone_Name_cmd does not match HM10_CLONE_GET_NAME_CMD_SIZE.");
+_Static_assert(sizeof(HM10_Clone_Name_cmd) + HM10_CLONE_MAX_BLE_NAME_SIZE + sizeof(HM10_Clone_CR_LF) <= HM10_CLONE_MAX_AT_COMMAND_SIZE, "The longest Name Command does not fit in HM10_CLONE_MAX_AT_COMMAND_SIZE.");
+_Static_assert(sizeof(HM10_Clone_Name_resp) + sizeof(HM10_Clone_CR_LF) == HM10_CLONE_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME, "HM10_Clone_Name_resp does not match HM10_CLONE_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME.");
+#endif
+#if HM10_CLONE_ROLE_CMDS
+static const uint8_t HM10_Clone_Role_cmd[] = {'A', 'T', '+', 'R', 'O', 'L', 'E'};		/**< @brief ASCII Code data of the Role Command that goes before the requested role, which is also the whole Get Role Command without its Carriage Return and New Line characters. */
+static const uint8_t HM10_Clone_Role_resp[] = {'+', 'R', 'O', 'L', 'E', '='};	/**< @brief Pointer to the equivalent data of a BLE Role Response that the HM-10 Clone BLE device sends back to our MCU/MPU whenever a Get Role or Set Role request to the HM-10 Clone BLE device was processed successfully. */
+_Static_assert(sizeof(HM10_Clone_Role_cmd) + sizeof(HM10_Clone_CR_LF) == HM10_CLONE_GET_ROLE_CMD_SIZE, "HM10_Clone_Role_cmd does not match HM10_CLONE_GET_ROLE_CMD_SIZE.");
+_Static_assert(sizeof(HM10_Clone_Role_cmd) + 1 + sizeof(HM10_Clone_CR_LF) == HM10_CLONE_SET_ROLE_CMD_SIZE, "HM10_Clone_Role_cmd does not match HM10_CLONE_SET_ROLE_CMD_SIZE.");
+_Static_assert(sizeof(HM10_Clone_Role_resp) + 1 + sizeof(HM10_Clone_CR_LF) == HM10_CLONE_ROLE_RESPONSE_SIZE, "HM10_Clone_Role_resp does not match HM10_CLONE_ROLE_RESPONSE_SIZE.");
+#endif
+#if HM10_CLONE_PIN_CMDS
+static const uint8_t HM10_Clone_Pin_cmd[] = {'A', 'T', '+', 'P', 'I', 'N'};				/**< @brief ASCII Code data of the Pin Command that goes before the requested pin, which is also the whole Get Pin Command without its Carriage Return and New Line characters. */
+static const uint8_t HM10_Clone_Pin_resp[] = {'+', 'P', 'I', 'N', '='};			/**< @brief Pointer to the equivalent data of a BLE Pin Response that the HM-10 Clone BLE device sends back to our MCU/MPU whenever a Get Pin or Set Pin request to the HM-10 Clone BLE device was processed successfully. */
+_Static_assert(sizeof(HM10_Clone_Pin_cmd) + sizeof(HM10_Clone_CR_LF) == HM10_CLONE_GET_PIN_CMD_SIZE, "HM10_Clone_Pin_cmd does not match HM10_CLONE_GET_PIN_CMD_SIZE.");
+_Static_assert(sizeof(HM10_Clone_Pin_cmd) + HM10_CLONE_PIN_VALUE_SIZE + sizeof(HM10_Clone_CR_LF) == HM10_CLONE_SET_PIN_CMD_SIZE, "HM10_Clone_Pin_cmd does not match HM10_CLONE_SET_PIN_CMD_SIZE.");
+_Static_assert(sizeof(HM10_Clone_Pin_resp) + HM10_CLONE_PIN_VALUE_SIZE + sizeof(HM10_Clone_CR_LF) == HM10_CLONE_PIN_RESPONSE_SIZE, "HM10_Clone_Pin_resp does not match HM10_CLONE_PIN_RESPONSE_SIZE.");
+#endif
+#if HM10_CLONE_TYPE_CMDS
+static const uint8_t HM10_Clone_Type_cmd[] = {'A', 'T', '+', 'T', 'Y', 'P', 'E'};		/**< @brief ASCII Code data of the Type Command that goes before the requested pin code mode, which is also the whole Get Type Command without its Carriage Return and New Line characters. */
+static const uint8_t HM10_Clone_Type_resp[] = {'+', 'T', 'Y', 'P', 'E', '='};	/**< @brief Pointer to the equivalent data of a BLE Type Response that the HM-10 Clone BLE device sends back to our MCU/MPU whenever a Get Type or Set Type request to the HM-10 Clone BLE device was processed successfully. */
+_Static_assert(sizeof(HM10_Clone_Type_cmd) + sizeof(HM10_Clone_CR_LF) == HM10_CLONE_GET_TYPE_CMD_SIZE, "HM10_Clone_Type_cmd does not match HM10_CLONE_GET_TYPE_CMD_SIZE.");
+_Static_assert(sizeof(HM10_Clone_Type_cmd) + 1 + sizeof(HM10_Clone_CR_LF) == HM10_CLONE_SET_TYPE_CMD_SIZE, "HM10_Clone_Type_cmd does not match HM10_CLONE_SET_TYPE_CMD_SIZE.");
+_Static_assert(sizeof(HM10_Clone_Type_resp) + 1 + sizeof(HM10_Clone_CR_LF) == HM10_CLONE_TYPE_RESPONSE_SIZE, "HM10_Clone_Type_resp does not match HM10_CLONE_TYPE_RESPONSE_SIZE.");
+#endif
+static uint8_t resp_attempts;												                    /**< @brief Counter for the number of attempts of the current call that have failed and that were retried (see @ref HM10_Clone_Retry_Policy ). */
+static uint8_t cmd_in_progress;												                    /**< @brief Flag that indicates whether a call to a public AT Command function has been begun by @ref cmd_begin and has not been concluded by @ref cmd_end yet, which is what owns the state of the current call (e.g., @ref current_cmd ). */
+static uint8_t retry_requested;												                    /**< @brief Flag that indicates whether the last attempt of the current call has failed and has requested to be retried (see @ref cmd_retry ). */
+static HM10_Clone_Retry_Policy retry_policy =
+{
+	.max_attempts = HM10_CLONE_RETRY_MAX_ATTEMPTS,
+	.backoff_ms = {HM10_CLONE_RETRY_BACKOFF_MS},
+	.retry_on_nr = HM10_CLONE_RETRY_ON_NR,
+	.retry_on_err = HM10_CLONE_RETRY_ON_ERR
+};																				                /**< @brief Retry policy with which the failed attempts of the AT Commands are retried. */
+#if HM10_CLONE_NAME_CMDS || HM10_CLONE_PIN_CMDS || HM10_CLONE_CENTRAL_API
 static const uint8_t CR_AND_LF_SIZE = 2;									                    /**< @brief Length in bytes of a Carriage Return and a New Line characters together. */
+#endif
+#if HM10_CLONE_LOG_ENABLED
+/**@brief	Flags that indicate whether each @ref HM10_Clone_Trace_Event is enabled by the log level of its subsystem.
+ *
+ * @details A disabled event is discarded by the compiler at each of its @ref HM10_CLONE_LOG calls, and so is its
+ *          message string.
+ */
+enum
+{
+	#define HM10_CLONE_TRACE_EVENT_ENABLED(event, subsystem, level, format)	event##_ENABLED = (HM10_CLONE_LOG_##level <= HM10_CLONE_LOG_LEVEL_##subsystem),
+	HM10_CLONE_TRACE_EVENTS(HM10_CLONE_TRACE_EVENT_ENABLED)
+	#undef HM10_CLONE_TRACE_EVENT_ENABLED
+};
+#endif
+#if HM10_CLONE_TRACE_ENABLED
+_Static_assert((HM10_CLONE_TRACE_BUFFER_RECORDS & (HM10_CLONE_TRACE_BUFFER_RECORDS - 1)) == 0, "HM10_CLONE_TRACE_BUFFER_RECORDS must be a power of two.");
+static HM10_Clone_Trace_Record trace_buffer[HM10_CLONE_TRACE_BUFFER_RECORDS];	                /**< @brief Binary trace ring buffer into which the messages of this @ref hm10_ble_clone are recorded. */
+static uint16_t trace_head;													                    /**< @brief Total number of records that have been written into the @ref trace_buffer (modulo 2^16), whose lowest bits give the index at which the next record will be written. */
+static uint16_t trace_tail;													                    /**< @brief Total number of records that have been read from the @ref trace_buffer (modulo 2^16). */
+static uint16_t trace_sequence;												                    /**< @brief Sequence number given to the last record written into the @ref trace_buffer . */
+#elif HM10_CLONE_LOG_ENABLED
+static const char *const trace_formats[] =
+{
+	#define HM10_CLONE_TRACE_EVENT_FORMAT(event, subsystem, level, format)	(event##_ENABLED ? format : 0),
+	HM10_CLONE_TRACE_EVENTS(HM10_CLONE_TRACE_EVENT_FORMAT)
+	#undef HM10_CLONE_TRACE_EVENT_FORMAT
+};																				                /**< @brief Human-readable messages of each @ref HM10_Clone_Trace_Event , which are displayed via @ref printf . @note The messages of the disabled events are not compiled in. */
+#endif
+#if HM10_CLONE_STATS
+static HM10_Clone_Stats stats;												                    /**< @brief Performance counters and health statistics of the @ref hm10_ble_clone . */
+static uint32_t stats_cmd_start_tick;										                    /**< @brief HAL Tick at which the AT Command function that is currently being executed was called. */
+static uint32_t stats_cmd_start_uart_errors;								                    /**< @brief Value of the UART errors counter at the moment that the AT Command function that is currently being executed was called. */
+#endif
+#if HM10_CLONE_STATE_PIN
+static GPIO_def_t state_pin;												                    /**< @brief GPIO pin of our MCU/MPU that is connected to the STATE pin of the HM-10 Clone BLE Device. */
+static uint8_t state_pin_set;												                    /**< @brief Flag that indicates whether the @ref state_pin has been set. */
+static HM10_Clone_Connected_Policy connected_policy = HM10_CLONE_CONNECTED_POLICY;				/**< @brief Policy of the AT Commands that are requested while the HM-10 Clone BLE Device is connected (see @ref set_hm10clone_connected_policy ). */
+static uint32_t connected_wait_timeout = HM10_CLONE_CONNECTED_WAIT_TIMEOUT;						/**< @brief Time in milliseconds that the @ref HM10_Clone_Connected_WAIT policy holds each AT Command. */
+#endif
+#if HM10_CLONE_POWER_PIN
+/**@brief	Configuration that was last set successfully to the HM-10 Clone BLE Device, which is restored by
+ *          @ref disconnect_hm10clone_device after power-cycling it.
+ */
+typedef struct
+{
+	uint16_t cached_cmds;							//!< Bit mask, indexed with @ref HM10_Clone_Cmd , of the AT Commands whose value has been cached.
+	uint8_t name[HM10_CLONE_MAX_BLE_NAME_SIZE];		//!< Value of the last successful Name Command.
+	uint8_t name_size;								//!< Length in bytes of the name held at the \c name field.
+	uint8_t role;									//!< ASCII Code value of the last successful Role Command.
+	uint8_t pin[HM10_CLONE_PIN_VALUE_SIZE];			//!< Value of the last successful Pin Command.
+	uint8_t type;									//!< ASCII Code value of the last successful Type Command.
+} Config_Cache;
+
+static GPIO_def_t power_pin;												                    /**< @brief GPIO pin of our MCU/MPU that switches the power supply of the HM-10 Clone BLE Device. */
+static GPIO_PinState power_pin_on_state;									                    /**< @brief Logic level of the @ref power_pin that keeps the HM-10 Clone BLE Device powered on. */
+static uint8_t power_pin_set;												                    /**< @brief Flag that indicates whether the @ref power_pin has been set. */
+static Config_Cache config_cache;											                    /**< @brief Configuration of the HM-10 Clone BLE Device that is restored after power-cycling it. */
+#endif
+static HM10_Clone_Cmd current_cmd;											                    /**< @brief AT Command of the public AT Command function that is currently being executed, or of the last one that was executed. */
+#if HM10_CLONE_ADAPTIVE_TIMEOUT
+/**@brief	Round-trip time estimate of an AT Command, whose values are scaled just like in the retransmission timer of
+ *          TCP so that they can be updated with integer arithmetic.
+ */
+typedef struct
+{
+	uint32_t samples;	//!< Number of round-trip time samples taken.
+	int32_t srtt_x8;	//!< Smoothed round-trip time in milliseconds, multiplied by 8.
+	int32_t rttvar_x4;	//!< Round-trip time variation in milliseconds, multiplied by 4.
+	uint8_t backoff;	//!< Number of consecutive timeouts, each of which doubles the timeout (see @ref HM10_CLONE_ADAPTIVE_TIMEOUT_MAX_BACKOFF ).
+} Rtt_Estimate;
+
+static Rtt_Estimate rtt_estimates[HM10_Clone_Cmd_Count];						                /**< @brief Round-trip time estimate of each AT Command type, indexed with @ref HM10_Clone_Cmd . */
+static uint8_t rtt_sample_pending;											                    /**< @brief Flag that indicates whether the next reception of the current call is the first Response after having transmitted an AT Command, and therefore, whether it gives a round-trip time sample. */
+#endif
+#if HM10_CLONE_NONBLOCKING_API
+static HM10_Clone_Transaction *active_transaction;							                    /**< @brief Pointer to the non-blocking AT Command transaction that is currently in progress, or \c NULL if there is none. */
+#endif
+#if HM10_CLONE_RTOS
+static const HM10_Clone_OS_Port *os_port;									                    /**< @brief Pointer to the porting interface of the RTOS with which this @ref hm10_ble_clone was integrated. */
+static void *os_mutex;														                    /**< @brief Mutex that serialises the calls to this @ref hm10_ble_clone . */
+static void *os_tx_semaphore;												                    /**< @brief Semaphore that is given from the UART interrupts whenever a transmission of this @ref hm10_ble_clone ends. */
+static void *os_rx_semaphore;												                    /**< @brief Semaphore that is given from the UART interrupts whenever a reception of this @ref hm10_ble_clone ends. */
+static volatile uint8_t os_uart_error;										                    /**< @brief Flag that is set from the UART interrupts whenever the UART of this @ref hm10_ble_clone had an error. */
+#endif
+#if HM10_CLONE_RTOS || HM10_CLONE_NONBLOCKING_API
+static volatile uint32_t uart_tx_cplt_tick;									                    /**< @brief HAL Tick at which the last transmission of the UART of this @ref hm10_ble_clone ended, as recorded by @ref hm10clone_uart_tx_cplt_isr . */
+static volatile uint32_t uart_rx_cplt_tick;									                    /**< @brief HAL Tick at which the last reception of the UART of this @ref hm10_ble_clone ended, as recorded by @ref hm10clone_uart_rx_cplt_isr . */
+static volatile uint8_t uart_tx_cplt_stamped;								                    /**< @brief Flag that is set by @ref hm10clone_uart_tx_cplt_isr whenever it records @ref uart_tx_cplt_tick . */
+static volatile uint8_t uart_rx_cplt_stamped;								                    /**< @brief Flag that is set by @ref hm10clone_uart_rx_cplt_isr whenever it records @ref uart_rx_cplt_tick . */
+#endif
+#if HM10_CLONE_CENTRAL_API
+/**@brief	Incremental parser of the Response lines of the HM-10 Clone BLE Device, which is fed one byte at a time so
+ *          that Responses of an unknown length can be processed as they arrive.
+ */
+typedef struct
+{
+	uint8_t line[HM10_CLONE_MAX_LINE_SIZE];	//!< Line that is being received, without its Carriage Return and New Line characters.
+	uint8_t size;							//!< Length in bytes of the line held at the \c line field.
+	uint8_t overflow;						//!< Flag that indicates whether the line that is being received is longer than the \c line field, in which case it is discarded.
+} Line_Parser;
+
+_Static_assert(sizeof(HM10_CLONE_SCAN_CMD) - 1 + 2 <= HM10_CLONE_MAX_AT_COMMAND_SIZE, "HM10_CLONE_SCAN_CMD is too long.");
+_Static_assert(HM10_CLONE_STATE_PIN, "HM10_CLONE_CENTRAL_API requires HM10_CLONE_STATE_PIN.");
+static HM10_Clone_Scan_Result scan_cache[HM10_CLONE_SCAN_CACHE_SIZE];		                    /**< @brief Cache of the BLE Devices that have been discovered most recently. */
+static uint8_t scan_cache_count;											                    /**< @brief Number of valid entries of the @ref scan_cache . */
+#endif
+#if HM10_CLONE_ZERO_COPY_RX
+_Static_assert(((HM10_CLONE_RX_RING_SIZE & (HM10_CLONE_RX_RING_SIZE - 1)) == 0) && (HM10_CLONE_RX_RING_SIZE <= 32768), "HM10_CLONE_RX_RING_SIZE must be a power of two of up to 32768.");
+static uint8_t rx_ring[HM10_CLONE_RX_RING_SIZE];							                    /**< @brief Ring buffer into which the OTA data is received via DMA whenever @ref HM10_CLONE_ZERO_COPY_RX is enabled. */
+static uint32_t rx_ring_read;												                    /**< @brief Number of bytes of the @ref rx_ring that have been committed since the reception was started, whose lowest bits give the index of the oldest byte that has not been committed yet. */
+static volatile uint32_t rx_ring_halves;									                    /**< @brief Number of halves of the @ref rx_ring that the DMA has filled since the reception was started, as counted by @ref hm10clone_uart_rx_half_cplt_isr and @ref hm10clone_uart_rx_cplt_isr . */
+static uint8_t rx_stream_active;											                    /**< @brief Flag that indicates whether the reception into the @ref rx_ring is in progress. */
+#endif
+#if HM10_CLONE_TX_COALESCING
+static uint8_t tx_coalesce_buffer[HM10_CLONE_MAX_PACKET_SIZE];				                    /**< @brief Buffer into which @ref send_hm10clone_ota_data gathers the bytes of the packet that is not full yet. */
+static uint8_t tx_coalesce_size;											                    /**< @brief Number of bytes in the @ref tx_coalesce_buffer . */
+static uint32_t tx_coalesce_start_tick;										                    /**< @brief HAL Tick at which the oldest byte of the @ref tx_coalesce_buffer was gathered. */
+#endif
+#if HM10_CLONE_OTA_BENCHMARK
+static HM10_Clone_OTA_Benchmark ota_benchmark;								                    /**< @brief Measurements of the OTA data path that are made whenever @ref HM10_CLONE_OTA_BENCHMARK is enabled. */
+#endif
+#if HM10_CLONE_CAPTURE
+_Static_assert(((HM10_CLONE_CAPTURE_BUFFER_SIZE & (HM10_CLONE_CAPTURE_BUFFER_SIZE - 1)) == 0) && (HM10_CLONE_CAPTURE_BUFFER_SIZE <= 32768), "HM10_CLONE_CAPTURE_BUFFER_SIZE must be a power of two of up to 32768.");
+static uint8_t capture_buffer[HM10_CLONE_CAPTURE_BUFFER_SIZE];				                    /**< @brief RAM ring buffer into which the capture records are stored whenever no @ref capture_sink has been set. */
+static uint16_t capture_head;												                    /**< @brief Total number of bytes that have been written into the @ref capture_buffer (modulo 2^16), whose lowest bits give the index at which the next byte will be written. */
+static uint16_t capture_tail;												                    /**< @brief Total number of bytes that have been read or discarded from the @ref capture_buffer (modulo 2^16). */
+static HM10_Clone_Capture_Sink capture_sink;								                    /**< @brief Function to which the capture records are streamed out, or \c NULL if they are stored into the @ref capture_buffer . */
+static uint32_t capture_call_start_tick;									                    /**< @brief HAL Tick at which the AT Command function that is currently being executed was called. */
+#endif
+#if HM10_CLONE_TIMER
+_Static_assert(((HM10_CLONE_TIMER_WHEEL_SLOTS & (HM10_CLONE_TIMER_WHEEL_SLOTS - 1)) == 0) && (HM10_CLONE_TIMER_WHEEL_SLOTS <= 32768), "HM10_CLONE_TIMER_WHEEL_SLOTS must be a power of two of up to 32768.");
+static TIM_HandleTypeDef *p_htim;											                    /**< @brief Pointer to the TIM Handle Structure of the hardware timer that drives the @ref timer_wheel , or \c NULL if none has been set. */
+static HM10_Clone_Timer *timer_wheel[HM10_CLONE_TIMER_WHEEL_SLOTS];		                    /**< @brief Slots of the timer wheel, each of which is a linked list of the armed timers whose deadline falls on it. */
+static volatile uint16_t timer_wheel_slot;									                    /**< @brief Slot of the @ref timer_wheel of the last tick. */
+static volatile uint16_t timer_armed_count;									                    /**< @brief Number of timers that are linked into the @ref timer_wheel . */
+static volatile uint8_t timer_wheel_running;								                    /**< @brief Flag that indicates whether the hardware timer of the @ref timer_wheel is running. */
+static HM10_Clone_Timer *timer_expired_head;								                    /**< @brief Oldest expired timer whose callback has not been called yet, or \c NULL if there is none. */
+static HM10_Clone_Timer *timer_expired_tail;								                    /**< @brief Newest expired timer whose callback has not been called yet, or \c NULL if there is none. */
+#endif
 
 /**@brief	Numbers in ASCII code definitions.
  *
@@ -55,7 +253,7 @@ typedef enum
 	Number_9_in_ASCII	= 57U     //!< \f$9_{ASCII} = 57_d\f$.
 } Numbers_in_ASCII;
 
-/**@brief	Sends a Test Command to the HM-10 Clone BLE Device with a maximum of two attempts.
+/**@brief	Sends a Test Command to the HM-10 Clone BLE Device in a single attempt.
  *
  * @retval	HM10_Clone_EC_OK	if the Test Command was successfully sent to the HM-10 Clone BLE Device and if an OK
  *                              Response was received from it subsequently.
@@ -68,7 +266,7 @@ typedef enum
  */
 static HM10_Clone_Status send_test_cmd();
 
-/**@brief	Sends a Reset Command to the HM-10 Clone BLE Device with a maximum of two attempts.
+/**@brief	Sends a Reset Command to the HM-10 Clone BLE Device in a single attempt.
  *
  * @retval	HM10_Clone_EC_OK	if the Reset Command was successfully sent to the HM-10 Clone BLE Device and if an OK
  *                              Response was received from it subsequently.
@@ -81,7 +279,8 @@ static HM10_Clone_Status send_test_cmd();
  */
 static HM10_Clone_Status send_reset_cmd();
 
-/**@brief	Sends a Name Command to the HM-10 Clone BLE Device with a maximum of two attempts.
+#if HM10_CLONE_NAME_CMDS
+/**@brief	Sends a Name Command to the HM-10 Clone BLE Device in a single attempt.
  *
  * @param[in] hm10_name Pointer to the ASCII Code data representing the desired BLE Name that wants to be given to the
  *                      HM-10 Clone BLE Device.
@@ -108,8 +307,10 @@ static HM10_Clone_Status send_reset_cmd();
  * @date	October 17, 2023
  */
 static HM10_Clone_Status send_set_name_cmd(uint8_t *hm10_name, uint8_t size);
+#endif
 
-/**@brief	Sends a Get Name Command to the HM-10 Clone BLE Device with a maximum of two attempts in order to get the
+#if HM10_CLONE_NAME_CMDS && HM10_CLONE_GETTER_CMDS
+/**@brief	Sends a Get Name Command to the HM-10 Clone BLE Device in a single attempt in order to get the
  *          BLE Name from the HM-10 Clone BLE Device.
  *
  * @param[out] hm10_name    Pointer to the ASCII Code data that should contain the BLE Name that is to be received from
@@ -138,8 +339,10 @@ static HM10_Clone_Status send_set_name_cmd(uint8_t *hm10_name, uint8_t size);
  * @date	October 20, 2023
  */
 static HM10_Clone_Status send_get_name_cmd(uint8_t *hm10_name, uint8_t *size);
+#endif
 
-/**@brief	Sends a Role Command to the HM-10 Clone BLE Device with a maximum of two attempts.
+#if HM10_CLONE_ROLE_CMDS
+/**@brief	Sends a Role Command to the HM-10 Clone BLE Device in a single attempt.
  *
  * @param ble_role	BLE Role that wants to be set on the HM-10 Clone BLE Device.
  *
@@ -163,8 +366,10 @@ static HM10_Clone_Status send_get_name_cmd(uint8_t *hm10_name, uint8_t *size);
  * @date	October 23, 2023
  */
 static HM10_Clone_Status send_set_role_cmd(HM10_Clone_Role ble_role);
+#endif
 
-/**@brief	Sends a Get Role Command to the HM-10 Clone BLE Device with a maximum of two attempts in order to get the
+#if HM10_CLONE_ROLE_CMDS && HM10_CLONE_GETTER_CMDS
+/**@brief	Sends a Get Role Command to the HM-10 Clone BLE Device in a single attempt in order to get the
  *          BLE Role of the HM-10 Clone BLE Device.
  *
  * @param[out] ble_role	Pointer to the 1 byte data into which this function will write the BLE Role value given by the
@@ -188,8 +393,10 @@ static HM10_Clone_Status send_set_role_cmd(HM10_Clone_Role ble_role);
  * @date	October 23, 2023
  */
 static HM10_Clone_Status send_get_role_cmd(HM10_Clone_Role *ble_role);
+#endif
 
-/**@brief	Sends a Pin Command to the HM-10 Clone BLE Device with a maximum of two attempts.
+#if HM10_CLONE_PIN_CMDS
+/**@brief	Sends a Pin Command to the HM-10 Clone BLE Device in a single attempt.
  *
  * @param[in] pin	Pointer to the ASCII Code data representing the desired BLE Pin that wants to be given to the HM-10
  *                  Clone BLE Device. This pin data must consist of 6 bytes of data, where each byte must stand for any
@@ -216,8 +423,10 @@ static HM10_Clone_Status send_get_role_cmd(HM10_Clone_Role *ble_role);
  * @date	October 23, 2023
  */
 static HM10_Clone_Status send_set_pin_cmd(uint8_t *pin);
+#endif
 
-/**@brief	Sends a Get Pin Command to the HM-10 Clone BLE Device with a maximum of two attempts in order to get the
+#if HM10_CLONE_PIN_CMDS && HM10_CLONE_GETTER_CMDS
+/**@brief	Sends a Get Pin Command to the HM-10 Clone BLE Device in a single attempt in order to get the
  *          BLE Pin of the HM-10 Clone BLE Device.
  *
  * @param[out] pin	Pointer to the ASCII Code data representing the received BLE Pin from the HM-10 Clone BLE Device.
@@ -241,8 +450,10 @@ static HM10_Clone_Status send_set_pin_cmd(uint8_t *pin);
  * @date	October 23, 2023
  */
 static HM10_Clone_Status send_get_pin_cmd(uint8_t *pin);
+#endif
 
-/**@brief	Sends a Type Command to the HM-10 Clone BLE Device with a maximum of two attempts.
+#if HM10_CLONE_TYPE_CMDS
+/**@brief	Sends a Type Command to the HM-10 Clone BLE Device in a single attempt.
  *
  * @param pin_code_mode Pin Code Mode that is desired to set in the HM-10 Clone BLE Device.
  *
@@ -267,8 +478,10 @@ static HM10_Clone_Status send_get_pin_cmd(uint8_t *pin);
  * @date	October 24, 2023
  */
 static HM10_Clone_Status send_set_type_cmd(HM10_Clone_Pin_Code_Mode pin_code_mode);
+#endif
 
-/**@brief	Sends a Get Type Command to the HM-10 Clone BLE Device with a maximum of two attempts in order to get the
+#if HM10_CLONE_TYPE_CMDS && HM10_CLONE_GETTER_CMDS
+/**@brief	Sends a Get Type Command to the HM-10 Clone BLE Device in a single attempt in order to get the
  *          Pin Code Mode of the HM-10 Clone BLE Device.
  *
  * @param[out] pin_code_mode    @ref HM10_Clone_Pin_Code_Mode Type Pointer to the Pin Code Mode that the HM-10 Clone BLE
@@ -291,14 +504,33 @@ static HM10_Clone_Status send_set_type_cmd(HM10_Clone_Pin_Code_Mode pin_code_mod
  * @date	October 23, 2023
  */
 static HM10_Clone_Status send_get_type_cmd(HM10_Clone_Pin_Code_Mode *pin_code_mode);
+#endif
+
+/**@brief	Populates an AT Command into the @ref TxRx_Buffer , which is made of a constant prefix, an optional value
+ *          and the Carriage Return and New Line characters.
+ *
+ * @param[in] cmd_prefix	Pointer to the constant prefix of the AT Command (e.g., @ref HM10_Clone_Name_cmd ).
+ * @param cmd_prefix_size	Length in bytes of the \p cmd_prefix param.
+ * @param[in] value			Pointer to the value that goes after the prefix, or \c NULL if there is none.
+ * @param value_size		Length in bytes of the \p value param.
+ *
+ * @return	The length in bytes of the populated AT Command.
+ *
+ * @date	October 18, 2026.
+ */
+static uint8_t cmd_populate(const uint8_t *cmd_prefix, uint8_t cmd_prefix_size, const uint8_t *value, uint8_t value_size);
 
 /**@brief	Flushes the RX of the UART towards which the @ref p_huart Global Pointer points to.
  *
  * @details This function will poll-receive one byte from the RX of the UART previously mentioned with a timeout of @ref
  *          HM10_CLONE_CUSTOM_HAL_TIMEOUT over and over until a @ref HAL_TIMEOUT HAL Status is received.
  *
+ * @note    The flush is also stopped after @ref HM10_CLONE_MAX_FLUSH_BYTES bytes or on any other HAL Status than
+ *          @ref HAL_OK , so that its execution time is bounded even if the HM-10 Clone BLE Device sends data endlessly.
+ *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date    November 30, 2023.
+ * @date    LAST UPDATE: October 18, 2026.
  */
 static void HAL_uart_rx_flush();
 
@@ -319,1357 +551,4621 @@ static void HAL_uart_rx_flush();
  */
 static HM10_Clone_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status);
 
-HM10_Clone_Status init_hm10_clone_module(UART_HandleTypeDef *huart)
-{
-	p_huart = huart;
+#if HM10_CLONE_STATE_PIN
+/**@brief	Reads the STATE pin of the HM-10 Clone BLE Device.
+ *
+ * @note    The @ref state_pin must have been set before calling this function.
+ *
+ * @return	\c 1 if the HM-10 Clone BLE Device is connected with an external BLE Device. Otherwise, \c 0 .
+ *
+ * @date	October 18, 2026.
+ */
+static uint8_t state_pin_connected();
 
-	return HM10_Clone_EC_OK;
-}
+/**@brief	Indicates whether the @ref connected_policy applies to an AT Command, which is whenever a policy other than
+ *          @ref HM10_Clone_Connected_SEND has been set together with the @ref state_pin , except for the Connect
+ *          Command, which already handles the case in which the HM-10 Clone BLE Device is connected.
+ *
+ * @param cmd	AT Command to be sent.
+ *
+ * @return	\c 1 if the @ref connected_policy applies to \p cmd . Otherwise, \c 0 .
+ *
+ * @date	October 18, 2026.
+ */
+static uint8_t connected_policy_applies(HM10_Clone_Cmd cmd);
+#endif
 
-HM10_Clone_Status send_hm10clone_test_cmd()
-{
-	resp_attempts = 0; // Reset the response attempts counter.
-	return send_test_cmd(); // Send the HM-10 Clone Device's Test Command.
-}
+#if HM10_CLONE_POWER_PIN
+/**@brief	Caches the value of an AT Command that was sent successfully into the @ref config_cache , whenever it is a
+ *          command that sets the configuration of the HM-10 Clone BLE Device.
+ *
+ * @param cmd		AT Command that was sent successfully.
+ * @param[in] value	Pointer to the value that was sent with \p cmd .
+ * @param size		Length in bytes of \p value .
+ *
+ * @date	October 18, 2026.
+ */
+static void config_cache_store(HM10_Clone_Cmd cmd, const uint8_t *value, uint8_t size);
+#endif
 
-static HM10_Clone_Status send_test_cmd()
-{
-	/* Flush the UART's RX before starting. */
-	HAL_uart_rx_flush();
+/**@brief	Takes the mutex of this @ref hm10_ble_clone , whenever @ref HM10_CLONE_RTOS is enabled.
+ *
+ * @date	October 18, 2026.
+ */
+#if HM10_CLONE_CENTRAL_API
+/**@brief	Sends a Scan Command to the HM-10 Clone BLE Device in a single attempt and parses its Responses until the
+ *          scan concludes.
+ *
+ * @param timeout			Timeout duration, in milliseconds, for the whole scan.
+ * @param callback			Function that will be called for each discovered BLE Device, or \c NULL if not required.
+ * @param[out] devices_found	Pointer to the Memory Address into which the number of discovered BLE Devices will be
+ *                              stored.
+ *
+ * @retval	HM10_Clone_EC_OK	if the scan concluded successfully.
+ * @retval  HM10_Clone_EC_NR    if there was no response from the HM-10 Clone BLE Device or if the scan did not
+ *                              conclude within the \p timeout param.
+ * @retval  HM10_Clone_EC_ERR   otherwise.
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status send_scan_cmd(uint32_t timeout, HM10_Clone_Scan_Callback callback, uint8_t *devices_found);
 
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
-	int16_t  ret;
+/**@brief	Sends a Connect Command to the HM-10 Clone BLE Device in a single attempt and waits for its STATE pin to go
+ *          high.
+ *
+ * @param[in] address			Address of the BLE Device to connect to.
+ * @param timeout				Timeout duration, in milliseconds, for establishing the connection.
+ * @param[out] connect_time		Pointer to the Memory Address into which the time, in milliseconds, that it took to
+ *                              establish the connection will be stored.
+ *
+ * @retval	HM10_Clone_EC_OK	if the connection was established.
+ * @retval  HM10_Clone_EC_NR    if there was no response from the HM-10 Clone BLE Device or if the connection was not
+ *                              established within the \p timeout param.
+ * @retval  HM10_Clone_EC_ERR   otherwise.
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status send_connect_cmd(const uint8_t address[HM10_CLONE_BLE_ADDRESS_SIZE], uint32_t timeout, uint32_t *connect_time);
 
-	/* Populate the HM-10 Clone Device's Test Command into the Tx/Rx Buffer. */
-	#if ETX_OTA_VERBOSE
-		printf("Sending Test Command to HM-10 Clone BLE Device...\r\n");
-	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '\r';
-	TxRx_Buffer[3] = '\n';
+/**@brief	Sends an Auto-Reconnect Command to the HM-10 Clone BLE Device in a single attempt.
+ *
+ * @param enable	\c 1 to enable the automatic reconnection or \c 0 to disable it.
+ *
+ * @retval	HM10_Clone_EC_OK	if the AT Command was accepted by the HM-10 Clone BLE Device.
+ * @retval  HM10_Clone_EC_NR    if there was no response from the HM-10 Clone BLE Device.
+ * @retval  HM10_Clone_EC_ERR   otherwise.
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status send_auto_reconnect_cmd(uint8_t enable);
 
-	/* Send the HM-10 Clone Device's Test Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_CLONE_TEST_CMD_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to transmit Test Command to HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_test_cmd();
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: Last attempt for transmitting the Test Command to HM-10 Clone BLE Device has failed.\r\n");
-			}
-		#endif
-		return ret;
-	}
+/**@brief	Receives bytes from the HM-10 Clone BLE Device into a @ref Line_Parser until a whole line is received.
+ *
+ * @param[in,out] parser	Pointer to the parser into which the bytes are fed.
+ * @param timeout			Timeout duration, in milliseconds, for receiving the whole line.
+ *
+ * @retval	HM10_Clone_EC_OK	if a whole line was received, which is then held by the \p parser param.
+ * @retval  HM10_Clone_EC_NR    if no whole line was received within the \p timeout param.
+ * @retval  HM10_Clone_EC_ERR   otherwise.
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status receive_line(Line_Parser *parser, uint32_t timeout);
 
-	/* Receive the HM-10 Clone Device's Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_CLONE_OK_RESPONSE_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to receive OK Response from HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_test_cmd();
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: An OK Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n", ret);
-			}
-		#endif
-		return ret;
-	}
+/**@brief	Clears the line that is being held by a @ref Line_Parser .
+ *
+ * @param[out] parser	Pointer to the parser that is desired to be cleared.
+ *
+ * @date	October 18, 2026.
+ */
+static void line_parser_reset(Line_Parser *parser);
 
-	/* Validate the HM-10 Clone Device's Response. */
-	for (int i=0; i<HM10_CLONE_OK_RESPONSE_SIZE; i++)
-	{
-		if (TxRx_Buffer[i] != HM10_Clone_OK_resp[i])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: An OK Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_Clone_EC_ERR;
-		}
-	}
-	#if ETX_OTA_VERBOSE
-		printf("DONE: A Test Command was successfully sent to the HM-10 Clone BLE Device.\r\n");
-	#endif
+/**@brief	Feeds a received byte into a @ref Line_Parser .
+ *
+ * @param[in,out] parser	Pointer to the parser into which the byte is fed.
+ * @param byte				Byte that was received from the HM-10 Clone BLE Device.
+ *
+ * @return	\c 1 if the \p byte param concluded a line, which is then held by the \p parser param until the next byte
+ *          is fed. Otherwise, \c 0 .
+ *
+ * @date	October 18, 2026.
+ */
+static uint8_t line_parser_feed(Line_Parser *parser, uint8_t byte);
 
-	return HM10_Clone_EC_OK;
-}
+/**@brief	Indicates whether the line that is held by a @ref Line_Parser starts with a certain prefix.
+ *
+ * @param[in] parser	Pointer to the parser that holds the line.
+ * @param[in] prefix	Null-terminated prefix.
+ *
+ * @return	\c 1 if the line starts with the \p prefix param. Otherwise, \c 0 .
+ *
+ * @date	October 18, 2026.
+ */
+static uint8_t line_starts_with(const Line_Parser *parser, const char *prefix);
 
-HM10_Clone_Status send_hm10clone_reset_cmd()
-{
-	resp_attempts = 0; // Reset the response attempts counter.
-	return send_reset_cmd(); // Send the HM-10 Clone Device's Reset Command.
-}
+/**@brief	Gets the first BLE address, given as 12 consecutive hexadecimal digits, that is contained in some text.
+ *
+ * @param[in] text		Pointer to the text that contains the BLE address.
+ * @param size			Length in bytes of the text towards which the \p text param points to.
+ * @param[out] address	Pointer to the Memory Address into which the BLE address will be stored, from its most
+ *                      significant byte to its least significant byte.
+ *
+ * @return	\c 1 if a BLE address was found. Otherwise, \c 0 .
+ *
+ * @date	October 18, 2026.
+ */
+static uint8_t parse_ble_address(const uint8_t *text, uint8_t size, uint8_t address[HM10_CLONE_BLE_ADDRESS_SIZE]);
 
-static HM10_Clone_Status send_reset_cmd()
-{
-	/* Flush the UART's RX before starting. */
-	HAL_uart_rx_flush();
+/**@brief	Stores a discovered BLE Device into the @ref scan_cache , either by refreshing its entry or by replacing the
+ *          least recently seen one whenever it is full.
+ *
+ * @param[in] address	Address of the discovered BLE Device.
+ *
+ * @return	Pointer to the entry of the @ref scan_cache of the discovered BLE Device.
+ *
+ * @date	October 18, 2026.
+ */
+static const HM10_Clone_Scan_Result *scan_cache_update(const uint8_t address[HM10_CLONE_BLE_ADDRESS_SIZE]);
+#endif
 
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
-	int16_t  ret;
+#if (HM10_CLONE_RPC || HM10_CLONE_MUX || HM10_CLONE_PING) && !HM10_CLONE_ZERO_COPY_RX
+/**@brief	Receives one byte of OTA data only if it has already been received, for @ref drain_hm10clone_ota_data .
+ *
+ * @details Unlike @ref get_hm10clone_ota_data , finding no byte is neither counted nor logged, since it is the
+ *          normal outcome of draining the received bytes.
+ *
+ * @param[out] byte	Pointer to the Memory Address into which the received byte will be stored.
+ *
+ * @return	The @ref HM10_Clone_Status equivalent of the @ref HAL_StatusTypeDef value given by the UART (see
+ *          @ref HAL_ret_handler ).
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status ota_rx_nowait(uint8_t *byte);
+#endif
 
-	/* Populate the HM-10 Clone Device's Reset Command into the Tx/Rx Buffer. */
-	#if ETX_OTA_VERBOSE
-		printf("Sending Reset Command to HM-10 Clone BLE Device...\r\n");
-	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '+';
-	TxRx_Buffer[3] = 'R';
-	TxRx_Buffer[4] = 'E';
-	TxRx_Buffer[5] = 'S';
-	TxRx_Buffer[6] = 'E';
-	TxRx_Buffer[7] = 'T';
-	TxRx_Buffer[8] = '\r';
-	TxRx_Buffer[9] = '\n';
+#if HM10_CLONE_ZERO_COPY_RX
+/**@brief	Gets the number of bytes that the DMA has written into the @ref rx_ring since the reception was started.
+ *
+ * @details This count is given by the halves of the @ref rx_ring that have been filled, as counted by the DMA
+ *          callbacks, plus the position of the DMA within the current half, so that it keeps counting the bytes
+ *          that overwrite the ones that have not been committed yet.
+ *
+ * @return	The number of bytes that have been written into the @ref rx_ring .
+ *
+ * @date	October 18, 2026.
+ */
+static uint32_t rx_ring_written();
 
-	/* Send the HM-10 Clone Device's Reset Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_CLONE_RESET_CMD_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to transmit Reset Command to HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_reset_cmd();
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: Last attempt for transmitting the Reset Command to HM-10 Clone BLE Device has failed.\r\n");
-			}
-		#endif
-		return ret;
-	}
+/**@brief	Gets the number of bytes of the @ref rx_ring that have been received and that have not been committed yet.
+ *
+ * @details Whenever the DMA has overwritten any of the bytes that had not been committed yet, the overrun is
+ *          counted in the @ref HM10_Clone_Stats and logged, and all the bytes of the @ref rx_ring are discarded so
+ *          that the reception continues from the next byte that the DMA writes.
+ *
+ * @param[out] available	Pointer to the Memory Address into which the number of readable bytes of the
+ *                          @ref rx_ring will be stored, which is \c 0 after an overrun.
+ *
+ * @retval	HM10_Clone_EC_OK	if no bytes were overwritten.
+ * @retval  HM10_Clone_EC_ERR   if the DMA overwrote bytes that had not been committed yet.
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status rx_ring_available(uint16_t *available);
+#endif
 
-	/* Receive the HM-10 Clone Device's OK Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_CLONE_OK_RESPONSE_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to receive OK Response from HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_reset_cmd();
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: An OK Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n", ret);
-			}
-		#endif
-		return ret;
-	}
+#if HM10_CLONE_TX_COALESCING
+/**@brief	Gathers some data into whole packets, where the packets that are filled are sent right away and the
+ *          remaining bytes are kept in the @ref tx_coalesce_buffer .
+ *
+ * @details	The bytes of the @ref tx_coalesce_buffer that have waited for at least
+ *          @ref HM10_CLONE_TX_COALESCING_DELAY_MS are sent before the given data is accepted.
+ *
+ * @param[in] data	Pointer to the data that is to be sent.
+ * @param size		Length in bytes of the data towards which the \p data param points to.
+ * @param timeout	Timeout duration for sending each of the filled packets.
+ *
+ * @return	@ref HM10_Clone_EC_OK once all the given data has been either sent or kept in the
+ *          @ref tx_coalesce_buffer . Otherwise, the @ref HM10_Clone_Status value of the write that failed, in which
+ *          case none of the given data was accepted.
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status coalesce_write(uint8_t *data, uint16_t size, uint32_t timeout);
 
-	/* Validate the HM-10 Clone Device's Response. */
-	for (int i=0; i<HM10_CLONE_OK_RESPONSE_SIZE; i++)
-	{
-		if (TxRx_Buffer[i] != HM10_Clone_OK_resp[i])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: An OK Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_Clone_EC_ERR;
-		}
-	}
-	#if ETX_OTA_VERBOSE
-		printf("DONE: A Reset Command was successfully sent to the HM-10 Clone BLE Device.\r\n");
-	#endif
+/**@brief	Sends the bytes of the @ref tx_coalesce_buffer , which are kept whenever they could not be sent.
+ *
+ * @param timeout	Timeout duration for sending the bytes.
+ *
+ * @return	@ref HM10_Clone_EC_OK if the @ref tx_coalesce_buffer is empty, or the @ref HM10_Clone_Status value of
+ *          @ref HAL_uart_tx otherwise.
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status coalesce_flush(uint32_t timeout);
+#endif
 
-	return HM10_Clone_EC_OK;
-}
+static void module_lock();
 
-HM10_Clone_Status set_hm10clone_name(uint8_t *hm10_name, uint8_t size)
-{
-	resp_attempts = 0; // Reset the response attempts counter.
-	return send_set_name_cmd(hm10_name, size); // Send the HM-10 Clone Device's Name Command with the desired name to set to it.
-}
+/**@brief	Gives back the mutex of this @ref hm10_ble_clone , whenever @ref HM10_CLONE_RTOS is enabled.
+ *
+ * @date	October 18, 2026.
+ */
+static void module_unlock();
 
-static HM10_Clone_Status send_set_name_cmd(uint8_t *hm10_name, uint8_t size)
-{
-	/* Flush the UART's RX before starting. */
-	HAL_uart_rx_flush();
+/**@brief	Waits for the given number of milliseconds, which blocks the calling task whenever @ref HM10_CLONE_RTOS is
+ *          enabled instead of busy-waiting with @ref HAL_Delay .
+ *
+ * @param ms	Number of milliseconds to wait.
+ *
+ * @date	October 18, 2026.
+ */
+static void module_delay(uint32_t ms);
 
-	/* Validating given name. */
-	if (size > HM10_CLONE_MAX_BLE_NAME_SIZE)
-	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: Requested BLE Name must not exceed a length of %d bytes (i.e., %d ASCII Characters).\r\n", HM10_CLONE_MAX_BLE_NAME_SIZE, HM10_CLONE_MAX_BLE_NAME_SIZE);
-		#endif
-		return HM10_Clone_EC_ERR;
-	}
+/**@brief	Transmits data through the UART of this @ref hm10_ble_clone .
+ *
+ * @details Whenever @ref HM10_CLONE_RTOS is enabled, the transmission is made in Interrupt mode while the calling task
+ *          is blocked on @ref os_tx_semaphore . Otherwise, it is made in Polling mode.
+ *
+ * @param[in] data	Pointer to the data that is desired to be transmitted.
+ * @param size		Length in bytes of the data that is desired to be transmitted.
+ * @param timeout	Timeout in milliseconds for the transmission.
+ *
+ * @return	The @ref HAL_StatusTypeDef value of the transmission, just like @ref HAL_UART_Transmit .
+ *
+ * @date	October 18, 2026.
+ */
+static HAL_StatusTypeDef uart_transmit(uint8_t *data, uint16_t size, uint32_t timeout);
 
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
-	int16_t  ret;
-	/** <b>Local variable bytes_populated_in_TxRx_Buffer:</b> Currently populated data into the Tx/Rx Global Buffer. */
-	uint8_t bytes_populated_in_TxRx_Buffer = 0;
+/**@brief	Receives data through the UART of this @ref hm10_ble_clone .
+ *
+ * @details Whenever @ref HM10_CLONE_RTOS is enabled, the reception is made in Interrupt mode while the calling task is
+ *          blocked on @ref os_rx_semaphore . Otherwise, it is made in Polling mode.
+ *
+ * @param[out] data	Pointer to the Memory Address into which the received data will be stored.
+ * @param size		Length in bytes of the data that is desired to be received.
+ * @param timeout	Timeout in milliseconds for the reception.
+ *
+ * @return	The @ref HAL_StatusTypeDef value of the reception, just like @ref HAL_UART_Receive .
+ *
+ * @date	October 18, 2026.
+ */
+static HAL_StatusTypeDef uart_receive(uint8_t *data, uint16_t size, uint32_t timeout);
 
-	/* Populate the HM-10 Clone Device's Name Command into the Tx/Rx Buffer. */
-	#if ETX_OTA_VERBOSE
-		printf("Sending Name Command to HM-10 Clone BLE Device...\r\n");
-	#endif
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'A';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'T';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = '+';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'N';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'A';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'M';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'E';
+#if HM10_CLONE_TRACE_ENABLED
+/**@brief	Records an event into the binary trace ring buffer, overwriting the oldest record if it is full.
+ *
+ * @note    The mutex of this @ref hm10_ble_clone is taken by this function, since some events are recorded after the
+ *          public functions have given it back. Therefore, it must not be called from an interrupt.
+ *
+ * @param event	Event that is desired to be recorded.
+ * @param arg0	First integer argument of the event.
+ * @param arg1	Second integer argument of the event.
+ * @param arg2	Third integer argument of the event.
+ * @param arg3	Fourth integer argument of the event.
+ *
+ * @date	October 18, 2026.
+ */
+static void trace_record(HM10_Clone_Trace_Event event, uint16_t arg0, uint16_t arg1, uint16_t arg2, uint16_t arg3);
+#endif
 
-	/** <b>Local variable size_with_offset:</b> Either the total size in bytes stated at the \p size param plus the bytes populated in the Tx/Rx Buffer for only the Name Command (i.e., without the carriage return and the new line ASCII characters), or the total size in bytes stated at the \p size param plus the bytes read from the Tx/Rx Buffer for only the Name Response (i.e., without the carriage return and the new line ASCII characters). */
-	uint8_t size_with_offset = size + bytes_populated_in_TxRx_Buffer;
-	for (uint8_t i=0; bytes_populated_in_TxRx_Buffer<size_with_offset; i++)
-	{
-		TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = hm10_name[i];
-	}
+/**@brief	Transmits data in Polling mode via the UART towards which the @ref p_huart Global Pointer points to.
+ *
+ * @param[in] data	Pointer to the data that is desired to be transmitted.
+ * @param size		Length in bytes of the data towards which the \p data param points to.
+ * @param timeout	Timeout duration in milliseconds for the requested transmission.
+ *
+ * @return	The @ref HM10_Clone_Status equivalent of the @ref HAL_StatusTypeDef value given by the UART (see
+ *          @ref HAL_ret_handler ).
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status HAL_uart_tx(uint8_t *data, uint16_t size, uint32_t timeout);
 
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = '\r';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = '\n';
+/**@brief	Receives data in Polling mode via the UART towards which the @ref p_huart Global Pointer points to.
+ *
+ * @param[out] data	Pointer to the Memory Address into which the received data will be stored.
+ * @param size		Length in bytes of the data that is expected to be received.
+ * @param timeout	Timeout duration in milliseconds for the requested reception.
+ *
+ * @return	The @ref HM10_Clone_Status equivalent of the @ref HAL_StatusTypeDef value given by the UART (see
+ *          @ref HAL_ret_handler ).
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status HAL_uart_rx(uint8_t *data, uint16_t size, uint32_t timeout);
 
-	/* Send the HM-10 Clone Device's Name Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, bytes_populated_in_TxRx_Buffer, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to transmit Name Command to HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_set_name_cmd(hm10_name, size);
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: Last attempt for transmitting the Name Command to HM-10 Clone BLE Device has failed.\r\n");
-			}
-		#endif
-		return ret;
-	}
+/**@brief	Marks the beginning of a call to a public AT Command function for the @ref HM10_Clone_Stats statistics and
+ *          for the adaptive timeouts (see @ref HM10_CLONE_ADAPTIVE_TIMEOUT ).
+ *
+ * @note    The mutex of this @ref hm10_ble_clone must be held by the caller.
+ *
+ * @param cmd	AT Command that is going to be sent by the call.
+ *
+ * @date	October 18, 2026.
+ */
+static void cmd_begin(HM10_Clone_Cmd cmd);
 
-	/* Receive the HM-10 Clone Device's Name Response. */
-	bytes_populated_in_TxRx_Buffer = HM10_CLONE_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME + size;
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, bytes_populated_in_TxRx_Buffer, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to receive Name Response from HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_set_name_cmd(hm10_name, size);
-		}
-		#if ETX_OTA_VERBOSE
-			else
+/**@brief	Takes the mutex of this @ref hm10_ble_clone and marks the beginning of a call to a public blocking AT
+ *          Command function via @ref cmd_begin , after applying the @ref connected_policy to it whenever
+ *          @ref HM10_CLONE_STATE_PIN is enabled.
+ *
+ * @details With the @ref HM10_Clone_Connected_WAIT policy, the STATE pin is polled every millisecond before taking the
+ *          mutex of this @ref hm10_ble_clone , so that the OTA data can keep flowing while waiting.
+ *
+ * @note    @ref cmd_end_guarded must be called afterwards, regardless of the returned value.
+ *
+ * @param cmd	AT Command that is going to be sent by the call.
+ *
+ * @retval	HM10_Clone_EC_OK		if the AT Command can be sent.
+ * @retval	HM10_Clone_EC_CONNECTED	if the AT Command must not be sent because the HM-10 Clone BLE Device is connected.
+ * @retval	HM10_Clone_EC_BUSY		if the AT Command must not be sent because a non-blocking transaction is in
+ *                                  progress, in which case the call is not begun.
+ * @retval	HM10_Clone_EC_ERR		if the AT Command must not be sent because the RX of the UART is taken by
+ *                                  @ref start_hm10clone_rx_stream , in which case the call is not begun either.
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status cmd_begin_guarded(HM10_Clone_Cmd cmd);
+
+/**@brief	Accounts the conclusion of a call to a public AT Command function into the @ref HM10_Clone_Stats statistics,
+ *          if that call was begun by @ref cmd_begin .
+ *
+ * @note    The mutex of this @ref hm10_ble_clone must be held by the caller.
+ *
+ * @param cmd		AT Command that was sent by the concluded call.
+ * @param status	@ref HM10_Clone_Status value returned by the concluded call.
+ *
+ * @date	October 18, 2026.
+ */
+static void cmd_end(HM10_Clone_Cmd cmd, HM10_Clone_Status status);
+
+/**@brief	Concludes a call to a public blocking AT Command function via @ref cmd_end and gives back the mutex of this
+ *          @ref hm10_ble_clone that was taken by @ref cmd_begin_guarded .
+ *
+ * @param cmd		AT Command that was sent by the concluded call.
+ * @param status	@ref HM10_Clone_Status value returned by the concluded call.
+ *
+ * @date	October 18, 2026.
+ */
+static void cmd_end_guarded(HM10_Clone_Cmd cmd, HM10_Clone_Status status);
+
+/**@brief	Indicates whether a failed attempt is allowed to be retried by the @ref retry_policy .
+ *
+ * @param failed_attempts	Number of attempts that have failed so far, including the one that has just failed.
+ * @param status			@ref HM10_Clone_Status value with which the attempt has failed.
+ *
+ * @return	\c 1 if the attempt is allowed to be retried. Otherwise, \c 0 .
+ *
+ * @date	October 18, 2026.
+ */
+static uint8_t retry_allowed(uint8_t failed_attempts, HM10_Clone_Status status);
+
+/**@brief	Gets the time in milliseconds that the @ref retry_policy waits before the next attempt.
+ *
+ * @param failed_attempts	Number of attempts that have failed so far.
+ *
+ * @return	The backoff time in milliseconds.
+ *
+ * @date	October 18, 2026.
+ */
+static uint16_t retry_backoff(uint8_t failed_attempts);
+
+/**@brief	Requests that the failed attempt of the current call is retried, whenever allowed by the @ref retry_policy .
+ *
+ * @details This function is called by the single attempt functions of the AT Commands (e.g., @ref send_test_cmd )
+ *          wherever their transmission or reception fails, which then return their failure status to the public
+ *          AT Command function that called them. That public function will then call the single attempt function
+ *          again whenever @ref cmd_retry_pending says so.
+ *
+ * @param status	@ref HM10_Clone_Status value with which the current attempt has failed.
+ *
+ * @return	\c 1 if the attempt will be retried. Otherwise, \c 0 .
+ *
+ * @date	October 18, 2026.
+ */
+static uint8_t cmd_retry(HM10_Clone_Status status);
+
+/**@brief	Indicates whether the last attempt of the current call requested to be retried via @ref cmd_retry , in which
+ *          case it also waits the backoff time of the @ref retry_policy and accounts that attempt as failed.
+ *
+ * @return	\c 1 if another attempt has to be made. Otherwise, \c 0 .
+ *
+ * @date	October 18, 2026.
+ */
+static uint8_t cmd_retry_pending();
+
+#if HM10_CLONE_ADAPTIVE_TIMEOUT
+/**@brief	Gets the time in milliseconds that a certain amount of bytes takes to go through the UART towards which the
+ *          @ref p_huart Global Pointer points to, at its current baud rate.
+ *
+ * @param size	Length in bytes of the data.
+ *
+ * @return	The wire time of the data in milliseconds, rounded up.
+ *
+ * @date	October 18, 2026.
+ */
+static uint32_t uart_wire_time(uint16_t size);
+#endif
+
+/**@brief	Gets the timeout in milliseconds with which an AT Command of the current call is transmitted.
+ *
+ * @param size	Length in bytes of the AT Command.
+ *
+ * @return	The wire time of the AT Command, bounded by @ref HM10_CLONE_ADAPTIVE_TIMEOUT_MIN and
+ *          @ref HM10_CLONE_ADAPTIVE_TIMEOUT_MAX , or @ref HM10_CLONE_CUSTOM_HAL_TIMEOUT whenever
+ *          @ref HM10_CLONE_ADAPTIVE_TIMEOUT is disabled.
+ *
+ * @date	October 18, 2026.
+ */
+static uint32_t cmd_tx_timeout(uint16_t size);
+
+/**@brief	Gets the timeout in milliseconds with which a Response of a given AT Command is received.
+ *
+ * @param cmd	AT Command whose Response is received (usually, @ref current_cmd ).
+ * @param size	Length in bytes of the Response.
+ *
+ * @return	The retransmission timeout estimated for the given AT Command (i.e., \f$SRTT + 4 \cdot
+ *          RTTVAR\f$ , doubled for each consecutive timeout) plus the wire time of the Response, bounded by
+ *          @ref HM10_CLONE_ADAPTIVE_TIMEOUT_MIN and @ref HM10_CLONE_ADAPTIVE_TIMEOUT_MAX , or
+ *          @ref HM10_CLONE_CUSTOM_HAL_TIMEOUT whenever @ref HM10_CLONE_ADAPTIVE_TIMEOUT is disabled.
+ *
+ * @date	October 18, 2026.
+ */
+static uint32_t cmd_rx_timeout(HM10_Clone_Cmd cmd, uint16_t size);
+
+#if HM10_CLONE_ADAPTIVE_TIMEOUT
+/**@brief	Updates the round-trip time estimate of the AT Command of the current call with the result of the reception
+ *          of its first Response.
+ *
+ * @param elapsed	Time in milliseconds that the reception of the first Response took.
+ * @param size		Length in bytes of the first Response.
+ * @param status	@ref HM10_Clone_Status value given by the reception of the first Response.
+ *
+ * @date	October 18, 2026.
+ */
+static void rtt_update(uint32_t elapsed, uint16_t size, HM10_Clone_Status status);
+#endif
+
+/**@brief	Transmits an AT Command of the current call via @ref HAL_uart_tx with the timeout given by
+ *          @ref cmd_tx_timeout .
+ *
+ * @param[in] data	Pointer to the AT Command.
+ * @param size		Length in bytes of the AT Command.
+ *
+ * @return	The @ref HM10_Clone_Status value given by @ref HAL_uart_tx .
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status HAL_uart_cmd_tx(uint8_t *data, uint16_t size);
+
+/**@brief	Receives a Response of the current call via @ref HAL_uart_rx with the timeout given by @ref cmd_rx_timeout ,
+ *          sampling its round-trip time whenever it is the first Response after transmitting an AT Command.
+ *
+ * @param[out] data	Pointer to the Memory Address into which the Response will be stored.
+ * @param size		Length in bytes of the Response.
+ *
+ * @return	The @ref HM10_Clone_Status value given by @ref HAL_uart_rx .
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status HAL_uart_cmd_rx(uint8_t *data, uint16_t size);
+
+/**@brief	Transmits some OTA data via @ref HAL_uart_tx , accounting its bytes into the
+ *          @ref HM10_Clone_Link_Stats::ota_tx_bytes counter whenever they went through the UART.
+ *
+ * @param[in] data	Pointer to the OTA data.
+ * @param size		Length in bytes of the OTA data.
+ * @param timeout	Timeout duration for transmitting the OTA data.
+ *
+ * @return	The @ref HM10_Clone_Status value given by @ref HAL_uart_tx .
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status HAL_uart_ota_tx(uint8_t *data, uint16_t size, uint32_t timeout);
+
+#if HM10_CLONE_OTA_BENCHMARK
+/**@brief	Accounts a call made to an OTA data function into the measurements of its @ref HM10_Clone_OTA_Benchmark_Path .
+ *
+ * @param[in,out] path	Pointer to the measurements of the OTA data path direction in which the call was made.
+ * @param size			Length in bytes of the data that was requested to be transferred in that call.
+ * @param status		@ref HM10_Clone_Status value returned by that call.
+ * @param cycles		CPU cycles that were spent inside that call.
+ *
+ * @date	October 18, 2026.
+ */
+static void ota_benchmark_record(HM10_Clone_OTA_Benchmark_Path *path, uint16_t size, HM10_Clone_Status status, uint32_t cycles);
+#endif
+
+#if HM10_CLONE_CAPTURE
+/**@brief	Captures a transfer of the UART or the beginning or end of a call to a public AT Command function.
+ *
+ * @details The record is streamed out to the @ref capture_sink whenever it has been set. Otherwise, it is stored into
+ *          the @ref capture_buffer , where the oldest records are discarded until the new one fits.
+ *
+ * @param info			Type and status of the record (see the \c info field of @ref HM10_Clone_Capture_Record ).
+ * @param start_tick	HAL Tick at which the transfer or the call started.
+ * @param size			Length in bytes of the transfer, or the @ref HM10_Clone_Cmd of the call.
+ * @param[in] data		Pointer to the bytes that were transferred, or \c NULL if they are not captured.
+ *
+ * @date	October 18, 2026.
+ */
+static void capture_record(uint8_t info, uint32_t start_tick, uint16_t size, const uint8_t *data);
+
+/**@brief	Copies bytes out of the @ref capture_buffer .
+ *
+ * @param[out] data	Pointer to the Memory Address into which the bytes will be copied.
+ * @param index		Total number of bytes written into the @ref capture_buffer at which the first byte to copy was
+ *                  written (modulo 2^16).
+ * @param size		Number of bytes to copy.
+ *
+ * @date	October 18, 2026.
+ */
+static void capture_copy(uint8_t *data, uint16_t index, uint16_t size);
+#endif
+
+#if HM10_CLONE_TIMER
+/**@brief	Disables the interrupts, so that the @ref timer_wheel can be modified without being advanced by
+ *          @ref hm10clone_timer_tick_isr at the same time.
+ *
+ * @return	The PRIMASK register before disabling the interrupts, which must be given to @ref timer_unlock .
+ *
+ * @date	October 18, 2026.
+ */
+static uint32_t timer_lock();
+
+/**@brief	Enables the interrupts again, unless they were already disabled before the matching @ref timer_lock .
+ *
+ * @param primask	Value returned by the matching @ref timer_lock .
+ *
+ * @date	October 18, 2026.
+ */
+static void timer_unlock(uint32_t primask);
+
+/**@brief	Unlinks a timer from either its slot of the @ref timer_wheel or from the expired timers whose callback is
+ *          pending, and sets it to @ref HM10_Clone_Timer_IDLE .
+ *
+ * @details A timer that is not found where its \c state field says that it is (e.g., one whose memory was never zeroed)
+ *          is only set to @ref HM10_Clone_Timer_IDLE , without changing the @ref timer_wheel nor
+ *          @ref timer_armed_count .
+ *
+ * @note    This function must be called between @ref timer_lock and @ref timer_unlock .
+ *
+ * @param[in,out] timer	Pointer to the timer that is desired to be unlinked.
+ *
+ * @date	October 18, 2026.
+ */
+static void timer_unlink(HM10_Clone_Timer *timer);
+#endif
+
+#if HM10_CLONE_NONBLOCKING_API
+/**@brief	Populates and starts a non-blocking AT Command transaction.
+ *
+ * @details The AT Command is populated as the \p cmd_prefix param followed by the \p value param and by the Carriage
+ *          Return and New Line characters. The expected Responses are populated as the \p resp_prefix param followed by
+ *          the \p value param and by the Carriage Return and New Line characters (only if the \p resp_size param is
+ *          greater than zero), followed by the OK Response (only if the \p ok_resp param is \c 1 ).
+ *
+ * @param[out] transaction	Pointer to the transaction that is desired to be started.
+ * @param cmd				AT Command that is sent in the transaction.
+ * @param[in] cmd_prefix	Pointer to the ASCII Code data of the AT Command that goes before its value.
+ * @param cmd_prefix_size	Length in bytes of the data towards which the \p cmd_prefix param points to.
+ * @param[in] value			Pointer to the value of the AT Command.
+ * @param value_size		Length in bytes of the data towards which the \p value param points to.
+ * @param[in] resp_prefix	Pointer to the ASCII Code data of the Response that goes before the echoed value.
+ * @param resp_size			Length in bytes of the data towards which the \p resp_prefix param points to.
+ * @param ok_resp			\c 1 if an OK Response is expected at the end of the Responses. Otherwise, \c 0 .
+ *
+ * @retval	HM10_Clone_EC_OK	if the transaction was successfully started.
+ * @retval  HM10_Clone_EC_BUSY  if another transaction is currently in progress.
+ * @retval  HM10_Clone_EC_ERR   if the UART could not start flushing its RX.
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status transaction_start(HM10_Clone_Transaction *transaction, HM10_Clone_Cmd cmd,
+										   const uint8_t *cmd_prefix, uint8_t cmd_prefix_size,
+										   const uint8_t *value, uint8_t value_size,
+										   const uint8_t *resp_prefix, uint8_t resp_size, uint8_t ok_resp);
+
+/**@brief	Advances a non-blocking AT Command transaction by a single step for @ref poll_hm10clone_transaction , whose
+ *          caller holds the mutex of this @ref hm10_ble_clone .
+ *
+ * @param[in,out] transaction	Pointer to the transaction that is desired to be advanced.
+ *
+ * @return	The same values as @ref poll_hm10clone_transaction .
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status transaction_step(HM10_Clone_Transaction *transaction);
+
+/**@brief	Makes a non-blocking AT Command transaction enter its @ref HM10_Clone_Transaction_FLUSH state by starting the
+ *          interrupt driven reception of a single byte from the RX of the UART.
+ *
+ * @param[in,out] transaction	Pointer to the transaction that is in progress.
+ *
+ * @retval	HM10_Clone_EC_BUSY	if the reception was successfully started.
+ * @retval  HM10_Clone_EC_ERR   otherwise.
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status transaction_flush(HM10_Clone_Transaction *transaction);
+
+/**@brief	Retries a non-blocking AT Command transaction whose current attempt has failed, if it has not been retried
+ *          before, or concludes it otherwise.
+ *
+ * @param[in,out] transaction	Pointer to the transaction that is in progress.
+ * @param status				@ref HM10_Clone_Status value with which the current attempt has failed.
+ *
+ * @retval	HM10_Clone_EC_BUSY	if the transaction was retried.
+ * @retval  status				the \p status param otherwise.
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status transaction_retry(HM10_Clone_Transaction *transaction, HM10_Clone_Status status);
+
+/**@brief	Concludes a non-blocking AT Command transaction.
+ *
+ * @param[in,out] transaction	Pointer to the transaction that is in progress.
+ * @param status				@ref HM10_Clone_Status value with which the transaction concludes.
+ *
+ * @return	The \p status param.
+ *
+ * @date	October 18, 2026.
+ */
+static HM10_Clone_Status transaction_end(HM10_Clone_Transaction *transaction, HM10_Clone_Status status);
+
+/**@brief	Makes a non-blocking AT Command transaction enter a state, which also starts the deadline of that state.
+ *
+ * @param[in,out] transaction	Pointer to the transaction that is in progress.
+ * @param state					State that is entered.
+ * @param timeout_us			Time in microseconds from now until the deadline of the \p state param, which is only
+ *                              used whenever the deadlines are managed by the timer wheel (see @ref HM10_CLONE_TIMER ),
+ *                              or @ref HM10_CLONE_NO_DEADLINE_US for the deadline to be given by the HAL Tick instead.
+ *
+ * @date	October 18, 2026.
+ */
+static void transaction_enter(HM10_Clone_Transaction *transaction, HM10_Clone_Transaction_State state, uint32_t timeout_us);
+
+/**@brief	Converts a timeout in milliseconds into the microseconds that are given to @ref transaction_enter .
+ *
+ * @param timeout_ms	Timeout in milliseconds.
+ *
+ * @return	The \p timeout_ms param in microseconds or, whenever that does not fit in 32 bits (i.e., for timeouts of
+ *          more than about 71 minutes), @ref HM10_CLONE_NO_DEADLINE_US .
+ *
+ * @date	October 18, 2026.
+ */
+static uint32_t timer_us_from_ms(uint32_t timeout_ms);
+
+/**@brief	Tells whether the deadline of the current state of a non-blocking AT Command transaction has been reached.
+ *
+ * @details The deadline is given by the timer wheel whenever the timer of the transaction was started by
+ *          @ref transaction_enter . Otherwise, it is given by the HAL Tick.
+ *
+ * @param[in] transaction	Pointer to the transaction that is in progress.
+ * @param elapsed			Time in milliseconds that has elapsed since the current state was entered.
+ * @param timeout			Timeout in milliseconds of the current state, which is used whenever the deadline is given
+ *                          by the HAL Tick.
+ *
+ * @return	\c 1 if the deadline has been reached. Otherwise, \c 0 .
+ *
+ * @date	October 18, 2026.
+ */
+static uint8_t transaction_timed_out(const HM10_Clone_Transaction *transaction, uint32_t elapsed, uint32_t timeout);
+#endif
+
+/**@brief	Tells whether the UART is currently being used by a non-blocking AT Command transaction (i.e., whether that
+ *          transaction is flushing the RX of the UART, sending its AT Command or receiving its Responses), in which
+ *          case the OTA data functions must not use it.
+ *
+ * @return	\c 1 if a transaction is using the UART. Otherwise (including whenever @ref HM10_CLONE_NONBLOCKING_API is
+ *          disabled), \c 0 .
+ *
+ * @date	October 18, 2026.
+ */
+static uint8_t transaction_holds_uart();
+
+HM10_Clone_Status init_hm10_clone_module(UART_HandleTypeDef *huart)
+{
+	#if HM10_CLONE_RTOS
+		/* Create the Operating System primitives, unless they were already created by a previous initialization. */
+		if (os_port == NULL)
+		{
+			return HM10_Clone_EC_ERR;
+		}
+		if (os_mutex == NULL)
+		{
+			os_mutex = os_port->mutex_create();
+		}
+		if (os_tx_semaphore == NULL)
+		{
+			os_tx_semaphore = os_port->semaphore_create();
+		}
+		if (os_rx_semaphore == NULL)
+		{
+			os_rx_semaphore = os_port->semaphore_create();
+		}
+		if ((os_mutex == NULL) || (os_tx_semaphore == NULL) || (os_rx_semaphore == NULL))
+		{
+			return HM10_Clone_EC_ERR;
+		}
+	#endif
+
+	p_huart = huart;
+
+	#if HM10_CLONE_STATS
+		/* Clear the performance counters and health statistics. */
+		memset(&stats, 0, sizeof(HM10_Clone_Stats));
+		for (uint8_t cmd=0; cmd<HM10_Clone_Cmd_Count; cmd++)
+		{
+			stats.cmd[cmd].latency_min_ms = UINT32_MAX;
+		}
+	#endif
+
+	#if HM10_CLONE_ADAPTIVE_TIMEOUT
+		/* Forget the round-trip time estimates of any previous HM-10 Clone BLE Device. */
+		memset(rtt_estimates, 0, sizeof(rtt_estimates));
+	#endif
+	#if HM10_CLONE_POWER_PIN
+		/* Forget the configuration that was set to any previous HM-10 Clone BLE Device. */
+		memset(&config_cache, 0, sizeof(Config_Cache));
+	#endif
+
+	#if (HM10_CLONE_OTA_BENCHMARK || HM10_CLONE_TRACE_ENABLED) && defined(DWT_CTRL_CYCCNTENA_Msk)
+		/* Enable the DWT Cycle Counter, which is the default clock of the OTA data path measurements and of the traces. */
+		CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+		DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	#endif
+	#if HM10_CLONE_OTA_BENCHMARK
+		/* Start a new OTA data path measurement window. */
+		reset_hm10clone_ota_benchmark();
+	#endif
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status send_hm10clone_test_cmd()
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if ((ret = cmd_begin_guarded(HM10_Clone_Cmd_Test)) == HM10_Clone_EC_OK)
+	{
+		do
+		{
+			ret = send_test_cmd(); // Send the HM-10 Clone Device's Test Command.
+		}
+		while (cmd_retry_pending());
+	}
+	cmd_end_guarded(HM10_Clone_Cmd_Test, ret);
+
+	return ret;
+}
+
+static HM10_Clone_Status send_test_cmd()
+{
+	/* Flush the UART's RX before starting. */
+	HAL_uart_rx_flush();
+
+	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
+	int16_t  ret;
+
+	/* Populate the HM-10 Clone Device's Test Command into the Tx/Rx Buffer. */
+	HM10_CLONE_LOG(HM10_CLONE_EV_TEST_CMD_SENDING);
+	cmd_populate(HM10_Clone_Test_cmd, sizeof(HM10_Clone_Test_cmd), NULL, 0);
+
+	/* Send the HM-10 Clone Device's Test Command. */
+	ret = HAL_uart_cmd_tx(TxRx_Buffer, HM10_CLONE_TEST_CMD_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_TEST_CMD_TX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_TEST_CMD_TX_FAILED);
+		}
+		return ret;
+	}
+
+	/* Receive the HM-10 Clone Device's Response. */
+	ret = HAL_uart_cmd_rx(TxRx_Buffer, HM10_CLONE_OK_RESPONSE_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_RX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_RX_FAILED, ret);
+		}
+		return ret;
+	}
+
+	/* Validate the HM-10 Clone Device's Response. */
+	if (memcmp(TxRx_Buffer, HM10_Clone_OK_resp, HM10_CLONE_OK_RESPONSE_SIZE) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+	HM10_CLONE_LOG(HM10_CLONE_EV_TEST_CMD_DONE);
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status send_hm10clone_reset_cmd()
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if ((ret = cmd_begin_guarded(HM10_Clone_Cmd_Reset)) == HM10_Clone_EC_OK)
+	{
+		do
+		{
+			ret = send_reset_cmd(); // Send the HM-10 Clone Device's Reset Command.
+		}
+		while (cmd_retry_pending());
+	}
+	cmd_end_guarded(HM10_Clone_Cmd_Reset, ret);
+
+	return ret;
+}
+
+static HM10_Clone_Status send_reset_cmd()
+{
+	/* Flush the UART's RX before starting. */
+	HAL_uart_rx_flush();
+
+	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
+	int16_t  ret;
+
+	/* Populate the HM-10 Clone Device's Reset Command into the Tx/Rx Buffer. */
+	HM10_CLONE_LOG(HM10_CLONE_EV_RESET_CMD_SENDING);
+	cmd_populate(HM10_Clone_Reset_cmd, sizeof(HM10_Clone_Reset_cmd), NULL, 0);
+
+	/* Send the HM-10 Clone Device's Reset Command. */
+	ret = HAL_uart_cmd_tx(TxRx_Buffer, HM10_CLONE_RESET_CMD_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_RESET_CMD_TX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_RESET_CMD_TX_FAILED);
+		}
+		return ret;
+	}
+
+	/* Receive the HM-10 Clone Device's OK Response. */
+	ret = HAL_uart_cmd_rx(TxRx_Buffer, HM10_CLONE_OK_RESPONSE_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_RX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_RX_FAILED, ret);
+		}
+		return ret;
+	}
+
+	/* Validate the HM-10 Clone Device's Response. */
+	if (memcmp(TxRx_Buffer, HM10_Clone_OK_resp, HM10_CLONE_OK_RESPONSE_SIZE) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+	HM10_CLONE_LOG(HM10_CLONE_EV_RESET_CMD_DONE);
+
+	return HM10_Clone_EC_OK;
+}
+
+#if HM10_CLONE_NAME_CMDS
+HM10_Clone_Status set_hm10clone_name(uint8_t *hm10_name, uint8_t size)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if ((ret = cmd_begin_guarded(HM10_Clone_Cmd_Set_Name)) == HM10_Clone_EC_OK)
+	{
+		do
+		{
+			ret = send_set_name_cmd(hm10_name, size); // Send the HM-10 Clone Device's Name Command with the desired name to set to it.
+		}
+		while (cmd_retry_pending());
+		#if HM10_CLONE_POWER_PIN
+			if (ret == HM10_Clone_EC_OK)
+			{
+				config_cache_store(HM10_Clone_Cmd_Set_Name, hm10_name, size);
+			}
+		#endif
+	}
+	cmd_end_guarded(HM10_Clone_Cmd_Set_Name, ret);
+
+	return ret;
+}
+
+static HM10_Clone_Status send_set_name_cmd(uint8_t *hm10_name, uint8_t size)
+{
+	/* Flush the UART's RX before starting. */
+	HAL_uart_rx_flush();
+
+	/* Validating given name. */
+	if (size > HM10_CLONE_MAX_BLE_NAME_SIZE)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_INVALID_NAME_SIZE, HM10_CLONE_MAX_BLE_NAME_SIZE, HM10_CLONE_MAX_BLE_NAME_SIZE);
+		return HM10_Clone_EC_ERR;
+	}
+
+	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
+	int16_t  ret;
+	/** <b>Local variable bytes_populated_in_TxRx_Buffer:</b> Currently populated data into the Tx/Rx Global Buffer. */
+	uint8_t bytes_populated_in_TxRx_Buffer;
+
+	/* Populate the HM-10 Clone Device's Name Command into the Tx/Rx Buffer. */
+	HM10_CLONE_LOG(HM10_CLONE_EV_NAME_CMD_SENDING);
+	bytes_populated_in_TxRx_Buffer = cmd_populate(HM10_Clone_Name_cmd, sizeof(HM10_Clone_Name_cmd), hm10_name, size);
+
+	/* Send the HM-10 Clone Device's Name Command. */
+	ret = HAL_uart_cmd_tx(TxRx_Buffer, bytes_populated_in_TxRx_Buffer);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_NAME_CMD_TX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_NAME_CMD_TX_FAILED);
+		}
+		return ret;
+	}
+
+	/* Receive the HM-10 Clone Device's Name Response. */
+	bytes_populated_in_TxRx_Buffer = HM10_CLONE_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME + size;
+	ret = HAL_uart_cmd_rx(TxRx_Buffer, bytes_populated_in_TxRx_Buffer);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_NAME_RESP_RX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_NAME_RESP_RX_FAILED, ret);
+		}
+		return ret;
+	}
+
+	/* Validate the HM-10 Clone Device's Name Response, which must echo the requested name. */
+	/** <b>Local variable name_resp_size_without_cr_and_lf:</b> Size in bytes of the Name Response from the HM-10 Clone BLE device but without considering the length of the requested name and withouth the Carriage Return and New Line bytes. */
+	uint8_t name_resp_size_without_cr_and_lf = HM10_CLONE_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME - CR_AND_LF_SIZE;
+	if ((memcmp(TxRx_Buffer, HM10_Clone_Name_resp, name_resp_size_without_cr_and_lf) != 0)
+		|| (memcmp(&TxRx_Buffer[name_resp_size_without_cr_and_lf], hm10_name, size) != 0)
+		|| (memcmp(&TxRx_Buffer[name_resp_size_without_cr_and_lf + size], HM10_Clone_CR_LF, sizeof(HM10_Clone_CR_LF)) != 0))
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_NAME_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+
+	/* Receive the HM-10 Clone Device's Response. */
+	ret = HAL_uart_cmd_rx(TxRx_Buffer, HM10_CLONE_OK_RESPONSE_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_RX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_RX_FAILED, ret);
+		}
+		return ret;
+	}
+
+	/* Validate the HM-10 Clone Device's Response. */
+	if (memcmp(TxRx_Buffer, HM10_Clone_OK_resp, HM10_CLONE_OK_RESPONSE_SIZE) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+	HM10_CLONE_LOG(HM10_CLONE_EV_NAME_CMD_DONE);
+
+	return HM10_Clone_EC_OK;
+}
+#endif
+
+#if HM10_CLONE_NAME_CMDS && HM10_CLONE_GETTER_CMDS
+HM10_Clone_Status get_hm10clone_name(uint8_t *hm10_name, uint8_t *size)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if ((ret = cmd_begin_guarded(HM10_Clone_Cmd_Get_Name)) == HM10_Clone_EC_OK)
+	{
+		do
+		{
+			ret = send_get_name_cmd(hm10_name, size); // Get the HM-10 Clone Device's Name.
+		}
+		while (cmd_retry_pending());
+	}
+	cmd_end_guarded(HM10_Clone_Cmd_Get_Name, ret);
+
+	return ret;
+}
+
+static HM10_Clone_Status send_get_name_cmd(uint8_t *hm10_name, uint8_t *size)
+{
+	/* Flush the UART's RX before starting. */
+	HAL_uart_rx_flush();
+
+	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
+	int16_t  ret;
+
+	/* Populate the HM-10 Clone Device's Get Name Command into the Tx/Rx Buffer. */
+	HM10_CLONE_LOG(HM10_CLONE_EV_GET_NAME_CMD_SENDING);
+	cmd_populate(HM10_Clone_Name_cmd, sizeof(HM10_Clone_Name_cmd), NULL, 0);
+
+	/* Send the HM-10 Clone Device's Get Name Command. */
+	ret = HAL_uart_cmd_tx(TxRx_Buffer, HM10_CLONE_GET_NAME_CMD_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_NAME_CMD_TX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_NAME_CMD_TX_FAILED);
+		}
+		return ret;
+	}
+
+	/* Receive the HM-10 Clone Device's Get Name Response but just before the BLE Name bytes. */
+	ret = HAL_uart_cmd_rx(TxRx_Buffer, HM10_CLONE_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_NAME_RESP_RX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_NAME_RESP_RX_FAILED, ret);
+		}
+		return ret;
+	}
+
+	/* Validate the HM-10 Clone Device's Get Name Response but just before the BLE Name bytes (last 2 bytes already obtained should not be validated here). */
+	/** <b>Local variable name_resp_size_without_cr_and_lf:</b> Size in bytes of the Name Response from the HM-10 Clone BLE device but without considering the length of the requested name and withouth the Carriage Return and New Line bytes. */
+	uint8_t name_resp_size_without_cr_and_lf = HM10_CLONE_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME - CR_AND_LF_SIZE;
+	/** <b>Local variable bytes_populated_in_TxRx_Buffer:</b> Currently populated data into the Tx/Rx Global Buffer. */
+	uint8_t bytes_populated_in_TxRx_Buffer = 0;
+	if (memcmp(TxRx_Buffer, HM10_Clone_Name_resp, name_resp_size_without_cr_and_lf) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_GET_NAME_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+	bytes_populated_in_TxRx_Buffer = name_resp_size_without_cr_and_lf;
+
+	/* Receive the BLE Name bytes part from the HM-10 Clone Device's Get Name Response. */
+	*size = 0;
+	bytes_populated_in_TxRx_Buffer += 2; // Adding last 2 bytes already obtained.
+	do
+	{
+		/* Receive the next byte from the BLE Name. */
+		ret = HAL_uart_cmd_rx(&TxRx_Buffer[bytes_populated_in_TxRx_Buffer++], 1);
+		(*size)++;
+		if (ret != HAL_OK)
+		{
+			if (cmd_retry(ret))
+			{
+				HM10_CLONE_LOG(HM10_CLONE_EV_BLE_NAME_RX_RETRY, resp_attempts + 1);
+			}
+			else
+			{
+				HM10_CLONE_LOG(HM10_CLONE_EV_BLE_NAME_RX_FAILED, ret);
+			}
+            *size = 0;
+			return ret;
+		}
+
+		/* Check if the BLE Name has been completely received. */
+		if ((TxRx_Buffer[bytes_populated_in_TxRx_Buffer-2]=='\r') && (TxRx_Buffer[bytes_populated_in_TxRx_Buffer-1]=='\n'))
+		{
+			break;
+		}
+
+		/* Validate the BLE Name bytes that have been received so far. */
+		if (bytes_populated_in_TxRx_Buffer == (HM10_CLONE_MAX_BLE_NAME_SIZE + HM10_CLONE_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME))
+		{
+			ret = HM10_Clone_EC_ERR;
+			if (cmd_retry(ret))
+			{
+				HM10_CLONE_LOG(HM10_CLONE_EV_BLE_NAME_TOO_LONG_RETRY, resp_attempts + 1, HM10_CLONE_MAX_BLE_NAME_SIZE);
+			}
+			else
+			{
+				HM10_CLONE_LOG(HM10_CLONE_EV_BLE_NAME_TOO_LONG, HM10_CLONE_MAX_BLE_NAME_SIZE);
+			}
+
+			return ret;
+		}
+	}
+	while (1);
+
+	/* Pass the BLE Name from the Buffer that is storing it into the \p hm10_name param. */
+	memcpy(hm10_name, &TxRx_Buffer[name_resp_size_without_cr_and_lf], *size);
+
+	HM10_CLONE_LOG(HM10_CLONE_EV_GET_NAME_DONE);
+
+	return HM10_Clone_EC_OK;
+}
+#endif
+
+#if HM10_CLONE_ROLE_CMDS
+HM10_Clone_Status set_hm10clone_role(HM10_Clone_Role ble_role)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if ((ret = cmd_begin_guarded(HM10_Clone_Cmd_Set_Role)) == HM10_Clone_EC_OK)
+	{
+		do
+		{
+			ret = send_set_role_cmd(ble_role); // Send the HM-10 Clone Device's Role Command with the desired role to set to it.
+		}
+		while (cmd_retry_pending());
+		#if HM10_CLONE_POWER_PIN
+			if (ret == HM10_Clone_EC_OK)
+			{
+				config_cache_store(HM10_Clone_Cmd_Set_Role, (uint8_t []) {ble_role}, 1);
+			}
+		#endif
+	}
+	cmd_end_guarded(HM10_Clone_Cmd_Set_Role, ret);
+
+	return ret;
+}
+
+static HM10_Clone_Status send_set_role_cmd(HM10_Clone_Role ble_role)
+{
+	/* Flush the UART's RX before starting. */
+	HAL_uart_rx_flush();
+
+	/* Validating given role. */
+	switch (ble_role)
+	{
+		case HM10_Clone_Role_Peripheral:
+		case HM10_Clone_Role_Central:
+			break;
+		default:
+			HM10_CLONE_LOG(HM10_CLONE_EV_INVALID_ROLE_GIVEN, ble_role);
+			return HM10_Clone_EC_ERR;
+	}
+
+	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
+	int16_t  ret;
+
+	/** <b>Local variable role:</b> ASCII Code data of the requested role. */
+	uint8_t role = ble_role;
+
+	/* Populate the HM-10 Clone Device's Role Command into the Tx/Rx Buffer. */
+	HM10_CLONE_LOG(HM10_CLONE_EV_ROLE_CMD_SENDING);
+	cmd_populate(HM10_Clone_Role_cmd, sizeof(HM10_Clone_Role_cmd), &role, 1);
+
+	/* Send the HM-10 Clone Device's Role Command. */
+	ret = HAL_uart_cmd_tx(TxRx_Buffer, HM10_CLONE_SET_ROLE_CMD_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_ROLE_CMD_TX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_ROLE_CMD_TX_FAILED);
+		}
+		return ret;
+	}
+
+	/* Receive the HM-10 Clone Device's Role Response. */
+	ret = HAL_uart_cmd_rx(TxRx_Buffer, HM10_CLONE_ROLE_RESPONSE_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_ROLE_RESP_RX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_ROLE_RESP_RX_FAILED, ret);
+		}
+		return ret;
+	}
+
+	/* Validate the HM-10 Clone Device's Role Response. */
+	/** <b>Local variable role_resp_size_without_role_cr_and_lf:</b> Size in bytes of the Role Response from the HM-10 Clone BLE device but without considering the length of the requested role and without the Carriage Return and New Line bytes. */
+	uint8_t role_resp_size_without_role_cr_and_lf = HM10_CLONE_ROLE_RESPONSE_SIZE - 3;
+	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Role Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Role Response (i.e., @ref HM10_Clone_Role_resp ). */
+	uint8_t bytes_compared = 0;
+	if (memcmp(TxRx_Buffer, HM10_Clone_Role_resp, role_resp_size_without_role_cr_and_lf) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_ROLE_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+	bytes_compared = role_resp_size_without_role_cr_and_lf;
+	if ((TxRx_Buffer[bytes_compared]!=ble_role) || (memcmp(&TxRx_Buffer[bytes_compared+1], HM10_Clone_CR_LF, sizeof(HM10_Clone_CR_LF)) != 0))
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_ROLE_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+	HM10_CLONE_LOG(HM10_CLONE_EV_ROLE_CMD_DONE);
+
+	return HM10_Clone_EC_OK;
+}
+#endif
+
+#if HM10_CLONE_ROLE_CMDS && HM10_CLONE_GETTER_CMDS
+HM10_Clone_Status get_hm10clone_role(HM10_Clone_Role *ble_role)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if ((ret = cmd_begin_guarded(HM10_Clone_Cmd_Get_Role)) == HM10_Clone_EC_OK)
+	{
+		do
+		{
+			ret = send_get_role_cmd(ble_role); // Get the HM-10 Clone Device's Role.
+		}
+		while (cmd_retry_pending());
+	}
+	cmd_end_guarded(HM10_Clone_Cmd_Get_Role, ret);
+
+	return ret;
+}
+
+static HM10_Clone_Status send_get_role_cmd(HM10_Clone_Role *ble_role)
+{
+	/* Flush the UART's RX before starting. */
+	HAL_uart_rx_flush();
+
+	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
+	int16_t  ret;
+
+	/* Populate the HM-10 Clone Device's Get Role Command into the Tx/Rx Buffer. */
+	HM10_CLONE_LOG(HM10_CLONE_EV_GET_ROLE_CMD_SENDING);
+	cmd_populate(HM10_Clone_Role_cmd, sizeof(HM10_Clone_Role_cmd), NULL, 0);
+
+	/* Send the HM-10 Clone Device's Get Role Command. */
+	ret = HAL_uart_cmd_tx(TxRx_Buffer, HM10_CLONE_GET_ROLE_CMD_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_ROLE_CMD_TX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_ROLE_CMD_TX_FAILED);
+		}
+		return ret;
+	}
+
+	/* Receive the HM-10 Clone Device's Get Role Response. */
+	ret = HAL_uart_cmd_rx(TxRx_Buffer, HM10_CLONE_ROLE_RESPONSE_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_ROLE_RESP_RX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_ROLE_RESP_RX_FAILED, ret);
+		}
+		return ret;
+	}
+
+	/* Validate the HM-10 Clone Device's Get Role Response. */
+	/** <b>Local variable role_resp_size_without_role_cr_and_lf:</b> Size in bytes of the Role Response from the HM-10 Clone BLE device but without considering the length of the role value and without the Carriage Return and New Line bytes. */
+	uint8_t role_resp_size_without_role_cr_and_lf = HM10_CLONE_ROLE_RESPONSE_SIZE - 3;
+	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Role Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Role Response (i.e., @ref HM10_Clone_Role_resp ). */
+	uint8_t bytes_compared = 0;
+	if (memcmp(TxRx_Buffer, HM10_Clone_Role_resp, role_resp_size_without_role_cr_and_lf) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_GET_ROLE_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+	bytes_compared = role_resp_size_without_role_cr_and_lf;
+	switch (TxRx_Buffer[bytes_compared])
+	{
+		case HM10_Clone_Role_Peripheral:
+		case HM10_Clone_Role_Central:
+			break;
+		default:
+			HM10_CLONE_LOG(HM10_CLONE_EV_INVALID_ROLE_RECEIVED, TxRx_Buffer[bytes_compared]);
+			return HM10_Clone_EC_ERR;
+	}
+	bytes_compared++;
+	if (memcmp(&TxRx_Buffer[bytes_compared], HM10_Clone_CR_LF, sizeof(HM10_Clone_CR_LF)) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_ROLE_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+	*ble_role = TxRx_Buffer[role_resp_size_without_role_cr_and_lf];
+
+	HM10_CLONE_LOG(HM10_CLONE_EV_GET_ROLE_DONE);
+
+	return HM10_Clone_EC_OK;
+}
+#endif
+
+#if HM10_CLONE_PIN_CMDS
+HM10_Clone_Status set_hm10clone_pin(uint8_t *pin)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if ((ret = cmd_begin_guarded(HM10_Clone_Cmd_Set_Pin)) == HM10_Clone_EC_OK)
+	{
+		do
+		{
+			ret = send_set_pin_cmd(pin); // Send the HM-10 Clone Device's Pin Command with the desired pin to set in it.
+		}
+		while (cmd_retry_pending());
+		#if HM10_CLONE_POWER_PIN
+			if (ret == HM10_Clone_EC_OK)
+			{
+				config_cache_store(HM10_Clone_Cmd_Set_Pin, pin, HM10_CLONE_PIN_VALUE_SIZE);
+			}
+		#endif
+	}
+	cmd_end_guarded(HM10_Clone_Cmd_Set_Pin, ret);
+
+	return ret;
+}
+
+static HM10_Clone_Status send_set_pin_cmd(uint8_t *pin)
+{
+	/* Flush the UART's RX before starting. */
+	HAL_uart_rx_flush();
+
+	/* Validating given pin. */
+	for (uint8_t current_pin_character=0; current_pin_character<HM10_CLONE_PIN_VALUE_SIZE; current_pin_character++)
+	{
+		switch (pin[current_pin_character])
+		{
+			case Number_0_in_ASCII:
+			case Number_1_in_ASCII:
+			case Number_2_in_ASCII:
+			case Number_3_in_ASCII:
+			case Number_4_in_ASCII:
+			case Number_5_in_ASCII:
+			case Number_6_in_ASCII:
+			case Number_7_in_ASCII:
+			case Number_8_in_ASCII:
+			case Number_9_in_ASCII:
+				break;
+			default:
+				HM10_CLONE_LOG(HM10_CLONE_EV_INVALID_PIN_GIVEN, current_pin_character, pin[current_pin_character]);
+				return HM10_Clone_EC_ERR;
+		}
+	}
+
+	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
+	int16_t  ret;
+
+	/* Populate the HM-10 Clone Device's Pin Command into the Tx/Rx Buffer. */
+	HM10_CLONE_LOG(HM10_CLONE_EV_PIN_CMD_SENDING);
+	cmd_populate(HM10_Clone_Pin_cmd, sizeof(HM10_Clone_Pin_cmd), pin, HM10_CLONE_PIN_VALUE_SIZE);
+
+	/* Send the HM-10 Clone Device's Role Command. */
+	ret = HAL_uart_cmd_tx(TxRx_Buffer, HM10_CLONE_SET_PIN_CMD_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_PIN_CMD_TX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_PIN_CMD_TX_FAILED);
+		}
+		return ret;
+	}
+
+	/* Receive the HM-10 Clone Device's Pin Response. */
+	ret = HAL_uart_cmd_rx(TxRx_Buffer, HM10_CLONE_PIN_RESPONSE_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_PIN_RESP_RX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_PIN_RESP_RX_FAILED, ret);
+		}
+		return ret;
+	}
+
+	/* Validate the HM-10 Clone Device's Pin Response, which must echo the requested pin. */
+	/** <b>Local variable pin_resp_size_without_pin_cr_and_lf:</b> Size in bytes of the Pin Response from the HM-10 Clone BLE device but without considering the length of the pin value and without the Carriage Return and New Line bytes. */
+	uint8_t pin_resp_size_without_pin_cr_and_lf = HM10_CLONE_PIN_RESPONSE_SIZE - HM10_CLONE_PIN_VALUE_SIZE - CR_AND_LF_SIZE;
+	if ((memcmp(TxRx_Buffer, HM10_Clone_Pin_resp, pin_resp_size_without_pin_cr_and_lf) != 0)
+		|| (memcmp(&TxRx_Buffer[pin_resp_size_without_pin_cr_and_lf], pin, HM10_CLONE_PIN_VALUE_SIZE) != 0)
+		|| (memcmp(&TxRx_Buffer[pin_resp_size_without_pin_cr_and_lf + HM10_CLONE_PIN_VALUE_SIZE], HM10_Clone_CR_LF, sizeof(HM10_Clone_CR_LF)) != 0))
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_PIN_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+
+	/* Receive the HM-10 Clone Device's OK Response. */
+	ret = HAL_uart_cmd_rx(TxRx_Buffer, HM10_CLONE_OK_RESPONSE_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_RX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_RX_FAILED, ret);
+		}
+		return ret;
+	}
+
+	/* Validate the HM-10 Clone Device's OK Response. */
+	if (memcmp(TxRx_Buffer, HM10_Clone_OK_resp, HM10_CLONE_OK_RESPONSE_SIZE) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+
+	HM10_CLONE_LOG(HM10_CLONE_EV_PIN_CMD_DONE);
+
+	return HM10_Clone_EC_OK;
+}
+#endif
+
+#if HM10_CLONE_PIN_CMDS && HM10_CLONE_GETTER_CMDS
+HM10_Clone_Status get_hm10clone_pin(uint8_t *pin)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if ((ret = cmd_begin_guarded(HM10_Clone_Cmd_Get_Pin)) == HM10_Clone_EC_OK)
+	{
+		do
+		{
+			ret = send_get_pin_cmd(pin); // Get the HM-10 Clone Device's Pin.
+		}
+		while (cmd_retry_pending());
+	}
+	cmd_end_guarded(HM10_Clone_Cmd_Get_Pin, ret);
+
+	return ret;
+}
+
+static HM10_Clone_Status send_get_pin_cmd(uint8_t *pin)
+{
+	/* Flush the UART's RX before starting. */
+	HAL_uart_rx_flush();
+
+	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
+	int16_t  ret;
+
+	/* Populate the HM-10 Clone Device's Get Pin Command into the Tx/Rx Buffer. */
+	HM10_CLONE_LOG(HM10_CLONE_EV_GET_PIN_CMD_SENDING);
+	cmd_populate(HM10_Clone_Pin_cmd, sizeof(HM10_Clone_Pin_cmd), NULL, 0);
+
+	/* Send the HM-10 Clone Device's Get Pin Command. */
+	ret = HAL_uart_cmd_tx(TxRx_Buffer, HM10_CLONE_GET_PIN_CMD_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_PIN_CMD_TX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_PIN_CMD_TX_FAILED);
+		}
+		return ret;
+	}
+
+	/* Receive the HM-10 Clone Device's Get Pin Response. */
+	ret = HAL_uart_cmd_rx(TxRx_Buffer, HM10_CLONE_PIN_RESPONSE_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_PIN_RESP_RX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_PIN_RESP_RX_FAILED, ret);
+		}
+		return ret;
+	}
+
+	/* Validate the HM-10 Clone Device's Get Pin Response. */
+	/** <b>Local variable pin_resp_size_without_pin_cr_and_lf:</b> Size in bytes of the Pin Response from the HM-10 Clone BLE device but without considering the length of the pin value and without the Carriage Return and New Line bytes. */
+	uint8_t pin_resp_size_without_pin_cr_and_lf = HM10_CLONE_PIN_RESPONSE_SIZE - HM10_CLONE_PIN_VALUE_SIZE - CR_AND_LF_SIZE;
+	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Pin Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Pin Response (i.e., @ref HM10_Clone_Pin_resp ). */
+	uint8_t bytes_compared = 0;
+	if (memcmp(TxRx_Buffer, HM10_Clone_Pin_resp, pin_resp_size_without_pin_cr_and_lf) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_PIN_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+	bytes_compared = pin_resp_size_without_pin_cr_and_lf;
+	for (uint8_t current_pin_character=0; current_pin_character<HM10_CLONE_PIN_VALUE_SIZE; current_pin_character++)
+	{
+		switch (TxRx_Buffer[bytes_compared])
+		{
+			case Number_0_in_ASCII:
+			case Number_1_in_ASCII:
+			case Number_2_in_ASCII:
+			case Number_3_in_ASCII:
+			case Number_4_in_ASCII:
+			case Number_5_in_ASCII:
+			case Number_6_in_ASCII:
+			case Number_7_in_ASCII:
+			case Number_8_in_ASCII:
+			case Number_9_in_ASCII:
+				break;
+			default:
+				HM10_CLONE_LOG(HM10_CLONE_EV_INVALID_PIN_RECEIVED, current_pin_character, TxRx_Buffer[bytes_compared]);
+				return HM10_Clone_EC_ERR;
+		}
+		bytes_compared++;
+	}
+	if (memcmp(&TxRx_Buffer[bytes_compared], HM10_Clone_CR_LF, sizeof(HM10_Clone_CR_LF)) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_PIN_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+
+	/* Pass the BLE Pin from the Buffer that is storing it into the \p pin param. */
+	memcpy(pin, &TxRx_Buffer[pin_resp_size_without_pin_cr_and_lf], HM10_CLONE_PIN_VALUE_SIZE);
+
+	HM10_CLONE_LOG(HM10_CLONE_EV_GET_PIN_DONE);
+
+	return HM10_Clone_EC_OK;
+}
+#endif
+
+#if HM10_CLONE_TYPE_CMDS
+HM10_Clone_Status set_hm10clone_pin_code_mode(HM10_Clone_Pin_Code_Mode pin_code_mode)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if ((ret = cmd_begin_guarded(HM10_Clone_Cmd_Set_Type)) == HM10_Clone_EC_OK)
+	{
+		do
+		{
+			ret = send_set_type_cmd(pin_code_mode); // Send the HM-10 Clone Device's Type Command with the desired pin code mode to set in it.
+		}
+		while (cmd_retry_pending());
+		#if HM10_CLONE_POWER_PIN
+			if (ret == HM10_Clone_EC_OK)
+			{
+				config_cache_store(HM10_Clone_Cmd_Set_Type, (uint8_t []) {pin_code_mode}, 1);
+			}
+		#endif
+	}
+	cmd_end_guarded(HM10_Clone_Cmd_Set_Type, ret);
+
+	return ret;
+}
+
+static HM10_Clone_Status send_set_type_cmd(HM10_Clone_Pin_Code_Mode pin_code_mode)
+{
+	/* Flush the UART's RX before starting. */
+	HAL_uart_rx_flush();
+
+	/* Validating given pin code mode. */
+	switch (pin_code_mode)
+	{
+		case HM10_Clone_Pin_Code_DISABLED:
+		case HM10_Clone_Pin_Code_ENABLED:
+			break;
+		default:
+			HM10_CLONE_LOG(HM10_CLONE_EV_INVALID_PIN_CODE_MODE, pin_code_mode);
+			return HM10_Clone_EC_ERR;
+	}
+
+	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
+	int16_t  ret;
+
+	/** <b>Local variable type:</b> ASCII Code data of the requested pin code mode. */
+	uint8_t type = pin_code_mode;
+
+	/* Populate the HM-10 Clone Device's Type Command into the Tx/Rx Buffer. */
+	HM10_CLONE_LOG(HM10_CLONE_EV_TYPE_CMD_SENDING);
+	cmd_populate(HM10_Clone_Type_cmd, sizeof(HM10_Clone_Type_cmd), &type, 1);
+
+	/* Send the HM-10 Clone Device's Role Command. */
+	ret = HAL_uart_cmd_tx(TxRx_Buffer, HM10_CLONE_SET_TYPE_CMD_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_TYPE_CMD_TX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_TYPE_CMD_TX_FAILED);
+		}
+		return ret;
+	}
+
+	/* Receive the HM-10 Clone Device's Type Response. */
+	ret = HAL_uart_cmd_rx(TxRx_Buffer, HM10_CLONE_TYPE_RESPONSE_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_TYPE_RESP_RX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_TYPE_RESP_RX_FAILED, ret);
+		}
+		return ret;
+	}
+
+	/* Validate the HM-10 Clone Device's Type Response. */
+	/** <b>Local variable type_resp_size_without_pin_cr_and_lf:</b> Size in bytes of the Type Response from the HM-10 Clone BLE device but without considering the length of the Type value and without the Carriage Return and New Line bytes. */
+	uint8_t type_resp_size_without_pin_cr_and_lf = HM10_CLONE_TYPE_RESPONSE_SIZE - 3;
+	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Type Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Type Response (i.e., @ref HM10_Clone_Type_resp ). */
+	uint8_t bytes_compared = 0;
+	if (memcmp(TxRx_Buffer, HM10_Clone_Type_resp, type_resp_size_without_pin_cr_and_lf) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_TYPE_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+	bytes_compared = type_resp_size_without_pin_cr_and_lf;
+	if (TxRx_Buffer[bytes_compared++] != pin_code_mode)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_TYPE_RESP_INVALID_VALUE, bytes_compared-1, TxRx_Buffer[bytes_compared-1], pin_code_mode);
+		return HM10_Clone_EC_ERR;
+	}
+	if (memcmp(&TxRx_Buffer[bytes_compared], HM10_Clone_CR_LF, sizeof(HM10_Clone_CR_LF)) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_TYPE_RESP_INVALID_CR_LF, bytes_compared, bytes_compared+1, TxRx_Buffer[bytes_compared], TxRx_Buffer[bytes_compared+1]);
+		return HM10_Clone_EC_ERR;
+	}
+
+	/* Receive the HM-10 Clone Device's OK Response. */
+	ret = HAL_uart_cmd_rx(TxRx_Buffer, HM10_CLONE_OK_RESPONSE_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_RX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_RX_FAILED, ret);
+		}
+		return ret;
+	}
+
+	/* Validate the HM-10 Clone Device's OK Response. */
+	if (memcmp(TxRx_Buffer, HM10_Clone_OK_resp, HM10_CLONE_OK_RESPONSE_SIZE) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_OK_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+
+	HM10_CLONE_LOG(HM10_CLONE_EV_TYPE_CMD_DONE);
+
+	return HM10_Clone_EC_OK;
+}
+#endif
+
+#if HM10_CLONE_TYPE_CMDS && HM10_CLONE_GETTER_CMDS
+HM10_Clone_Status get_hm10clone_pin_code_mode(HM10_Clone_Pin_Code_Mode *pin_code_mode)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if ((ret = cmd_begin_guarded(HM10_Clone_Cmd_Get_Type)) == HM10_Clone_EC_OK)
+	{
+		do
+		{
+			ret = send_get_type_cmd(pin_code_mode); // Get the HM-10 Clone Device's Pin Code Mode.
+		}
+		while (cmd_retry_pending());
+	}
+	cmd_end_guarded(HM10_Clone_Cmd_Get_Type, ret);
+
+	return ret;
+}
+
+static HM10_Clone_Status send_get_type_cmd(HM10_Clone_Pin_Code_Mode *pin_code_mode)
+{
+	/* Flush the UART's RX before starting. */
+	HAL_uart_rx_flush();
+
+	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
+	int16_t  ret;
+
+	/* Populate the HM-10 Clone Device's Get Type Command into the Tx/Rx Buffer. */
+	HM10_CLONE_LOG(HM10_CLONE_EV_GET_TYPE_CMD_SENDING);
+	cmd_populate(HM10_Clone_Type_cmd, sizeof(HM10_Clone_Type_cmd), NULL, 0);
+
+	/* Send the HM-10 Clone Device's Get Type Command. */
+	ret = HAL_uart_cmd_tx(TxRx_Buffer, HM10_CLONE_GET_TYPE_CMD_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_TYPE_CMD_TX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_TYPE_CMD_TX_FAILED);
+		}
+		return ret;
+	}
+
+	/* Receive the HM-10 Clone Device's Get Type Response. */
+	ret = HAL_uart_cmd_rx(TxRx_Buffer, HM10_CLONE_TYPE_RESPONSE_SIZE);
+	if (ret != HAL_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_TYPE_RESP_RX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_GET_TYPE_RESP_RX_FAILED, ret);
+		}
+		return ret;
+	}
+
+	/* Validate the HM-10 Clone Device's Get Type Response. */
+	/** <b>Local variable type_resp_size_without_type_cr_and_lf:</b> Size in bytes of the Type Response from the HM-10 Clone BLE device but without considering the length of the Type value and without the Carriage Return and New Line bytes. */
+	uint8_t type_resp_size_without_type_cr_and_lf = HM10_CLONE_TYPE_RESPONSE_SIZE - 3;
+	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Type Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Type Response (i.e., @ref HM10_Clone_Type_resp ). */
+	uint8_t bytes_compared = 0;
+	if (memcmp(TxRx_Buffer, HM10_Clone_Type_resp, type_resp_size_without_type_cr_and_lf) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_TYPE_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+	bytes_compared = type_resp_size_without_type_cr_and_lf;
+	switch (TxRx_Buffer[bytes_compared])
+	{
+		case HM10_Clone_Pin_Code_DISABLED:
+		case HM10_Clone_Pin_Code_ENABLED:
+			break;
+		default:
+			HM10_CLONE_LOG(HM10_CLONE_EV_INVALID_PIN_CODE_MODE, TxRx_Buffer[bytes_compared]);
+			return HM10_Clone_EC_ERR;
+	}
+	bytes_compared++;
+	if (memcmp(&TxRx_Buffer[bytes_compared], HM10_Clone_CR_LF, sizeof(HM10_Clone_CR_LF)) != 0)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_TYPE_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+
+	/* Pass the BLE Pin Code Mode from the Buffer that is storing it into the \p pin_code_mode param. */
+	*pin_code_mode = TxRx_Buffer[type_resp_size_without_type_cr_and_lf];
+
+	HM10_CLONE_LOG(HM10_CLONE_EV_GET_PIN_CODE_MODE_DONE);
+
+	return HM10_Clone_EC_OK;
+}
+#endif
+
+HM10_Clone_Status send_hm10clone_ota_data(uint8_t *ble_ota_data, uint16_t size, uint32_t timeout)
+{
+	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
+	int16_t  ret;
+
+	#if HM10_CLONE_OTA_BENCHMARK
+		/** <b>Local variable start_cycles:</b> Value of @ref HM10_CLONE_OTA_BENCHMARK_CLOCK at the beginning of this call. */
+		uint32_t start_cycles = HM10_CLONE_OTA_BENCHMARK_CLOCK();
+	#endif
+
+	/* Send the requested data Over the Air (OTA) via the HM-10 Clone BLE Device. */
+	module_lock();
+	if (transaction_holds_uart())
+	{
+		ret = HM10_Clone_EC_BUSY;
+	}
+	else
+	{
+		#if HM10_CLONE_TX_COALESCING
+			ret = coalesce_write(ble_ota_data, size, timeout);
+		#else
+			ret = HAL_uart_ota_tx(ble_ota_data, size, timeout);
+		#endif
+	}
+	#if HM10_CLONE_OTA_BENCHMARK
+		ota_benchmark_record(&ota_benchmark.path[HM10_Clone_OTA_TX], size, ret, HM10_CLONE_OTA_BENCHMARK_CLOCK() - start_cycles);
+	#endif
+	#if HM10_CLONE_STATS
+		if (ret == HM10_Clone_EC_NR)
+		{
+			stats.link.ota_tx_timeouts++;
+		}
+	#endif
+	module_unlock();
+
+	if (ret == HM10_Clone_EC_OK)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_OTA_TX_DONE, size);
+	}
+	else
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_OTA_TX_FAILED, size, ret);
+	}
+
+	return ret;
+}
+
+HM10_Clone_Status send_hm10clone_ota_data_vectored(const HM10_Clone_Tx_Segment *segments, uint8_t segments_count, uint32_t timeout)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret = HM10_Clone_EC_OK;
+	/** <b>Local variable sent:</b> Total number of bytes that have been sent. */
+	uint32_t sent = 0;
+	/** <b>Local variable packet_size:</b> Number of bytes that have been sent in the current packet. */
+	uint8_t packet_size = 0;
+	/** <b>Local variable start_tick:</b> HAL Tick at which the transmission was started. */
+	uint32_t start_tick = HAL_GetTick();
+
+	#if HM10_CLONE_OTA_BENCHMARK
+		/** <b>Local variable start_cycles:</b> Value of @ref HM10_CLONE_OTA_BENCHMARK_CLOCK at the beginning of this call. */
+		uint32_t start_cycles = HM10_CLONE_OTA_BENCHMARK_CLOCK();
+	#endif
+
+	/* Stream the segments back to back, so that each packet is filled regardless of the boundaries of the segments. */
+	module_lock();
+	if (transaction_holds_uart())
+	{
+		ret = HM10_Clone_EC_BUSY;
+	}
+	#if HM10_CLONE_TX_COALESCING
+		else
+		{
+			ret = coalesce_flush(timeout);
+		}
+	#endif
+	for (uint8_t segment=0; (segment<segments_count) && (ret==HM10_Clone_EC_OK); segment++)
+	{
+		/** <b>Local variable offset:</b> Number of bytes of the current segment that have been sent. */
+		uint16_t offset = 0;
+		while ((offset < segments[segment].size) && (ret == HM10_Clone_EC_OK))
+		{
+			/** <b>Local variable chunk_size:</b> Number of bytes of the current segment that fit into the current packet. */
+			uint16_t chunk_size = segments[segment].size - offset;
+			/** <b>Local variable elapsed:</b> Time in milliseconds that has elapsed since the transmission was started. */
+			uint32_t elapsed = HAL_GetTick() - start_tick;
+
+			if (chunk_size > (HM10_CLONE_MAX_PACKET_SIZE - packet_size))
+			{
+				chunk_size = HM10_CLONE_MAX_PACKET_SIZE - packet_size;
+			}
+			if ((timeout != HAL_MAX_DELAY) && (elapsed >= timeout))
+			{
+				ret = HM10_Clone_EC_NR;
+				break;
+			}
+			ret = HAL_uart_ota_tx((uint8_t *) &segments[segment].data[offset], chunk_size, (timeout == HAL_MAX_DELAY) ? HAL_MAX_DELAY : (timeout - elapsed));
+			if (ret == HM10_Clone_EC_OK)
+			{
+				offset += chunk_size;
+				sent += chunk_size;
+				packet_size = (packet_size + chunk_size) % HM10_CLONE_MAX_PACKET_SIZE;
+			}
+		}
+	}
+	#if HM10_CLONE_OTA_BENCHMARK
+		ota_benchmark_record(&ota_benchmark.path[HM10_Clone_OTA_TX], sent, ret, HM10_CLONE_OTA_BENCHMARK_CLOCK() - start_cycles);
+	#endif
+	#if HM10_CLONE_STATS
+		if (ret == HM10_Clone_EC_NR)
+		{
+			stats.link.ota_tx_timeouts++;
+		}
+	#endif
+	module_unlock();
+
+	if (ret == HM10_Clone_EC_OK)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_OTA_TX_DONE, sent);
+	}
+	else
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_OTA_TX_FAILED, sent, ret);
+	}
+
+	return ret;
+}
+
+#if HM10_CLONE_TX_COALESCING
+HM10_Clone_Status flush_hm10clone_ota_data(uint32_t timeout)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	module_lock();
+	ret = transaction_holds_uart() ? HM10_Clone_EC_BUSY : coalesce_flush(timeout);
+	module_unlock();
+
+	return ret;
+}
+
+HM10_Clone_Status poll_hm10clone_ota_tx(uint32_t timeout)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret = HM10_Clone_EC_OK;
+
+	module_lock();
+	if ((tx_coalesce_size > 0) && ((HAL_GetTick() - tx_coalesce_start_tick) >= HM10_CLONE_TX_COALESCING_DELAY_MS))
+	{
+		ret = transaction_holds_uart() ? HM10_Clone_EC_BUSY : coalesce_flush(timeout);
+	}
+	module_unlock();
+
+	return ret;
+}
+#endif
+
+HM10_Clone_Status get_hm10clone_ota_data(uint8_t *ble_ota_data, uint16_t size, uint32_t timeout)
+{
+	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
+	int16_t  ret;
+
+	#if HM10_CLONE_OTA_BENCHMARK
+		/** <b>Local variable start_cycles:</b> Value of @ref HM10_CLONE_OTA_BENCHMARK_CLOCK at the beginning of this call. */
+		uint32_t start_cycles = HM10_CLONE_OTA_BENCHMARK_CLOCK();
+	#endif
+
+	/* Receive the HM-10 Clone Device's BLE data that is received Over the Air (OTA), if there is any. */
+	module_lock();
+	ret = transaction_holds_uart() ? HM10_Clone_EC_BUSY : HAL_uart_rx(ble_ota_data, size, timeout);
+	#if HM10_CLONE_OTA_BENCHMARK
+		ota_benchmark_record(&ota_benchmark.path[HM10_Clone_OTA_RX], size, ret, HM10_CLONE_OTA_BENCHMARK_CLOCK() - start_cycles);
+	#endif
+	#if HM10_CLONE_STATS
+		if (ret == HM10_Clone_EC_OK)
+		{
+			stats.link.ota_rx_bytes += size;
+		}
+		else if (ret == HM10_Clone_EC_NR)
+		{
+			stats.link.ota_rx_timeouts++;
+		}
+	#endif
+	module_unlock();
+
+	if (ret == HM10_Clone_EC_OK)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_OTA_RX_DONE, size);
+	}
+	else if (ret == HM10_Clone_EC_ERR)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_OTA_RX_FAILED, size, ret);
+	}
+
+	return ret;
+}
+
+#if HM10_CLONE_CENTRAL_API
+HM10_Clone_Status scan_hm10clone_devices(uint32_t timeout, HM10_Clone_Scan_Callback callback, uint8_t *devices_found)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if ((ret = cmd_begin_guarded(HM10_Clone_Cmd_Scan)) == HM10_Clone_EC_OK)
+	{
+		do
+		{
+			ret = send_scan_cmd(timeout, callback, devices_found); // Send the HM-10 Clone Device's Scan Command and parse its Responses.
+		}
+		while (cmd_retry_pending());
+	}
+	cmd_end_guarded(HM10_Clone_Cmd_Scan, ret);
+
+	return ret;
+}
+
+static HM10_Clone_Status send_scan_cmd(uint32_t timeout, HM10_Clone_Scan_Callback callback, uint8_t *devices_found)
+{
+	/* Flush the UART's RX before starting. */
+	HAL_uart_rx_flush();
+
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+	/** <b>Local variable parser:</b> Incremental parser of the Scan Responses. */
+	Line_Parser parser;
+	/** <b>Local variable start_tick:</b> HAL Tick at which the scan was started. */
+	uint32_t start_tick;
+	/** <b>Local variable cmd_size:</b> Length in bytes of the Scan Command, including its Carriage Return and New Line characters. */
+	const uint8_t cmd_size = sizeof(HM10_CLONE_SCAN_CMD) - 1 + CR_AND_LF_SIZE;
+
+	/* Populate the HM-10 Clone Device's Scan Command into the Tx/Rx Buffer. */
+	HM10_CLONE_LOG(HM10_CLONE_EV_SCAN_CMD_SENDING);
+	*devices_found = 0;
+	memcpy(TxRx_Buffer, HM10_CLONE_SCAN_CMD, cmd_size - CR_AND_LF_SIZE);
+	TxRx_Buffer[cmd_size - 2] = '\r';
+	TxRx_Buffer[cmd_size - 1] = '\n';
+
+	/* Send the HM-10 Clone Device's Scan Command. */
+	ret = HAL_uart_cmd_tx(TxRx_Buffer, cmd_size);
+	if (ret != HM10_Clone_EC_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_SCAN_CMD_TX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_SCAN_CMD_TX_FAILED);
+		}
+		return ret;
+	}
+
+	/* Parse the HM-10 Clone Device's Scan Responses as they arrive, until the scan concludes. */
+	line_parser_reset(&parser);
+	start_tick = HAL_GetTick();
+	do
+	{
+		/** <b>Local variable elapsed:</b> Time in milliseconds that has elapsed since the scan was started. */
+		uint32_t elapsed = HAL_GetTick() - start_tick;
+		/** <b>Local variable address:</b> Address of the BLE Device of the current Response line. */
+		uint8_t address[HM10_CLONE_BLE_ADDRESS_SIZE];
+		/** <b>Local variable prefix_size:</b> Length in bytes of the prefix of the Scan Result Responses. */
+		const uint8_t prefix_size = sizeof(HM10_CLONE_SCAN_RESULT_PREFIX) - 1;
+
+		ret = (elapsed < timeout) ? receive_line(&parser, timeout - elapsed) : HM10_Clone_EC_NR;
+		if (ret == HM10_Clone_EC_NR)
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_SCAN_TIMEOUT, *devices_found);
+			return ret;
+		}
+		if (ret != HM10_Clone_EC_OK)
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_SCAN_RESP_RX_FAILED, ret);
+			return ret;
+		}
+
+		if (line_starts_with(&parser, HM10_CLONE_SCAN_END_PREFIX))
+		{
+			break;
+		}
+		if (line_starts_with(&parser, HM10_CLONE_SCAN_RESULT_PREFIX)
+			&& parse_ble_address(&parser.line[prefix_size], parser.size - prefix_size, address))
+		{
+			/** <b>Local variable result:</b> Entry of the scan cache of the discovered BLE Device. */
+			const HM10_Clone_Scan_Result *result = scan_cache_update(address);
+			(*devices_found)++;
+			HM10_CLONE_LOG(HM10_CLONE_EV_SCAN_DEVICE_FOUND, (address[0] << 8) | address[1], (address[2] << 8) | address[3], (address[4] << 8) | address[5]);
+			if (callback != NULL)
+			{
+				callback(result);
+			}
+		}
+	}
+	while (1);
+	HM10_CLONE_LOG(HM10_CLONE_EV_SCAN_DONE, *devices_found);
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status get_hm10clone_scan_cache(HM10_Clone_Scan_Result *results, uint8_t max_results, uint32_t max_age, uint8_t *results_count)
+{
+	/** <b>Local variable now:</b> Current HAL Tick. */
+	uint32_t now = HAL_GetTick();
+
+	module_lock();
+	*results_count = 0;
+	for (uint8_t i=0; i<scan_cache_count; i++)
+	{
+		/** <b>Local variable age:</b> Time in milliseconds since the current entry was last seen. */
+		uint32_t age = now - scan_cache[i].last_seen_tick;
+		/** <b>Local variable position:</b> Index of the \p results param at which the current entry is inserted. */
+		uint8_t position = *results_count;
+
+		if ((max_age != HAL_MAX_DELAY) && (age > max_age))
+		{
+			continue;
+		}
+
+		/* Insert the current entry sorted from the most recently seen one to the least recently seen one. */
+		while ((position > 0) && ((now - results[position - 1].last_seen_tick) > age))
+		{
+			if (position < max_results)
+			{
+				results[position] = results[position - 1];
+			}
+			position--;
+		}
+		if (position < max_results)
+		{
+			results[position] = scan_cache[i];
+			if (*results_count < max_results)
+			{
+				(*results_count)++;
+			}
+		}
+	}
+	module_unlock();
+
+	return (*results_count > 0) ? HM10_Clone_EC_OK : HM10_Clone_EC_NR;
+}
+
+HM10_Clone_Status clear_hm10clone_scan_cache()
+{
+	module_lock();
+	scan_cache_count = 0;
+	module_unlock();
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status connect_hm10clone_device(const uint8_t address[HM10_CLONE_BLE_ADDRESS_SIZE], uint32_t timeout, uint32_t *connect_time)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if ((ret = cmd_begin_guarded(HM10_Clone_Cmd_Connect)) == HM10_Clone_EC_OK)
+	{
+		do
+		{
+			ret = send_connect_cmd(address, timeout, connect_time); // Send the HM-10 Clone Device's Connect Command and wait for the connection.
+		}
+		while (cmd_retry_pending());
+	}
+	cmd_end_guarded(HM10_Clone_Cmd_Connect, ret);
+
+	return ret;
+}
+
+static HM10_Clone_Status send_connect_cmd(const uint8_t address[HM10_CLONE_BLE_ADDRESS_SIZE], uint32_t timeout, uint32_t *connect_time)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+	/** <b>Local variable cmd:</b> Connect Command, which does not fit into the @ref TxRx_Buffer . */
+	uint8_t cmd[sizeof(HM10_CLONE_CONNECT_CMD) - 1 + sizeof(HM10_CLONE_CONNECT_ADDRESS_PREFIX) - 1 + HM10_CLONE_BLE_ADDRESS_SIZE*2 + 2];
+	/** <b>Local variable cmd_size:</b> Length in bytes of the Connect Command that has been populated. */
+	uint8_t cmd_size = 0;
+	/** <b>Local variable hex_digits:</b> ASCII Code of each hexadecimal digit. */
+	static const char hex_digits[] = "0123456789ABCDEF";
+	/** <b>Local variable start_tick:</b> HAL Tick at which the Connect Command started to be sent. */
+	uint32_t start_tick;
+
+	*connect_time = 0;
+	if (!state_pin_set)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_STATE_PIN_NOT_SET);
+		return HM10_Clone_EC_ERR;
+	}
+	if (state_pin_connected())
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_ALREADY_CONNECTED);
+		return HM10_Clone_EC_OK;
+	}
+
+	/* Flush the UART's RX before starting. */
+	HAL_uart_rx_flush();
+
+	/* Populate the HM-10 Clone Device's Connect Command with the requested address. */
+	HM10_CLONE_LOG(HM10_CLONE_EV_CONNECT_CMD_SENDING);
+	memcpy(&cmd[cmd_size], HM10_CLONE_CONNECT_CMD, sizeof(HM10_CLONE_CONNECT_CMD) - 1);
+	cmd_size += sizeof(HM10_CLONE_CONNECT_CMD) - 1;
+	memcpy(&cmd[cmd_size], HM10_CLONE_CONNECT_ADDRESS_PREFIX, sizeof(HM10_CLONE_CONNECT_ADDRESS_PREFIX) - 1);
+	cmd_size += sizeof(HM10_CLONE_CONNECT_ADDRESS_PREFIX) - 1;
+	for (uint8_t i=0; i<HM10_CLONE_BLE_ADDRESS_SIZE; i++)
+	{
+		cmd[cmd_size++] = hex_digits[address[i] >> 4];
+		cmd[cmd_size++] = hex_digits[address[i] & 0x0F];
+	}
+	cmd[cmd_size++] = '\r';
+	cmd[cmd_size++] = '\n';
+
+	/* Send the HM-10 Clone Device's Connect Command. */
+	start_tick = HAL_GetTick();
+	ret = HAL_uart_cmd_tx(cmd, cmd_size);
+	if (ret != HM10_Clone_EC_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_CONNECT_CMD_TX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_CONNECT_CMD_TX_FAILED);
+		}
+		return ret;
+	}
+
+	/* Wait for the STATE pin to go high, which is when the connection has been established. */
+	while (!state_pin_connected())
+	{
+		if ((HAL_GetTick() - start_tick) >= timeout)
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_CONNECT_TIMEOUT, timeout);
+			return HM10_Clone_EC_NR;
+		}
+		#if HM10_CLONE_RTOS
+			module_delay(1); // Let the other tasks run while waiting.
+		#endif
+	}
+	*connect_time = HAL_GetTick() - start_tick;
+	HM10_CLONE_LOG(HM10_CLONE_EV_CONNECT_DONE, *connect_time);
+
+	/* Discard the connection Responses so that they are not mistaken for the OTA data that follows. */
+	HAL_uart_rx_flush();
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status set_hm10clone_auto_reconnect(uint8_t enable)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if ((ret = cmd_begin_guarded(HM10_Clone_Cmd_Set_Auto_Reconnect)) == HM10_Clone_EC_OK)
+	{
+		do
+		{
+			ret = send_auto_reconnect_cmd(enable); // Send the HM-10 Clone Device's Auto-Reconnect Command.
+		}
+		while (cmd_retry_pending());
+	}
+	cmd_end_guarded(HM10_Clone_Cmd_Set_Auto_Reconnect, ret);
+
+	return ret;
+}
+
+static HM10_Clone_Status send_auto_reconnect_cmd(uint8_t enable)
+{
+	/* Flush the UART's RX before starting. */
+	HAL_uart_rx_flush();
+
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+	/** <b>Local variable parser:</b> Incremental parser of the Auto-Reconnect Response. */
+	Line_Parser parser;
+	/** <b>Local variable cmd:</b> Auto-Reconnect Command without its Carriage Return and New Line characters. */
+	const char *cmd = enable ? HM10_CLONE_AUTO_RECONNECT_ON_CMD : HM10_CLONE_AUTO_RECONNECT_OFF_CMD;
+	/** <b>Local variable cmd_size:</b> Length in bytes of the Auto-Reconnect Command, including its Carriage Return and New Line characters. */
+	uint8_t cmd_size = strlen(cmd) + CR_AND_LF_SIZE;
+
+	if (cmd_size > HM10_CLONE_MAX_AT_COMMAND_SIZE)
+	{
+		return HM10_Clone_EC_ERR;
+	}
+
+	/* Populate the HM-10 Clone Device's Auto-Reconnect Command into the Tx/Rx Buffer. */
+	HM10_CLONE_LOG(HM10_CLONE_EV_AUTO_RECONNECT_CMD_SENDING);
+	memcpy(TxRx_Buffer, cmd, cmd_size - CR_AND_LF_SIZE);
+	TxRx_Buffer[cmd_size - 2] = '\r';
+	TxRx_Buffer[cmd_size - 1] = '\n';
+
+	/* Send the HM-10 Clone Device's Auto-Reconnect Command. */
+	ret = HAL_uart_cmd_tx(TxRx_Buffer, cmd_size);
+	if (ret != HM10_Clone_EC_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_AUTO_RECONNECT_CMD_TX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_AUTO_RECONNECT_CMD_TX_FAILED);
+		}
+		return ret;
+	}
+
+	/* Receive the HM-10 Clone Device's Response line. */
+	line_parser_reset(&parser);
+	ret = receive_line(&parser, cmd_rx_timeout(current_cmd, HM10_CLONE_MAX_LINE_SIZE));
+	if (ret != HM10_Clone_EC_OK)
+	{
+		if (cmd_retry(ret))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_AUTO_RECONNECT_RESP_RX_RETRY, resp_attempts + 1);
+		}
+		else
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_AUTO_RECONNECT_RESP_RX_FAILED, ret);
+		}
+		return ret;
+	}
+
+	/* Validate the HM-10 Clone Device's Response. */
+	if (!line_starts_with(&parser, HM10_CLONE_AUTO_RECONNECT_RESP_PREFIX))
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_AUTO_RECONNECT_RESP_INVALID);
+		return HM10_Clone_EC_ERR;
+	}
+	HM10_CLONE_LOG(HM10_CLONE_EV_AUTO_RECONNECT_CMD_DONE, enable);
+
+	return HM10_Clone_EC_OK;
+}
+
+static HM10_Clone_Status receive_line(Line_Parser *parser, uint32_t timeout)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+	/** <b>Local variable byte:</b> Byte that was received last. */
+	uint8_t byte;
+	/** <b>Local variable start_tick:</b> HAL Tick at which the reception of the line was started. */
+	uint32_t start_tick = HAL_GetTick();
+
+	do
+	{
+		/** <b>Local variable elapsed:</b> Time in milliseconds that has elapsed since the reception was started. */
+		uint32_t elapsed = HAL_GetTick() - start_tick;
+		if (elapsed >= timeout)
+		{
+			return HM10_Clone_EC_NR;
+		}
+		ret = HAL_uart_rx(&byte, 1, timeout - elapsed);
+		if (ret != HM10_Clone_EC_OK)
+		{
+			return ret;
+		}
+	}
+	while (!line_parser_feed(parser, byte));
+
+	return HM10_Clone_EC_OK;
+}
+
+static void line_parser_reset(Line_Parser *parser)
+{
+	parser->size = 0;
+	parser->overflow = 0;
+}
+
+static uint8_t line_parser_feed(Line_Parser *parser, uint8_t byte)
+{
+	/* Start a new line whenever the previous one was concluded by the last byte that was fed. */
+	if (parser->overflow > 1)
+	{
+		line_parser_reset(parser);
+	}
+
+	switch (byte)
+	{
+		case '\r':
+			return 0;
+		case '\n':
+			if (parser->overflow)
+			{
+				HM10_CLONE_LOG(HM10_CLONE_EV_LINE_TOO_LONG, HM10_CLONE_MAX_LINE_SIZE);
+				line_parser_reset(parser);
+				return 0;
+			}
+			parser->overflow = 2; // Mark the line as concluded so that it is cleared with the next byte.
+			return (parser->size > 0);
+		default:
+			if (parser->size < HM10_CLONE_MAX_LINE_SIZE)
+			{
+				parser->line[parser->size++] = byte;
+			}
+			else
+			{
+				parser->overflow = 1;
+			}
+			return 0;
+	}
+}
+
+static uint8_t line_starts_with(const Line_Parser *parser, const char *prefix)
+{
+	/** <b>Local variable prefix_size:</b> Length in bytes of the \p prefix param. */
+	size_t prefix_size = strlen(prefix);
+
+	return (parser->size >= prefix_size) && (memcmp(parser->line, prefix, prefix_size) == 0);
+}
+
+static uint8_t parse_ble_address(const uint8_t *text, uint8_t size, uint8_t address[HM10_CLONE_BLE_ADDRESS_SIZE])
+{
+	/** <b>Local variable digits:</b> Number of consecutive hexadecimal digits that have been found. */
+	uint8_t digits = 0;
+
+	for (uint8_t i=0; i<size; i++)
+	{
+		/** <b>Local variable nibble:</b> Value of the current hexadecimal digit. */
+		uint8_t nibble;
+
+		if ((text[i] >= '0') && (text[i] <= '9'))
+		{
+			nibble = text[i] - '0';
+		}
+		else if ((text[i] >= 'A') && (text[i] <= 'F'))
+		{
+			nibble = text[i] - 'A' + 10;
+		}
+		else if ((text[i] >= 'a') && (text[i] <= 'f'))
+		{
+			nibble = text[i] - 'a' + 10;
+		}
+		else
+		{
+			digits = 0; // The address must be given by consecutive digits (e.g., this skips the "0x" prefix).
+			continue;
+		}
+
+		if ((digits & 1) == 0)
+		{
+			address[digits / 2] = nibble << 4;
+		}
+		else
+		{
+			address[digits / 2] |= nibble;
+		}
+		if (++digits == (HM10_CLONE_BLE_ADDRESS_SIZE * 2))
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static const HM10_Clone_Scan_Result *scan_cache_update(const uint8_t address[HM10_CLONE_BLE_ADDRESS_SIZE])
+{
+	/** <b>Local variable now:</b> Current HAL Tick. */
+	uint32_t now = HAL_GetTick();
+	/** <b>Local variable entry:</b> Index of the @ref scan_cache entry of the discovered BLE Device. */
+	uint8_t entry = 0;
+
+	for (uint8_t i=0; i<scan_cache_count; i++)
+	{
+		if (memcmp(scan_cache[i].address, address, HM10_CLONE_BLE_ADDRESS_SIZE) == 0)
+		{
+			scan_cache[i].last_seen_tick = now;
+			return &scan_cache[i];
+		}
+		if ((now - scan_cache[i].last_seen_tick) > (now - scan_cache[entry].last_seen_tick))
+		{
+			entry = i;
+		}
+	}
+
+	/* Append the BLE Device, or replace the least recently seen one whenever the cache is full. */
+	if (scan_cache_count < HM10_CLONE_SCAN_CACHE_SIZE)
+	{
+		entry = scan_cache_count++;
+	}
+	memcpy(scan_cache[entry].address, address, HM10_CLONE_BLE_ADDRESS_SIZE);
+	scan_cache[entry].last_seen_tick = now;
+
+	return &scan_cache[entry];
+}
+#endif
+
+#if HM10_CLONE_ZERO_COPY_RX
+HM10_Clone_Status start_hm10clone_rx_stream()
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if ((p_huart->hdmarx == NULL) || (p_huart->hdmarx->Init.Mode != DMA_CIRCULAR))
+	{
+		return HM10_Clone_EC_ERR;
+	}
+
+	module_lock();
+	rx_ring_read = 0;
+	rx_ring_halves = 0;
+	ret = HAL_ret_handler(HAL_UART_Receive_DMA(p_huart, rx_ring, HM10_CLONE_RX_RING_SIZE));
+	rx_stream_active = (ret == HM10_Clone_EC_OK);
+	module_unlock();
+
+	return ret;
+}
+
+HM10_Clone_Status stop_hm10clone_rx_stream()
+{
+	module_lock();
+	if (rx_stream_active)
+	{
+		HAL_UART_AbortReceive(p_huart);
+		rx_stream_active = 0;
+	}
+	module_unlock();
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status peek_hm10clone_rx_data(HM10_Clone_Rx_Span spans[HM10_CLONE_RX_MAX_SPANS], uint8_t *spans_count)
+{
+	/** <b>Local variable available:</b> Number of readable bytes of the @ref rx_ring . */
+	uint16_t available;
+	/** <b>Local variable tail:</b> Index of the oldest byte of the @ref rx_ring that has not been committed yet. */
+	uint16_t tail = rx_ring_read & (HM10_CLONE_RX_RING_SIZE - 1);
+	/** <b>Local variable first_span_size:</b> Number of readable bytes from the tail up to the end of the @ref rx_ring . */
+	uint16_t first_span_size;
+
+	*spans_count = 0;
+	if ((!rx_stream_active) || (rx_ring_available(&available) != HM10_Clone_EC_OK))
+	{
+		return HM10_Clone_EC_ERR;
+	}
+	if (available == 0)
+	{
+		return HM10_Clone_EC_NR;
+	}
+
+	/* Give the readable bytes up to the end of the ring buffer, followed by the ones that wrapped around, if any. */
+	first_span_size = HM10_CLONE_RX_RING_SIZE - tail;
+	if (first_span_size > available)
+	{
+		first_span_size = available;
+	}
+	spans[0].data = &rx_ring[tail];
+	spans[0].size = first_span_size;
+	*spans_count = 1;
+	if (available > first_span_size)
+	{
+		spans[1].data = rx_ring;
+		spans[1].size = available - first_span_size;
+		*spans_count = 2;
+	}
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status commit_hm10clone_rx_data(uint16_t size)
+{
+	/** <b>Local variable available:</b> Number of readable bytes of the @ref rx_ring . */
+	uint16_t available;
+
+	/* An overrun at this point means that the bytes that were parsed in place might have been overwritten meanwhile. */
+	if ((!rx_stream_active) || (rx_ring_available(&available) != HM10_Clone_EC_OK) || (size > available))
+	{
+		return HM10_Clone_EC_ERR;
+	}
+	rx_ring_read += size;
+
+	#if HM10_CLONE_STATS
+		stats.link.ota_rx_bytes += size;
+	#endif
+	HM10_CLONE_LOG(HM10_CLONE_EV_OTA_RX_DONE, size);
+
+	return HM10_Clone_EC_OK;
+}
+
+static uint32_t rx_ring_written()
+{
+	/** <b>Local variable halves:</b> Number of halves of the @ref rx_ring that the DMA callbacks have counted. */
+	uint32_t halves;
+	/** <b>Local variable head:</b> Index of the @ref rx_ring at which the DMA will write the next received byte. */
+	uint16_t head;
+	/** <b>Local variable upper_half:</b> Flag that indicates whether the \c head local variable is in the upper half of the @ref rx_ring . */
+	uint32_t upper_half;
+
+	/* Read the DMA counter between two equal reads of the halves, so that both belong to the same half. */
+	do
+	{
+		halves = rx_ring_halves;
+		/* The DMA counter gives the number of bytes that remain until the DMA wraps around to the start of the ring buffer. */
+		head = (HM10_CLONE_RX_RING_SIZE - __HAL_DMA_GET_COUNTER(p_huart->hdmarx)) & (HM10_CLONE_RX_RING_SIZE - 1);
+	} while (halves != rx_ring_halves);
+
+	/* Whenever the DMA has just entered another half whose callback has not been handled yet, count it already. */
+	upper_half = (head >= (HM10_CLONE_RX_RING_SIZE / 2));
+	if (upper_half != (halves & 1))
+	{
+		halves++;
+	}
+
+	return (halves - upper_half) * (HM10_CLONE_RX_RING_SIZE / 2) + head;
+}
+
+static HM10_Clone_Status rx_ring_available(uint16_t *available)
+{
+	/** <b>Local variable unread:</b> Number of bytes that have been written into the @ref rx_ring and that have not been committed yet. */
+	uint32_t unread;
+	/** <b>Local variable written:</b> Number of bytes that have been written into the @ref rx_ring . */
+	uint32_t written = rx_ring_written();
+
+	unread = written - rx_ring_read;
+	if (unread > HM10_CLONE_RX_RING_SIZE)
+	{
+		#if HM10_CLONE_STATS
+			stats.link.rx_overruns++;
+		#endif
+		HM10_CLONE_LOG(HM10_CLONE_EV_RX_OVERRUN, unread - HM10_CLONE_RX_RING_SIZE);
+		rx_ring_read = written;
+		*available = 0;
+		return HM10_Clone_EC_ERR;
+	}
+	*available = unread;
+
+	return HM10_Clone_EC_OK;
+}
+#endif
+
+#if HM10_CLONE_RPC || HM10_CLONE_MUX || HM10_CLONE_PING
+uint8_t update_hm10clone_crc8(uint8_t crc, uint8_t byte)
+{
+	crc ^= byte;
+	for (uint8_t bit=0; bit<8; bit++)
+	{
+		crc = (crc & 0x80) ? ((crc << 1) ^ 0x07) : (crc << 1);
+	}
+
+	return crc;
+}
+
+HM10_Clone_Status drain_hm10clone_ota_data(HM10_Clone_Rx_Feed feed)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	#if HM10_CLONE_ZERO_COPY_RX
+		/** <b>Local variable spans:</b> Readable spans of the RX ring buffer. */
+		HM10_Clone_Rx_Span spans[HM10_CLONE_RX_MAX_SPANS];
+		/** <b>Local variable spans_count:</b> Number of valid entries of the \c spans local variable. */
+		uint8_t spans_count;
+		/** <b>Local variable consumed:</b> Number of bytes of the RX ring buffer that were fed. */
+		uint16_t consumed = 0;
+
+		ret = peek_hm10clone_rx_data(spans, &spans_count);
+		if (ret == HM10_Clone_EC_ERR)
+		{
+			return ret;
+		}
+		for (uint8_t span=0; span<spans_count; span++)
+		{
+			for (uint16_t i=0; i<spans[span].size; i++)
+			{
+				feed(spans[span].data[i]);
+			}
+			consumed += spans[span].size;
+		}
+		if (consumed > 0)
+		{
+			commit_hm10clone_rx_data(consumed);
+		}
+	#else
+		/** <b>Local variable byte:</b> Byte that was received last. */
+		uint8_t byte;
+
+		while ((ret = ota_rx_nowait(&byte)) == HM10_Clone_EC_OK)
+		{
+			feed(byte);
+		}
+		if (ret == HM10_Clone_EC_ERR)
+		{
+			return ret;
+		}
+	#endif
+
+	return HM10_Clone_EC_OK;
+}
+#endif
+
+#if (HM10_CLONE_RPC || HM10_CLONE_MUX || HM10_CLONE_PING) && !HM10_CLONE_ZERO_COPY_RX
+static HM10_Clone_Status ota_rx_nowait(uint8_t *byte)
+{
+	/** <b>Local variable ret:</b> Return value of a HAL function type. */
+	HAL_StatusTypeDef ret;
+	#if HM10_CLONE_CAPTURE
+		/** <b>Local variable start_tick:</b> HAL Tick at which the reception was started. */
+		uint32_t start_tick = HAL_GetTick();
+	#endif
+
+	/* The mutex is only held for each byte, so that the feed function can send OTA data (e.g., a response). */
+	module_lock();
+	ret = transaction_holds_uart() ? HAL_BUSY : uart_receive(byte, 1, 0);
+	module_unlock();
+	#if HM10_CLONE_CAPTURE
+		if (ret == HAL_OK)
+		{
+			capture_record(HM10_CLONE_CAPTURE_RX | ret, start_tick, 1, byte);
+		}
+	#endif
+	#if HM10_CLONE_STATS
+		if (ret == HAL_OK)
+		{
+			stats.link.ota_rx_bytes++;
+		}
+		else if (ret == HAL_ERROR)
+		{
+			stats.link.uart_errors++;
+		}
+	#endif
+
+	return HAL_ret_handler(ret);
+}
+#endif
+
+#if HM10_CLONE_TX_COALESCING
+static HM10_Clone_Status coalesce_write(uint8_t *data, uint16_t size, uint32_t timeout)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+	/** <b>Local variable send_size:</b> Number of bytes of the \p data param that are sent right away, which are those that complete the pending packet followed by those that fill whole packets. */
+	uint16_t send_size = 0;
+
+	/* Send the pending bytes that have waited for too long before accepting any of the given data. */
+	if ((tx_coalesce_size > 0) && ((HAL_GetTick() - tx_coalesce_start_tick) >= HM10_CLONE_TX_COALESCING_DELAY_MS))
+	{
+		ret = coalesce_flush(timeout);
+		if (ret != HM10_Clone_EC_OK)
+		{
+			return ret;
+		}
+	}
+
+	if (tx_coalesce_size > 0)
+	{
+		send_size = HM10_CLONE_MAX_PACKET_SIZE - tx_coalesce_size;
+		if (size < send_size)
+		{
+			send_size = 0;
+		}
+	}
+	send_size += (size - send_size) - ((size - send_size) % HM10_CLONE_MAX_PACKET_SIZE);
+
+	/* Send the pending bytes, which were already accepted, and then the given bytes that complete the packets in a
+	   single write, so that either all or none of those given bytes are accepted whenever the UART fails. */
+	if (send_size > 0)
+	{
+		ret = coalesce_flush(timeout);
+		if (ret != HM10_Clone_EC_OK)
+		{
+			return ret;
+		}
+		ret = HAL_uart_ota_tx(data, send_size, timeout);
+		if (ret != HM10_Clone_EC_OK)
+		{
+			return ret;
+		}
+		data += send_size;
+		size -= send_size;
+	}
+
+	/* Keep the remaining bytes, which are accepted from here on, so that a failure to send them is given later by
+	   either @ref flush_hm10clone_ota_data or @ref poll_hm10clone_ota_tx . */
+	if (size > 0)
+	{
+		if (tx_coalesce_size == 0)
+		{
+			tx_coalesce_start_tick = HAL_GetTick();
+		}
+		memcpy(&tx_coalesce_buffer[tx_coalesce_size], data, size);
+		tx_coalesce_size += size;
+	}
+
+	return HM10_Clone_EC_OK;
+}
+
+static HM10_Clone_Status coalesce_flush(uint32_t timeout)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	if (tx_coalesce_size == 0)
+	{
+		return HM10_Clone_EC_OK;
+	}
+	ret = HAL_uart_ota_tx(tx_coalesce_buffer, tx_coalesce_size, timeout);
+	if (ret == HM10_Clone_EC_OK)
+	{
+		tx_coalesce_size = 0;
+	}
+
+	return ret;
+}
+#endif
+
+#if HM10_CLONE_OTA_BENCHMARK
+HM10_Clone_Status get_hm10clone_ota_benchmark(HM10_Clone_OTA_Benchmark *snapshot)
+{
+	module_lock();
+	memcpy(snapshot, &ota_benchmark, sizeof(HM10_Clone_OTA_Benchmark));
+	module_unlock();
+	snapshot->window_end_tick = HAL_GetTick();
+	snapshot->core_clock_hz = HM10_CLONE_OTA_BENCHMARK_CLOCK_HZ;
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status reset_hm10clone_ota_benchmark()
+{
+	module_lock();
+	memset(&ota_benchmark, 0, sizeof(HM10_Clone_OTA_Benchmark));
+	ota_benchmark.window_start_tick = HAL_GetTick();
+	module_unlock();
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status add_hm10clone_ota_benchmark_overhead(HM10_Clone_OTA_Direction direction, uint32_t overhead_bytes)
+{
+	switch (direction)
+	{
+		case HM10_Clone_OTA_TX:
+		case HM10_Clone_OTA_RX:
+			break;
+		default:
+			HM10_CLONE_LOG(HM10_CLONE_EV_INVALID_OTA_DIRECTION, direction);
+			return HM10_Clone_EC_ERR;
+	}
+	module_lock();
+	ota_benchmark.path[direction].overhead_bytes += overhead_bytes;
+	module_unlock();
+
+	return HM10_Clone_EC_OK;
+}
+
+uint32_t get_hm10clone_ota_latency_percentile(HM10_Clone_OTA_Benchmark_Path *path, uint8_t percentile)
+{
+	if ((percentile == 0) || (percentile > 100) || (path->calls == 0))
+	{
+		return 0;
+	}
+
+	/** <b>Local variable calls_needed:</b> Number of calls, rounded up, that must be covered by the histogram buckets to reach the requested percentile. */
+	uint32_t calls_needed = (uint32_t) ((((uint64_t) path->calls) * percentile + 99) / 100);
+	/** <b>Local variable calls_covered:</b> Accumulated number of calls counted by the histogram buckets that have been visited. */
+	uint32_t calls_covered = 0;
+	for (uint8_t bucket=0; bucket<HM10_CLONE_OTA_BENCHMARK_HISTOGRAM_BUCKETS; bucket++)
+	{
+		calls_covered += path->latency_histogram[bucket];
+		if (calls_covered >= calls_needed)
+		{
+			return ((uint32_t) 1) << (bucket + 1);
+		}
+	}
+
+	return ((uint32_t) 1) << HM10_CLONE_OTA_BENCHMARK_HISTOGRAM_BUCKETS;
+}
+
+static void ota_benchmark_record(HM10_Clone_OTA_Benchmark_Path *path, uint16_t size, HM10_Clone_Status status, uint32_t cycles)
+{
+	path->calls++;
+	path->cycles += cycles;
+	if (status == HM10_Clone_EC_OK)
+	{
+		path->wire_bytes += size;
+	}
+	else
+	{
+		path->failed_calls++;
+	}
+	if (cycles > path->max_latency_cycles)
+	{
+		path->max_latency_cycles = cycles;
+	}
+
+	/* Place the latency of this call into its corresponding power of two bucket of microseconds. */
+	/** <b>Local variable latency_us:</b> Latency of this call in microseconds. */
+	uint32_t latency_us = cycles / (HM10_CLONE_OTA_BENCHMARK_CLOCK_HZ / 1000000U);
+	/** <b>Local variable bucket:</b> Index of the histogram bucket into which the latency of this call falls. */
+	uint8_t bucket = 0;
+	while ((latency_us > 1) && (bucket < (HM10_CLONE_OTA_BENCHMARK_HISTOGRAM_BUCKETS - 1)))
+	{
+		latency_us >>= 1;
+		bucket++;
+	}
+	path->latency_histogram[bucket]++;
+}
+#endif
+
+#if HM10_CLONE_TRACE_ENABLED
+HM10_Clone_Status read_hm10clone_trace(HM10_Clone_Trace_Record *records, uint16_t max_records, uint16_t *records_read)
+{
+	module_lock();
+	/* Discard the records that have already been overwritten. */
+	if ((uint16_t) (trace_head - trace_tail) > HM10_CLONE_TRACE_BUFFER_RECORDS)
+	{
+		trace_tail = trace_head - HM10_CLONE_TRACE_BUFFER_RECORDS;
+	}
+
+	*records_read = 0;
+	while ((trace_tail != trace_head) && (*records_read < max_records))
+	{
+		records[(*records_read)++] = trace_buffer[trace_tail++ & (HM10_CLONE_TRACE_BUFFER_RECORDS - 1)];
+	}
+	module_unlock();
+
+	return HM10_Clone_EC_OK;
+}
+
+static void trace_record(HM10_Clone_Trace_Event event, uint16_t arg0, uint16_t arg1, uint16_t arg2, uint16_t arg3)
+{
+	module_lock();
+	/** <b>Local variable record:</b> Pointer to the record of the @ref trace_buffer into which the event will be written. */
+	HM10_Clone_Trace_Record *record = &trace_buffer[trace_head++ & (HM10_CLONE_TRACE_BUFFER_RECORDS - 1)];
+
+	if (++trace_sequence == 0)
+	{
+		trace_sequence = 1;
+	}
+	record->timestamp = DWT->CYCCNT;
+	record->sequence = trace_sequence;
+	record->event = event;
+	record->args[0] = arg0;
+	record->args[1] = arg1;
+	record->args[2] = arg2;
+	record->args[3] = arg3;
+	module_unlock();
+}
+#endif
+
+#if HM10_CLONE_CAPTURE
+HM10_Clone_Status set_hm10clone_capture_sink(HM10_Clone_Capture_Sink sink)
+{
+	module_lock();
+	capture_sink = sink;
+	module_unlock();
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status read_hm10clone_capture(uint8_t *data, uint16_t max_size, uint16_t *size_read)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret = HM10_Clone_EC_OK;
+
+	module_lock();
+	*size_read = 0;
+	while (capture_tail != capture_head)
+	{
+		/** <b>Local variable record:</b> Oldest capture record of the @ref capture_buffer . */
+		HM10_Clone_Capture_Record record;
+		capture_copy((uint8_t *) &record, capture_tail, sizeof(record));
+		/** <b>Local variable record_size:</b> Length in bytes of the oldest capture record, including its data. */
+		uint16_t record_size = sizeof(record) + ((record.info & HM10_CLONE_CAPTURE_DATA) ? record.size : 0);
+
+		if (record_size > (max_size - *size_read))
+		{
+			if (*size_read == 0)
+			{
+				ret = HM10_Clone_EC_ERR;
+			}
+			break;
+		}
+		capture_copy(&data[*size_read], capture_tail, record_size);
+		*size_read += record_size;
+		capture_tail += record_size;
+	}
+	module_unlock();
+
+	return ret;
+}
+
+static void capture_record(uint8_t info, uint32_t start_tick, uint16_t size, const uint8_t *data)
+{
+	/** <b>Local variable record:</b> Capture record that is being made. */
+	HM10_Clone_Capture_Record record;
+	/** <b>Local variable duration:</b> Time in milliseconds that the transfer or the call took. */
+	uint32_t duration = HAL_GetTick() - start_tick;
+	/** <b>Local variable data_size:</b> Number of bytes of data that follow the capture record. */
+	uint16_t data_size = (data != NULL) ? size : 0;
+
+	record.tick = start_tick;
+	record.duration = (duration > UINT16_MAX) ? UINT16_MAX : duration;
+	record.size = size;
+	record.info = info | ((data != NULL) ? HM10_CLONE_CAPTURE_DATA : 0);
+
+	if (capture_sink != NULL)
+	{
+		capture_sink((const uint8_t *) &record, sizeof(record));
+		if (data_size > 0)
+		{
+			capture_sink(data, data_size);
+		}
+		return;
+	}
+	if ((sizeof(record) + data_size) > HM10_CLONE_CAPTURE_BUFFER_SIZE)
+	{
+		return;
+	}
+
+	/* Discard the oldest records until the new one fits. */
+	while ((HM10_CLONE_CAPTURE_BUFFER_SIZE - (uint16_t) (capture_head - capture_tail)) < (sizeof(record) + data_size))
+	{
+		/** <b>Local variable oldest:</b> Oldest capture record of the @ref capture_buffer . */
+		HM10_Clone_Capture_Record oldest;
+		capture_copy((uint8_t *) &oldest, capture_tail, sizeof(oldest));
+		capture_tail += sizeof(oldest) + ((oldest.info & HM10_CLONE_CAPTURE_DATA) ? oldest.size : 0);
+	}
+	for (uint16_t i=0; i<(sizeof(record) + data_size); i++)
+	{
+		capture_buffer[capture_head++ & (HM10_CLONE_CAPTURE_BUFFER_SIZE - 1)] = (i < sizeof(record)) ? ((uint8_t *) &record)[i] : data[i - sizeof(record)];
+	}
+}
+
+static void capture_copy(uint8_t *data, uint16_t index, uint16_t size)
+{
+	for (uint16_t i=0; i<size; i++)
+	{
+		data[i] = capture_buffer[(uint16_t) (index + i) & (HM10_CLONE_CAPTURE_BUFFER_SIZE - 1)];
+	}
+}
+#endif
+
+#if HM10_CLONE_STATS
+HM10_Clone_Status get_hm10clone_stats(HM10_Clone_Stats *snapshot, uint8_t reset)
+{
+	module_lock();
+	memcpy(snapshot, &stats, sizeof(HM10_Clone_Stats));
+	if (reset)
+	{
+		memset(&stats, 0, sizeof(HM10_Clone_Stats));
+		for (uint8_t cmd=0; cmd<HM10_Clone_Cmd_Count; cmd++)
+		{
+			stats.cmd[cmd].latency_min_ms = UINT32_MAX;
+		}
+	}
+	module_unlock();
+
+	return HM10_Clone_EC_OK;
+}
+#endif
+
+static void cmd_begin(HM10_Clone_Cmd cmd)
+{
+	cmd_in_progress = 1;
+	current_cmd = cmd;
+	resp_attempts = 0;
+	retry_requested = 0;
+	#if HM10_CLONE_ADAPTIVE_TIMEOUT
+		rtt_sample_pending = 0;
+	#endif
+	#if HM10_CLONE_STATS
+		stats_cmd_start_tick = HAL_GetTick();
+		stats_cmd_start_uart_errors = stats.link.uart_errors;
+	#endif
+	#if HM10_CLONE_CAPTURE
+		capture_call_start_tick = HAL_GetTick();
+		capture_record(HM10_CLONE_CAPTURE_CALL_BEGIN, capture_call_start_tick, cmd, NULL);
+	#endif
+}
+
+static HM10_Clone_Status cmd_begin_guarded(HM10_Clone_Cmd cmd)
+{
+	#if HM10_CLONE_STATE_PIN
+		if (connected_policy_applies(cmd) && (connected_policy == HM10_Clone_Connected_WAIT) && state_pin_connected())
+		{
+			/** <b>Local variable start_tick:</b> HAL Tick at which the AT Command started to be held. */
+			uint32_t start_tick = HAL_GetTick();
+
+			HM10_CLONE_LOG(HM10_CLONE_EV_CONNECTED_WAIT, cmd);
+			while (state_pin_connected() && ((HAL_GetTick() - start_tick) < connected_wait_timeout))
+			{
+				module_delay(1);
+			}
+		}
+	#endif
+	module_lock();
+	#if HM10_CLONE_ZERO_COPY_RX
+		/* The RX of the UART is taken by the DMA reception, so the Responses could not be received. */
+		if (rx_stream_active)
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_CMD_RX_STREAM, cmd);
+			return HM10_Clone_EC_ERR;
+		}
+	#endif
+	#if HM10_CLONE_NONBLOCKING_API
+		/* The state of the current call belongs to the transaction that is in progress, if any, until it concludes. */
+		if (active_transaction != NULL)
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_CMD_BUSY, cmd);
+			return HM10_Clone_EC_BUSY;
+		}
+	#endif
+	cmd_begin(cmd);
+	#if HM10_CLONE_STATE_PIN
+		if (connected_policy_applies(cmd) && state_pin_connected())
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_CONNECTED_GUARD, cmd);
+			return HM10_Clone_EC_CONNECTED;
+		}
+	#endif
+
+	return HM10_Clone_EC_OK;
+}
+
+static void cmd_end(HM10_Clone_Cmd cmd, HM10_Clone_Status status)
+{
+	if (!cmd_in_progress)
+	{
+		return;
+	}
+	cmd_in_progress = 0;
+	#if HM10_CLONE_STATS
+		/** <b>Local variable latency:</b> Time in milliseconds that the concluded call took. */
+		uint32_t latency = HAL_GetTick() - stats_cmd_start_tick;
+		/** <b>Local variable cmd_stats:</b> Pointer to the statistics of the AT Command that was sent by the concluded call. */
+		HM10_Clone_Cmd_Stats *cmd_stats = &stats.cmd[cmd];
+
+		cmd_stats->calls++;
+		cmd_stats->attempts += (status != HM10_Clone_EC_CONNECTED) + resp_attempts;
+		cmd_stats->retries += resp_attempts;
+		switch (status)
+		{
+			case HM10_Clone_EC_OK:
+				if (resp_attempts == 0)
+				{
+					cmd_stats->first_try_successes++;
+				}
+				break;
+			case HM10_Clone_EC_NR:
+				cmd_stats->timeouts++;
+				break;
+			case HM10_Clone_EC_ERR:
+				if (stats.link.uart_errors == stats_cmd_start_uart_errors)
+				{
+					cmd_stats->validation_failures++;
+				}
+				break;
+			case HM10_Clone_EC_CONNECTED:
+				cmd_stats->connected_rejections++;
+				break;
+			default:
+				break;
+		}
+		if (latency < cmd_stats->latency_min_ms)
+		{
+			cmd_stats->latency_min_ms = latency;
+		}
+		if (latency > cmd_stats->latency_max_ms)
+		{
+			cmd_stats->latency_max_ms = latency;
+		}
+		cmd_stats->latency_sum_ms += latency;
+	#elif !HM10_CLONE_CAPTURE
+		(void) cmd;
+		(void) status;
+	#endif
+	#if HM10_CLONE_CAPTURE
+		capture_record(HM10_CLONE_CAPTURE_CALL_END | status, capture_call_start_tick, cmd, NULL);
+	#endif
+}
+
+static void cmd_end_guarded(HM10_Clone_Cmd cmd, HM10_Clone_Status status)
+{
+	cmd_end(cmd, status);
+	module_unlock();
+}
+
+#if HM10_CLONE_NONBLOCKING_API
+HM10_Clone_Status begin_hm10clone_test_cmd(HM10_Clone_Transaction *transaction)
+{
+	HM10_CLONE_LOG(HM10_CLONE_EV_TEST_CMD_SENDING);
+	return transaction_start(transaction, HM10_Clone_Cmd_Test, HM10_Clone_Test_cmd, sizeof(HM10_Clone_Test_cmd), NULL, 0, NULL, 0, 1);
+}
+
+HM10_Clone_Status begin_hm10clone_reset_cmd(HM10_Clone_Transaction *transaction)
+{
+	HM10_CLONE_LOG(HM10_CLONE_EV_RESET_CMD_SENDING);
+	return transaction_start(transaction, HM10_Clone_Cmd_Reset, HM10_Clone_Reset_cmd, sizeof(HM10_Clone_Reset_cmd), NULL, 0, NULL, 0, 1);
+}
+
+#if HM10_CLONE_NAME_CMDS
+HM10_Clone_Status begin_hm10clone_set_name(HM10_Clone_Transaction *transaction, uint8_t *hm10_name, uint8_t size)
+{
+	/* Validating given name. */
+	if (size > HM10_CLONE_MAX_BLE_NAME_SIZE)
+	{
+		HM10_CLONE_LOG(HM10_CLONE_EV_INVALID_NAME_SIZE, HM10_CLONE_MAX_BLE_NAME_SIZE, HM10_CLONE_MAX_BLE_NAME_SIZE);
+		return HM10_Clone_EC_ERR;
+	}
+
+	HM10_CLONE_LOG(HM10_CLONE_EV_NAME_CMD_SENDING);
+	return transaction_start(transaction, HM10_Clone_Cmd_Set_Name, HM10_Clone_Name_cmd, sizeof(HM10_Clone_Name_cmd), hm10_name, size, HM10_Clone_Name_resp, sizeof(HM10_Clone_Name_resp), 1);
+}
+#endif
+
+#if HM10_CLONE_ROLE_CMDS
+HM10_Clone_Status begin_hm10clone_set_role(HM10_Clone_Transaction *transaction, HM10_Clone_Role ble_role)
+{
+	/** <b>Local variable role:</b> ASCII Code data of the requested role. */
+	uint8_t role = ble_role;
+
+	/* Validating given role. */
+	switch (ble_role)
+	{
+		case HM10_Clone_Role_Peripheral:
+		case HM10_Clone_Role_Central:
+			break;
+		default:
+			HM10_CLONE_LOG(HM10_CLONE_EV_INVALID_ROLE_GIVEN, ble_role);
+			return HM10_Clone_EC_ERR;
+	}
+
+	HM10_CLONE_LOG(HM10_CLONE_EV_ROLE_CMD_SENDING);
+	return transaction_start(transaction, HM10_Clone_Cmd_Set_Role, HM10_Clone_Role_cmd, sizeof(HM10_Clone_Role_cmd), &role, 1, HM10_Clone_Role_resp, sizeof(HM10_Clone_Role_resp), 0);
+}
+#endif
+
+#if HM10_CLONE_PIN_CMDS
+HM10_Clone_Status begin_hm10clone_set_pin(HM10_Clone_Transaction *transaction, uint8_t *pin)
+{
+	/* Validating given pin. */
+	for (uint8_t current_pin_character=0; current_pin_character<HM10_CLONE_PIN_VALUE_SIZE; current_pin_character++)
+	{
+		if ((pin[current_pin_character] < Number_0_in_ASCII) || (pin[current_pin_character] > Number_9_in_ASCII))
+		{
+			HM10_CLONE_LOG(HM10_CLONE_EV_INVALID_PIN_GIVEN, current_pin_character, pin[current_pin_character]);
+			return HM10_Clone_EC_ERR;
+		}
+	}
+
+	HM10_CLONE_LOG(HM10_CLONE_EV_PIN_CMD_SENDING);
+	return transaction_start(transaction, HM10_Clone_Cmd_Set_Pin, HM10_Clone_Pin_cmd, sizeof(HM10_Clone_Pin_cmd), pin, HM10_CLONE_PIN_VALUE_SIZE, HM10_Clone_Pin_resp, sizeof(HM10_Clone_Pin_resp), 1);
+}
+#endif
+
+#if HM10_CLONE_TYPE_CMDS
+HM10_Clone_Status begin_hm10clone_set_pin_code_mode(HM10_Clone_Transaction *transaction, HM10_Clone_Pin_Code_Mode pin_code_mode)
+{
+	/** <b>Local variable type:</b> ASCII Code data of the requested pin code mode. */
+	uint8_t type = pin_code_mode;
+
+	/* Validating given pin code mode. */
+	switch (pin_code_mode)
+	{
+		case HM10_Clone_Pin_Code_DISABLED:
+		case HM10_Clone_Pin_Code_ENABLED:
+			break;
+		default:
+			HM10_CLONE_LOG(HM10_CLONE_EV_INVALID_PIN_CODE_MODE, pin_code_mode);
+			return HM10_Clone_EC_ERR;
+	}
+
+	HM10_CLONE_LOG(HM10_CLONE_EV_TYPE_CMD_SENDING);
+	return transaction_start(transaction, HM10_Clone_Cmd_Set_Type, HM10_Clone_Type_cmd, sizeof(HM10_Clone_Type_cmd), &type, 1, HM10_Clone_Type_resp, sizeof(HM10_Clone_Type_resp), 1);
+}
+#endif
+
+HM10_Clone_Status poll_hm10clone_transaction(HM10_Clone_Transaction *transaction)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	/* The mutex is only held during each step, so that the other tasks can use this module in between the steps. */
+	module_lock();
+	ret = transaction_step(transaction);
+	module_unlock();
+
+	return ret;
+}
+
+HM10_Clone_Status abort_hm10clone_transaction(HM10_Clone_Transaction *transaction)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret = HM10_Clone_EC_OK;
+
+	module_lock();
+	switch (transaction->state)
+	{
+		case HM10_Clone_Transaction_FLUSH:
+		case HM10_Clone_Transaction_RX:
+			HAL_UART_AbortReceive(p_huart);
+			transaction_end(transaction, HM10_Clone_EC_STOP);
+			break;
+		case HM10_Clone_Transaction_TX:
+			HAL_UART_AbortTransmit(p_huart);
+			transaction_end(transaction, HM10_Clone_EC_STOP);
+			break;
+		case HM10_Clone_Transaction_BACKOFF:
+		case HM10_Clone_Transaction_WAIT_DISCONNECT:
+			transaction_end(transaction, HM10_Clone_EC_STOP);
+			break;
+		case HM10_Clone_Transaction_DONE:
+			break;
+		default:
+			ret = HM10_Clone_EC_ERR;
+			break;
+	}
+	module_unlock();
+
+	return ret;
+}
+
+static HM10_Clone_Status transaction_step(HM10_Clone_Transaction *transaction)
+{
+	/** <b>Local variable elapsed:</b> Time in milliseconds that has elapsed since the current state was entered. */
+	uint32_t elapsed = HAL_GetTick() - transaction->state_tick;
+
+	switch (transaction->state)
+	{
+		case HM10_Clone_Transaction_FLUSH:
+			if (p_huart->RxState == HAL_UART_STATE_READY)
+			{
+				/* A byte was received, so keep flushing until none is received during a whole timeout. */
+				HM10_CLONE_LOG(HM10_CLONE_EV_FLUSH_BYTE, transaction->flush_byte);
+				if (++transaction->flushed_bytes >= HM10_CLONE_MAX_FLUSH_BYTES)
+				{
+					/* The HM-10 Clone BLE Device keeps sending data, so do not let it hold this transaction forever. */
+					HM10_CLONE_LOG(HM10_CLONE_EV_FLUSH_LIMIT, HM10_CLONE_MAX_FLUSH_BYTES);
+					HAL_UART_AbortReceive(p_huart);
+					return transaction_retry(transaction, HM10_Clone_EC_ERR);
+				}
+				if (transaction_flush(transaction) != HM10_Clone_EC_BUSY)
+				{
+					return transaction_retry(transaction, HM10_Clone_EC_ERR);
+				}
+				return HM10_Clone_EC_BUSY;
+			}
+			if (!transaction_timed_out(transaction, elapsed, HM10_CLONE_CUSTOM_HAL_TIMEOUT))
+			{
+				return HM10_Clone_EC_BUSY;
+			}
+
+			/* The RX of the UART has been flushed, so send the AT Command. */
+			HAL_UART_AbortReceive(p_huart);
+			uart_tx_cplt_stamped = 0;
+			uart_rx_cplt_stamped = 0;
+			transaction_enter(transaction, HM10_Clone_Transaction_TX, timer_us_from_ms(cmd_tx_timeout(transaction->tx_size)));
+			if (HAL_UART_Transmit_IT(p_huart, transaction->tx, transaction->tx_size) != HAL_OK)
+			{
+				return transaction_retry(transaction, HM10_Clone_EC_ERR);
+			}
+			return HM10_Clone_EC_BUSY;
+
+		case HM10_Clone_Transaction_TX:
+			if (p_huart->gState == HAL_UART_STATE_READY)
+			{
+				/* The AT Command has been sent, so receive the expected Responses. */
+				transaction->rx_timeout = cmd_rx_timeout(current_cmd, transaction->rx_size);
+				transaction_enter(transaction, HM10_Clone_Transaction_RX, timer_us_from_ms(transaction->rx_timeout));
+				if (HAL_UART_Receive_IT(p_huart, transaction->rx, transaction->rx_size) != HAL_OK)
+				{
+					return transaction_retry(transaction, HM10_Clone_EC_ERR);
+				}
+				return HM10_Clone_EC_BUSY;
+			}
+			if (!transaction_timed_out(transaction, elapsed, cmd_tx_timeout(transaction->tx_size)))
+			{
+				return HM10_Clone_EC_BUSY;
+			}
+			HAL_UART_AbortTransmit(p_huart);
+			return transaction_retry(transaction, HM10_Clone_EC_NR);
+
+		case HM10_Clone_Transaction_RX:
+			if (p_huart->RxState == HAL_UART_STATE_READY)
+			{
+				if (p_huart->ErrorCode != HAL_UART_ERROR_NONE)
+				{
+					#if HM10_CLONE_STATS
+						stats.link.uart_errors++;
+					#endif
+					return transaction_retry(transaction, HM10_Clone_EC_ERR);
+				}
+
+				#if HM10_CLONE_ADAPTIVE_TIMEOUT
+					/* Time the Responses with the completion interrupts, since this call may come long after them. */
+					if (uart_rx_cplt_stamped)
+					{
+						rtt_update(uart_rx_cplt_tick - (uart_tx_cplt_stamped ? uart_tx_cplt_tick : transaction->state_tick),
+								   transaction->rx_size, HM10_Clone_EC_OK);
+					}
+				#endif
+
+				/* Validate the HM-10 Clone Device's Responses. */
+				if (memcmp(transaction->rx, transaction->expected_rx, transaction->rx_size) != 0)
+				{
+					HM10_CLONE_LOG(HM10_CLONE_EV_TRANSACTION_RESP_INVALID, transaction->cmd);
+					return transaction_end(transaction, HM10_Clone_EC_ERR);
+				}
+				HM10_CLONE_LOG(HM10_CLONE_EV_TRANSACTION_DONE, transaction->cmd);
+				return transaction_end(transaction, HM10_Clone_EC_OK);
+			}
+			if (!transaction_timed_out(transaction, elapsed, transaction->rx_timeout))
+			{
+				return HM10_Clone_EC_BUSY;
+			}
+			HAL_UART_AbortReceive(p_huart);
+			#if HM10_CLONE_ADAPTIVE_TIMEOUT
+				rtt_update(elapsed, transaction->rx_size, HM10_Clone_EC_NR);
+			#endif
+			return transaction_retry(transaction, HM10_Clone_EC_NR);
+
+		case HM10_Clone_Transaction_BACKOFF:
+			if (!transaction_timed_out(transaction, elapsed, transaction->backoff_ms))
 			{
-				printf("ERROR: A Name Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n", ret);
+				return HM10_Clone_EC_BUSY;
 			}
-		#endif
-		return ret;
+			if (transaction_flush(transaction) != HM10_Clone_EC_BUSY)
+			{
+				HM10_CLONE_LOG(HM10_CLONE_EV_TRANSACTION_FAILED, transaction->cmd, HM10_Clone_EC_ERR);
+				return transaction_end(transaction, HM10_Clone_EC_ERR);
+			}
+			return HM10_Clone_EC_BUSY;
+
+	#if HM10_CLONE_STATE_PIN
+		case HM10_Clone_Transaction_WAIT_DISCONNECT:
+			if (!state_pin_connected())
+			{
+				/* The HM-10 Clone BLE Device has disconnected, so the held AT Command can now be sent. */
+				cmd_begin(transaction->cmd);
+				if (transaction_flush(transaction) != HM10_Clone_EC_BUSY)
+				{
+					HM10_CLONE_LOG(HM10_CLONE_EV_TRANSACTION_FAILED, transaction->cmd, HM10_Clone_EC_ERR);
+					return transaction_end(transaction, HM10_Clone_EC_ERR);
+				}
+				return HM10_Clone_EC_BUSY;
+			}
+			if (!transaction_timed_out(transaction, elapsed, connected_wait_timeout))
+			{
+				return HM10_Clone_EC_BUSY;
+			}
+			cmd_begin(transaction->cmd);
+			HM10_CLONE_LOG(HM10_CLONE_EV_CONNECTED_GUARD, transaction->cmd);
+			return transaction_end(transaction, HM10_Clone_EC_CONNECTED);
+	#endif
+
+		case HM10_Clone_Transaction_DONE:
+			return transaction->status;
+
+		default:
+			return HM10_Clone_EC_ERR;
 	}
+}
 
-	/* Validate the HM-10 Clone Device's Name Response. */
-	/** <b>Local variable name_resp_size_without_cr_and_lf:</b> Size in bytes of the Name Response from the HM-10 Clone BLE device but without considering the length of the requested name and withouth the Carriage Return and New Line bytes. */
-	uint8_t name_resp_size_without_cr_and_lf = HM10_CLONE_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME - CR_AND_LF_SIZE;
-	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Name Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Name Response (i.e., @ref HM10_Clone_Name_resp ). */
-	uint8_t bytes_compared = 0;
-	for (; bytes_compared<name_resp_size_without_cr_and_lf; bytes_compared++)
+static HM10_Clone_Status transaction_start(HM10_Clone_Transaction *transaction, HM10_Clone_Cmd cmd,
+										   const uint8_t *cmd_prefix, uint8_t cmd_prefix_size,
+										   const uint8_t *value, uint8_t value_size,
+										   const uint8_t *resp_prefix, uint8_t resp_size, uint8_t ok_resp)
+{
+	module_lock();
+	if (active_transaction != NULL)
 	{
-		if (TxRx_Buffer[bytes_compared] != HM10_Clone_Name_resp[bytes_compared])
+		module_unlock();
+		return HM10_Clone_EC_BUSY;
+	}
+	#if HM10_CLONE_ZERO_COPY_RX
+		if (rx_stream_active)
 		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Name Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-			#endif
+			HM10_CLONE_LOG(HM10_CLONE_EV_CMD_RX_STREAM, cmd);
+			module_unlock();
 			return HM10_Clone_EC_ERR;
 		}
+	#endif
+
+	/* Populate the AT Command. */
+	transaction->tx_size = 0;
+	memcpy(&transaction->tx[transaction->tx_size], cmd_prefix, cmd_prefix_size);
+	transaction->tx_size += cmd_prefix_size;
+	if (value_size > 0)
+	{
+		memcpy(&transaction->tx[transaction->tx_size], value, value_size);
 	}
-	size_with_offset = size + bytes_compared;
-	for (uint8_t i=0; bytes_compared<size_with_offset; i++)
+	transaction->tx_size += value_size;
+	transaction->tx[transaction->tx_size++] = '\r';
+	transaction->tx[transaction->tx_size++] = '\n';
+
+	/* Populate the expected Responses. */
+	transaction->rx_size = 0;
+	if (resp_size > 0)
 	{
-		if (TxRx_Buffer[bytes_compared++] != hm10_name[i])
+		memcpy(&transaction->expected_rx[transaction->rx_size], resp_prefix, resp_size);
+		transaction->rx_size += resp_size;
+		if (value_size > 0)
 		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Name Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_Clone_EC_ERR;
+			memcpy(&transaction->expected_rx[transaction->rx_size], value, value_size);
 		}
+		transaction->rx_size += value_size;
+		transaction->expected_rx[transaction->rx_size++] = '\r';
+		transaction->expected_rx[transaction->rx_size++] = '\n';
 	}
-	if ((TxRx_Buffer[bytes_compared]!='\r') || (TxRx_Buffer[bytes_compared+1]!='\n'))
+	if (ok_resp)
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Name Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-		#endif
-		return HM10_Clone_EC_ERR;
+		memcpy(&transaction->expected_rx[transaction->rx_size], HM10_Clone_OK_resp, HM10_CLONE_OK_RESPONSE_SIZE);
+		transaction->rx_size += HM10_CLONE_OK_RESPONSE_SIZE;
 	}
 
-	/* Receive the HM-10 Clone Device's Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_CLONE_OK_RESPONSE_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		if (resp_attempts == 0)
+	transaction->cmd = cmd;
+	transaction->status = HM10_Clone_EC_BUSY;
+	#if HM10_CLONE_POWER_PIN
+		transaction->value_size = value_size;
+	#endif
+	transaction->retries = 0;
+	transaction->flushed_bytes = 0;
+	transaction->start_tick = HAL_GetTick();
+	#if HM10_CLONE_TIMER
+		transaction->deadline.state = HM10_Clone_Timer_IDLE;
+	#endif
+	active_transaction = transaction;
+	#if HM10_CLONE_STATE_PIN
+		if (connected_policy_applies(cmd) && state_pin_connected())
 		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to receive OK Response from HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_set_name_cmd(hm10_name, size);
-		}
-		#if ETX_OTA_VERBOSE
-			else
+			if (connected_policy == HM10_Clone_Connected_REJECT)
 			{
-				printf("ERROR: An OK Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n", ret);
+				cmd_begin(cmd);
+				HM10_CLONE_LOG(HM10_CLONE_EV_CONNECTED_GUARD, cmd);
+				transaction_end(transaction, HM10_Clone_EC_CONNECTED);
+				module_unlock();
+				return HM10_Clone_EC_CONNECTED;
 			}
-		#endif
-		return ret;
-	}
 
-	/* Validate the HM-10 Clone Device's Response. */
-	for (int i=0; i<HM10_CLONE_OK_RESPONSE_SIZE; i++)
-	{
-		if (TxRx_Buffer[i] != HM10_Clone_OK_resp[i])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: An OK Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_Clone_EC_ERR;
+			/* Hold the AT Command until the HM-10 Clone BLE Device disconnects (see poll_hm10clone_transaction()), where
+			   the call is only begun once it can be sent, so that the OTA data keeps flowing meanwhile. */
+			HM10_CLONE_LOG(HM10_CLONE_EV_CONNECTED_WAIT, cmd);
+			transaction_enter(transaction, HM10_Clone_Transaction_WAIT_DISCONNECT, timer_us_from_ms(connected_wait_timeout));
+			module_unlock();
+			return HM10_Clone_EC_OK;
 		}
-	}
-	#if ETX_OTA_VERBOSE
-		printf("DONE: A Name Command was successfully sent to the HM-10 Clone BLE Device.\r\n");
 	#endif
+	cmd_begin(cmd);
+
+	/* Flush the UART's RX before sending the AT Command. */
+	if (transaction_flush(transaction) != HM10_Clone_EC_BUSY)
+	{
+		transaction_end(transaction, HM10_Clone_EC_ERR);
+		module_unlock();
+		return HM10_Clone_EC_ERR;
+	}
+	module_unlock();
 
 	return HM10_Clone_EC_OK;
 }
 
-HM10_Clone_Status get_hm10clone_name(uint8_t *hm10_name, uint8_t *size)
+static HM10_Clone_Status transaction_flush(HM10_Clone_Transaction *transaction)
 {
-	resp_attempts = 0; // Reset the response attempts counter.
-	return send_get_name_cmd(hm10_name, size); // Get the HM-10 Clone Device's Name.
+	transaction_enter(transaction, HM10_Clone_Transaction_FLUSH, HM10_CLONE_TIMER_FLUSH_IDLE_US);
+	if (HAL_UART_Receive_IT(p_huart, &transaction->flush_byte, 1) != HAL_OK)
+	{
+		return HM10_Clone_EC_ERR;
+	}
+
+	return HM10_Clone_EC_BUSY;
 }
 
-static HM10_Clone_Status send_get_name_cmd(uint8_t *hm10_name, uint8_t *size)
+static HM10_Clone_Status transaction_retry(HM10_Clone_Transaction *transaction, HM10_Clone_Status status)
 {
-	/* Flush the UART's RX before starting. */
-	HAL_uart_rx_flush();
-
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
-	int16_t  ret;
-
-	/* Populate the HM-10 Clone Device's Get Name Command into the Tx/Rx Buffer. */
-	#if ETX_OTA_VERBOSE
-		printf("Sending Get Name Command to HM-10 Clone BLE Device...\r\n");
-	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '+';
-	TxRx_Buffer[3] = 'N';
-	TxRx_Buffer[4] = 'A';
-	TxRx_Buffer[5] = 'M';
-	TxRx_Buffer[6] = 'E';
-	TxRx_Buffer[7] = '\r';
-	TxRx_Buffer[8] = '\n';
-
-	/* Send the HM-10 Clone Device's Get Name Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_CLONE_GET_NAME_CMD_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	if (retry_allowed(transaction->retries + 1, status))
 	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to transmit Get Name Command to HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_get_name_cmd(hm10_name, size);
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: Last attempt for transmitting the Get Name Command to HM-10 Clone BLE Device has failed.\r\n");
-			}
-		#endif
-		return ret;
-	}
+		transaction->retries++;
+		transaction->flushed_bytes = 0;
+		HM10_CLONE_LOG(HM10_CLONE_EV_TRANSACTION_RETRY, transaction->retries, transaction->cmd, status);
 
-	/* Receive the HM-10 Clone Device's Get Name Response but just before the BLE Name bytes. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_CLONE_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		if (resp_attempts == 0)
+		/* Back off before the next attempt, unless there is no backoff time to wait. */
+		transaction->backoff_ms = retry_backoff(transaction->retries);
+		if (transaction->backoff_ms > 0)
 		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to receive the Get Name Response from HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_get_name_cmd(hm10_name, size);
+			transaction_enter(transaction, HM10_Clone_Transaction_BACKOFF, timer_us_from_ms(transaction->backoff_ms));
+			return HM10_Clone_EC_BUSY;
 		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: A Get Name Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n", ret);
-			}
-		#endif
-		return ret;
-	}
-
-	/* Validate the HM-10 Clone Device's Get Name Response but just before the BLE Name bytes (last 2 bytes already obtained should not be validated here). */
-	/** <b>Local variable name_resp_size_without_cr_and_lf:</b> Size in bytes of the Name Response from the HM-10 Clone BLE device but without considering the length of the requested name and withouth the Carriage Return and New Line bytes. */
-	uint8_t name_resp_size_without_cr_and_lf = HM10_CLONE_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME - CR_AND_LF_SIZE;
-	/** <b>Local variable bytes_populated_in_TxRx_Buffer:</b> Currently populated data into the Tx/Rx Global Buffer. */
-	uint8_t bytes_populated_in_TxRx_Buffer = 0;
-	for (; bytes_populated_in_TxRx_Buffer<name_resp_size_without_cr_and_lf; bytes_populated_in_TxRx_Buffer++)
-	{
-		if (TxRx_Buffer[bytes_populated_in_TxRx_Buffer] != HM10_Clone_Name_resp[bytes_populated_in_TxRx_Buffer])
+		if (transaction_flush(transaction) == HM10_Clone_EC_BUSY)
 		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Get Name Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_Clone_EC_ERR;
+			return HM10_Clone_EC_BUSY;
 		}
+		status = HM10_Clone_EC_ERR;
 	}
+	HM10_CLONE_LOG(HM10_CLONE_EV_TRANSACTION_FAILED, transaction->cmd, status);
 
-	/* Receive the BLE Name bytes part from the HM-10 Clone Device's Get Name Response. */
-	*size = 0;
-	bytes_populated_in_TxRx_Buffer += 2; // Adding last 2 bytes already obtained.
-	do
-	{
-		/* Receive the next byte from the BLE Name. */
-		ret = HAL_UART_Receive(p_huart, &TxRx_Buffer[bytes_populated_in_TxRx_Buffer++], 1, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-		(*size)++;
-		ret = HAL_ret_handler(ret);
-		if (ret != HAL_OK)
+	return transaction_end(transaction, status);
+}
+
+static HM10_Clone_Status transaction_end(HM10_Clone_Transaction *transaction, HM10_Clone_Status status)
+{
+	transaction->state = HM10_Clone_Transaction_DONE;
+	transaction->status = status;
+	#if HM10_CLONE_TIMER
+		stop_hm10clone_timer(&transaction->deadline);
+	#endif
+	active_transaction = NULL;
+	resp_attempts = transaction->retries;
+	#if HM10_CLONE_POWER_PIN
+		if (status == HM10_Clone_EC_OK)
 		{
-			if (resp_attempts == 0)
-			{
-				resp_attempts++;
-				#if ETX_OTA_VERBOSE
-					printf("WARNING: Attempt %d to receive the BLE Name from HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-				#endif
-				ret = send_get_name_cmd(hm10_name, size);
-			}
-			#if ETX_OTA_VERBOSE
-				else
-				{
-					printf("ERROR: A BLE Name from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n", ret);
-				}
-            #endif
-            *size = 0;
-			return ret;
+			config_cache_store(transaction->cmd, &transaction->tx[transaction->tx_size - 2 - transaction->value_size], transaction->value_size);
 		}
+	#endif
+	cmd_end(transaction->cmd, status);
 
-		/* Check if the BLE Name has been completely received. */
-		if ((TxRx_Buffer[bytes_populated_in_TxRx_Buffer-2]=='\r') && (TxRx_Buffer[bytes_populated_in_TxRx_Buffer-1]=='\n'))
+	return status;
+}
+
+static void transaction_enter(HM10_Clone_Transaction *transaction, HM10_Clone_Transaction_State state, uint32_t timeout_us)
+{
+	transaction->state = state;
+	transaction->state_tick = HAL_GetTick();
+	#if HM10_CLONE_TIMER
+		/* Whenever no hardware timer has been set, the timer is left idle and the HAL Tick is polled instead. */
+		if (timeout_us == HM10_CLONE_NO_DEADLINE_US)
 		{
-			break;
+			stop_hm10clone_timer(&transaction->deadline);
 		}
-
-		/* Validate the BLE Name bytes that have been received so far. */
-		if (bytes_populated_in_TxRx_Buffer == (HM10_CLONE_MAX_BLE_NAME_SIZE + HM10_CLONE_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME))
+		else
 		{
-			if (resp_attempts == 0)
-			{
-				resp_attempts++;
-				#if ETX_OTA_VERBOSE
-					printf("WARNING: Attempt %d to receive the BLE Name, with a maximum size of %d, from HM-10 Clone BLE Device has failed.\r\n", resp_attempts, HM10_CLONE_MAX_BLE_NAME_SIZE);
-				#endif
-				ret = send_get_name_cmd(hm10_name, size);
-			}
-			else
-			{
-				ret = HM10_Clone_EC_ERR;
-				#if ETX_OTA_VERBOSE
-					printf("ERROR: A BLE Name, with a maximum size of %d, from the HM-10 Clone BLE Device was expected, but a larger name was received instead.\r\n", HM10_CLONE_MAX_BLE_NAME_SIZE);
-				#endif
-			}
-
-			return ret;
+			start_hm10clone_timer(&transaction->deadline, timeout_us, NULL, NULL);
 		}
-	}
-	while (1);
-
-	/* Pass the BLE Name from the Buffer that is storing it into the \p hm10_name param. */
-	memcpy(hm10_name, &TxRx_Buffer[name_resp_size_without_cr_and_lf], *size);
-
-	#if ETX_OTA_VERBOSE
-		printf("DONE: The BLE Name was successfully received from the HM-10 Clone BLE Device.\r\n");
+	#else
+		(void) timeout_us;
 	#endif
-
-	return HM10_Clone_EC_OK;
 }
 
-HM10_Clone_Status set_hm10clone_role(HM10_Clone_Role ble_role)
+static uint32_t timer_us_from_ms(uint32_t timeout_ms)
 {
-	resp_attempts = 0; // Reset the response attempts counter.
-	return send_set_role_cmd(ble_role); // Send the HM-10 Clone Device's Role Command with the desired role to set to it.
+	return (timeout_ms <= ((HM10_CLONE_NO_DEADLINE_US - 1) / 1000U)) ? (timeout_ms * 1000U) : HM10_CLONE_NO_DEADLINE_US;
 }
 
-static HM10_Clone_Status send_set_role_cmd(HM10_Clone_Role ble_role)
+static uint8_t transaction_timed_out(const HM10_Clone_Transaction *transaction, uint32_t elapsed, uint32_t timeout)
 {
-	/* Flush the UART's RX before starting. */
-	HAL_uart_rx_flush();
-
-	/* Validating given role. */
-	switch (ble_role)
-	{
-		case HM10_Clone_Role_Peripheral:
-		case HM10_Clone_Role_Central:
-			break;
-		default:
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: Requested BLE Role %d is not recognized.\r\n", ble_role);
-			#endif
-			return HM10_Clone_EC_ERR;
-	}
-
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
-	int16_t  ret;
-
-	/* Populate the HM-10 Clone Device's Role Command into the Tx/Rx Buffer. */
-	#if ETX_OTA_VERBOSE
-		printf("Sending Role Command to HM-10 Clone BLE Device...\r\n");
-	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '+';
-	TxRx_Buffer[3] = 'R';
-	TxRx_Buffer[4] = 'O';
-	TxRx_Buffer[5] = 'L';
-	TxRx_Buffer[6] = 'E';
-	TxRx_Buffer[7] = ble_role;
-	TxRx_Buffer[8] = '\r';
-	TxRx_Buffer[9] = '\n';
-
-	/* Send the HM-10 Clone Device's Role Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_CLONE_SET_ROLE_CMD_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		if (resp_attempts == 0)
+	#if HM10_CLONE_TIMER
+		if (transaction->deadline.state != HM10_Clone_Timer_IDLE)
 		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to transmit Role Command to HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_set_role_cmd(ble_role);
+			return transaction->deadline.state != HM10_Clone_Timer_ARMED;
 		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: Last attempt for transmitting the Role Command to HM-10 Clone BLE Device has failed.\r\n");
-			}
-		#endif
-		return ret;
-	}
+	#else
+		(void) transaction;
+	#endif
 
-	/* Receive the HM-10 Clone Device's Role Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_CLONE_ROLE_RESPONSE_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		if (resp_attempts == 0)
+	return elapsed >= timeout;
+}
+#endif
+
+static uint8_t transaction_holds_uart()
+{
+	#if HM10_CLONE_NONBLOCKING_API
+		if (active_transaction == NULL)
 		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to receive Role Response from HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_set_role_cmd(ble_role);
+			return 0;
 		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: A Role Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n", ret);
-			}
-		#endif
-		return ret;
-	}
-
-	/* Validate the HM-10 Clone Device's Role Response. */
-	/** <b>Local variable role_resp_size_without_role_cr_and_lf:</b> Size in bytes of the Role Response from the HM-10 Clone BLE device but without considering the length of the requested role and without the Carriage Return and New Line bytes. */
-	uint8_t role_resp_size_without_role_cr_and_lf = HM10_CLONE_ROLE_RESPONSE_SIZE - 3;
-	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Role Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Role Response (i.e., @ref HM10_Clone_Role_resp ). */
-	uint8_t bytes_compared = 0;
-	for (; bytes_compared<role_resp_size_without_role_cr_and_lf; bytes_compared++)
-	{
-		if (TxRx_Buffer[bytes_compared] != HM10_Clone_Role_resp[bytes_compared])
+		switch (active_transaction->state)
 		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Role Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_Clone_EC_ERR;
+			case HM10_Clone_Transaction_FLUSH:
+			case HM10_Clone_Transaction_TX:
+			case HM10_Clone_Transaction_RX:
+				return 1;
+			default:
+				return 0;
 		}
-	}
-	if ((TxRx_Buffer[bytes_compared]!=ble_role) || (TxRx_Buffer[bytes_compared+1]!='\r') || (TxRx_Buffer[bytes_compared+2]!='\n'))
+	#else
+		return 0;
+	#endif
+}
+
+#if HM10_CLONE_ADAPTIVE_TIMEOUT
+HM10_Clone_Status get_hm10clone_timeout_estimate(HM10_Clone_Cmd cmd, HM10_Clone_Timeout_Estimate *estimate)
+{
+	if (cmd >= HM10_Clone_Cmd_Count)
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Role Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-		#endif
 		return HM10_Clone_EC_ERR;
 	}
-	#if ETX_OTA_VERBOSE
-		printf("DONE: A Role Command was successfully sent to the HM-10 Clone BLE Device.\r\n");
-	#endif
+
+	/* Read the estimate under the mutex of this module so that it is not updated halfway by another task. */
+	module_lock();
+	estimate->samples = rtt_estimates[cmd].samples;
+	estimate->srtt_ms = rtt_estimates[cmd].srtt_x8 >> 3;
+	estimate->rttvar_ms = rtt_estimates[cmd].rttvar_x4 >> 2;
+	estimate->backoff = rtt_estimates[cmd].backoff;
+	estimate->rx_timeout_ms = cmd_rx_timeout(cmd, 0);
+	module_unlock();
 
 	return HM10_Clone_EC_OK;
 }
+#endif
 
-HM10_Clone_Status get_hm10clone_role(HM10_Clone_Role *ble_role)
+#if HM10_CLONE_STATE_PIN
+HM10_Clone_Status set_hm10clone_state_pin(GPIO_def_t *pin)
 {
-	resp_attempts = 0; // Reset the response attempts counter.
-	return send_get_role_cmd(ble_role); // Get the HM-10 Clone Device's Role.
+	state_pin = *pin;
+	state_pin_set = 1;
+
+	return HM10_Clone_EC_OK;
 }
 
-static HM10_Clone_Status send_get_role_cmd(HM10_Clone_Role *ble_role)
+HM10_Clone_Status get_hm10clone_connection_state(uint8_t *connected)
 {
-	/* Flush the UART's RX before starting. */
-	HAL_uart_rx_flush();
-
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
-	int16_t  ret;
-
-	/* Populate the HM-10 Clone Device's Get Role Command into the Tx/Rx Buffer. */
-	#if ETX_OTA_VERBOSE
-		printf("Sending Get Role Command to HM-10 Clone BLE Device...\r\n");
-	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '+';
-	TxRx_Buffer[3] = 'R';
-	TxRx_Buffer[4] = 'O';
-	TxRx_Buffer[5] = 'L';
-	TxRx_Buffer[6] = 'E';
-	TxRx_Buffer[7] = '\r';
-	TxRx_Buffer[8] = '\n';
-
-	/* Send the HM-10 Clone Device's Get Role Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_CLONE_GET_ROLE_CMD_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to transmit Get Role Command to HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_get_role_cmd(ble_role);
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: Last attempt for transmitting the Get Role Command to HM-10 Clone BLE Device has failed.\r\n");
-			}
-		#endif
-		return ret;
-	}
-
-	/* Receive the HM-10 Clone Device's Get Role Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_CLONE_ROLE_RESPONSE_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to receive the Get Role Response from HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_get_role_cmd(ble_role);
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: A Get Role Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n", ret);
-			}
-		#endif
-		return ret;
-	}
-
-	/* Validate the HM-10 Clone Device's Get Role Response. */
-	/** <b>Local variable role_resp_size_without_role_cr_and_lf:</b> Size in bytes of the Role Response from the HM-10 Clone BLE device but without considering the length of the role value and without the Carriage Return and New Line bytes. */
-	uint8_t role_resp_size_without_role_cr_and_lf = HM10_CLONE_ROLE_RESPONSE_SIZE - 3;
-	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Role Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Role Response (i.e., @ref HM10_Clone_Role_resp ). */
-	uint8_t bytes_compared = 0;
-	for (; bytes_compared<role_resp_size_without_role_cr_and_lf; bytes_compared++)
+	if (!state_pin_set)
 	{
-		if (TxRx_Buffer[bytes_compared] != HM10_Clone_Role_resp[bytes_compared])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Get Role Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_Clone_EC_ERR;
-		}
+		return HM10_Clone_EC_ERR;
 	}
-	switch (TxRx_Buffer[bytes_compared])
+	*connected = state_pin_connected();
+
+	return HM10_Clone_EC_OK;
+}
+
+static uint8_t state_pin_connected()
+{
+	return HAL_GPIO_ReadPin(state_pin.GPIO_Port, state_pin.GPIO_Pin) == GPIO_PIN_SET;
+}
+
+HM10_Clone_Status set_hm10clone_connected_policy(HM10_Clone_Connected_Policy policy, uint32_t wait_timeout)
+{
+	switch (policy)
 	{
-		case HM10_Clone_Role_Peripheral:
-		case HM10_Clone_Role_Central:
+		case HM10_Clone_Connected_SEND:
+		case HM10_Clone_Connected_REJECT:
+		case HM10_Clone_Connected_WAIT:
 			break;
 		default:
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: Received BLE Role %d is not recognized.\r\n", TxRx_Buffer[bytes_compared]);
-			#endif
 			return HM10_Clone_EC_ERR;
 	}
-	bytes_compared++;
-	if ((TxRx_Buffer[bytes_compared]!='\r') || (TxRx_Buffer[bytes_compared+1]!='\n'))
-	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Role Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-		#endif
-		return HM10_Clone_EC_ERR;
-	}
-	*ble_role = TxRx_Buffer[role_resp_size_without_role_cr_and_lf];
-
-	#if ETX_OTA_VERBOSE
-		printf("DONE: The BLE Role was successfully received from the HM-10 Clone BLE Device.\r\n");
-	#endif
+	module_lock();
+	connected_policy = policy;
+	connected_wait_timeout = wait_timeout;
+	module_unlock();
 
 	return HM10_Clone_EC_OK;
 }
 
-HM10_Clone_Status set_hm10clone_pin(uint8_t *pin)
+static uint8_t connected_policy_applies(HM10_Clone_Cmd cmd)
 {
-	resp_attempts = 0; // Reset the response attempts counter.
-	return send_set_pin_cmd(pin); // Send the HM-10 Clone Device's Pin Command with the desired pin to set in it.
+	return state_pin_set && (connected_policy != HM10_Clone_Connected_SEND) && (cmd != HM10_Clone_Cmd_Connect);
 }
+#endif
 
-static HM10_Clone_Status send_set_pin_cmd(uint8_t *pin)
+#if HM10_CLONE_POWER_PIN
+HM10_Clone_Status set_hm10clone_power_pin(GPIO_def_t *pin, GPIO_PinState on_state)
 {
-	/* Flush the UART's RX before starting. */
-	HAL_uart_rx_flush();
+	module_lock();
+	power_pin = *pin;
+	power_pin_on_state = on_state;
+	power_pin_set = 1;
+	HAL_GPIO_WritePin(power_pin.GPIO_Port, power_pin.GPIO_Pin, power_pin_on_state);
+	module_unlock();
 
-	/* Validating given pin. */
-	for (uint8_t current_pin_character=0; current_pin_character<HM10_CLONE_PIN_VALUE_SIZE; current_pin_character++)
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status disconnect_hm10clone_device(HM10_Clone_Teardown_Times *times)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+	/** <b>Local variable cache:</b> Copy of the @ref config_cache , which is rewritten by the setters while restoring it. */
+	Config_Cache cache;
+	/** <b>Local variable off_tick:</b> HAL Tick at which the HM-10 Clone BLE Device was powered off. */
+	uint32_t off_tick;
+	/** <b>Local variable on_tick:</b> HAL Tick at which the HM-10 Clone BLE Device was powered back on. */
+	uint32_t on_tick;
+	/** <b>Local variable ready_tick:</b> HAL Tick at which the HM-10 Clone BLE Device answered the Test Command. */
+	uint32_t ready_tick;
+
+	memset(times, 0, sizeof(HM10_Clone_Teardown_Times));
+	if (!power_pin_set)
 	{
-		switch (pin[current_pin_character])
+		HM10_CLONE_LOG(HM10_CLONE_EV_POWER_PIN_NOT_SET);
+		return HM10_Clone_EC_ERR;
+	}
+	module_lock();
+	#if HM10_CLONE_NONBLOCKING_API
+		if (active_transaction != NULL)
 		{
-			case Number_0_in_ASCII:
-			case Number_1_in_ASCII:
-			case Number_2_in_ASCII:
-			case Number_3_in_ASCII:
-			case Number_4_in_ASCII:
-			case Number_5_in_ASCII:
-			case Number_6_in_ASCII:
-			case Number_7_in_ASCII:
-			case Number_8_in_ASCII:
-			case Number_9_in_ASCII:
-				break;
-			default:
-				#if ETX_OTA_VERBOSE
-					printf("ERROR: Expected a number character value in ASCII code on given pin value at index %d, but the following ASCII value was given instead: %c.\r\n", current_pin_character, pin[current_pin_character]);
-				#endif
-				return HM10_Clone_EC_ERR;
+			module_unlock();
+			return HM10_Clone_EC_BUSY;
 		}
-	}
+	#endif
 
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
-	int16_t  ret;
-	/** <b>Local variable bytes_populated_in_TxRx_Buffer:</b> Currently populated data into the Tx/Rx Global Buffer. */
-	uint8_t bytes_populated_in_TxRx_Buffer = 0;
-	/** <b>Local variable pin_cmd_size_without_cr_and_lf:</b> Size in bytes of the Pin Command in the HM-10 Clone BLE device but without considering the length of the Carriage Return and New Line bytes. */
-	uint8_t pin_cmd_size_without_cr_and_lf = HM10_CLONE_SET_PIN_CMD_SIZE - CR_AND_LF_SIZE;
+	/* Power off the HM-10 Clone BLE Device for long enough to reset it, which drops its BLE Connection. */
+	HM10_CLONE_LOG(HM10_CLONE_EV_POWER_CYCLE_START, HM10_CLONE_POWER_OFF_TIME);
+	off_tick = HAL_GetTick();
+	HAL_GPIO_WritePin(power_pin.GPIO_Port, power_pin.GPIO_Pin, (power_pin_on_state == GPIO_PIN_SET) ? GPIO_PIN_RESET : GPIO_PIN_SET);
+	module_delay(HM10_CLONE_POWER_OFF_TIME);
+	HAL_GPIO_WritePin(power_pin.GPIO_Port, power_pin.GPIO_Pin, power_pin_on_state);
+	on_tick = HAL_GetTick();
+	times->off_ms = on_tick - off_tick;
 
-	/* Populate the HM-10 Clone Device's Pin Command into the Tx/Rx Buffer. */
-	#if ETX_OTA_VERBOSE
-		printf("Sending Pin Command to HM-10 Clone BLE Device...\r\n");
-	#endif
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'A';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'T';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = '+';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'P';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'I';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'N';
-	for (uint8_t current_pin_character=0; bytes_populated_in_TxRx_Buffer<pin_cmd_size_without_cr_and_lf; current_pin_character++)
+	/* Poll the HM-10 Clone BLE Device with the Test Command until it answers, instead of waiting for its worst-case boot time. */
+	do
 	{
-		TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = pin[current_pin_character];
+		ret = send_hm10clone_test_cmd();
 	}
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = '\r';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = '\n';
-
-	/* Send the HM-10 Clone Device's Role Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_CLONE_SET_PIN_CMD_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	while ((ret != HM10_Clone_EC_OK) && ((HAL_GetTick() - on_tick) < HM10_CLONE_POWER_READY_TIMEOUT));
+	ready_tick = HAL_GetTick();
+	times->boot_ms = ready_tick - on_tick;
+	if (ret != HM10_Clone_EC_OK)
 	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to transmit Pin Command to HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_set_pin_cmd(pin);
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: Last attempt for transmitting the Pin Command to HM-10 Clone BLE Device has failed.\r\n");
-			}
-		#endif
-		return ret;
+		HM10_CLONE_LOG(HM10_CLONE_EV_POWER_READY_TIMEOUT, HM10_CLONE_POWER_READY_TIMEOUT);
+		times->total_ms = ready_tick - off_tick;
+		module_unlock();
+		return HM10_Clone_EC_NR;
 	}
 
-	/* Receive the HM-10 Clone Device's Pin Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_CLONE_PIN_RESPONSE_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		if (resp_attempts == 0)
+	/* Restore the configuration that had been set to the HM-10 Clone BLE Device. */
+	memcpy(&cache, &config_cache, sizeof(Config_Cache));
+	#if HM10_CLONE_NAME_CMDS
+		if ((ret == HM10_Clone_EC_OK) && (cache.cached_cmds & (1U << HM10_Clone_Cmd_Set_Name)))
 		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to receive Pin Response from HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_set_pin_cmd(pin);
+			ret = set_hm10clone_name(cache.name, cache.name_size);
 		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: A Pin Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n", ret);
-			}
-		#endif
-		return ret;
-	}
-
-	/* Validate the HM-10 Clone Device's Pin Response. */
-	/** <b>Local variable pin_resp_size_without_pin_cr_and_lf:</b> Size in bytes of the Pin Response from the HM-10 Clone BLE device but without considering the length of the pin value and without the Carriage Return and New Line bytes. */
-	uint8_t pin_resp_size_without_pin_cr_and_lf = HM10_CLONE_PIN_RESPONSE_SIZE - HM10_CLONE_PIN_VALUE_SIZE - CR_AND_LF_SIZE;
-	/** <b>Local variable pin_resp_size_without_cr_and_lf:</b> Size in bytes of the Pin Response from the HM-10 Clone BLE device but without considering the length of the Carriage Return and New Line bytes. */
-	uint8_t pin_resp_size_without_cr_and_lf = HM10_CLONE_PIN_RESPONSE_SIZE - CR_AND_LF_SIZE;
-	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Pin Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Pin Response (i.e., @ref HM10_Clone_Pin_resp ). */
-	uint8_t bytes_compared = 0;
-	for (; bytes_compared<pin_resp_size_without_pin_cr_and_lf; bytes_compared++)
-	{
-		if (TxRx_Buffer[bytes_compared] != HM10_Clone_Pin_resp[bytes_compared])
+	#endif
+	#if HM10_CLONE_ROLE_CMDS
+		if ((ret == HM10_Clone_EC_OK) && (cache.cached_cmds & (1U << HM10_Clone_Cmd_Set_Role)))
 		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Pin Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_Clone_EC_ERR;
+			ret = set_hm10clone_role((HM10_Clone_Role) cache.role);
 		}
-	}
-	for (uint8_t current_pin_character=0; bytes_compared<pin_resp_size_without_cr_and_lf; current_pin_character++)
-	{
-		if (TxRx_Buffer[bytes_compared++] != pin[current_pin_character])
+	#endif
+	#if HM10_CLONE_PIN_CMDS
+		if ((ret == HM10_Clone_EC_OK) && (cache.cached_cmds & (1U << HM10_Clone_Cmd_Set_Pin)))
 		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Pin Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_Clone_EC_ERR;
+			ret = set_hm10clone_pin(cache.pin);
 		}
-	}
-	if ((TxRx_Buffer[bytes_compared]!='\r') || (TxRx_Buffer[bytes_compared+1]!='\n'))
+	#endif
+	#if HM10_CLONE_TYPE_CMDS
+		if ((ret == HM10_Clone_EC_OK) && (cache.cached_cmds & (1U << HM10_Clone_Cmd_Set_Type)))
+		{
+			ret = set_hm10clone_pin_code_mode((HM10_Clone_Pin_Code_Mode) cache.type);
+		}
+	#endif
+	times->restore_ms = HAL_GetTick() - ready_tick;
+	times->total_ms = times->off_ms + times->boot_ms + times->restore_ms;
+	module_unlock();
+	if (ret != HM10_Clone_EC_OK)
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Pin Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-		#endif
+		HM10_CLONE_LOG(HM10_CLONE_EV_POWER_RESTORE_FAILED, current_cmd, ret);
 		return HM10_Clone_EC_ERR;
 	}
+	HM10_CLONE_LOG(HM10_CLONE_EV_POWER_CYCLE_DONE, times->total_ms, times->boot_ms, times->restore_ms);
 
-	/* Receive the HM-10 Clone Device's OK Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_CLONE_OK_RESPONSE_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	return HM10_Clone_EC_OK;
+}
+
+static void config_cache_store(HM10_Clone_Cmd cmd, const uint8_t *value, uint8_t size)
+{
+	switch (cmd)
 	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to receive OK Response from HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_set_pin_cmd(pin);
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: An OK Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n", ret);
-			}
-		#endif
-		return ret;
+		case HM10_Clone_Cmd_Set_Name:
+			memcpy(config_cache.name, value, size);
+			config_cache.name_size = size;
+			break;
+		case HM10_Clone_Cmd_Set_Role:
+			config_cache.role = value[0];
+			break;
+		case HM10_Clone_Cmd_Set_Pin:
+			memcpy(config_cache.pin, value, HM10_CLONE_PIN_VALUE_SIZE);
+			break;
+		case HM10_Clone_Cmd_Set_Type:
+			config_cache.type = value[0];
+			break;
+		default:
+			return;
 	}
+	config_cache.cached_cmds |= 1U << cmd;
+}
+#endif
 
-	/* Validate the HM-10 Clone Device's OK Response. */
-	for (int i=0; i<HM10_CLONE_OK_RESPONSE_SIZE; i++)
+HM10_Clone_Status set_hm10clone_retry_policy(HM10_Clone_Retry_Policy *policy)
+{
+	if (policy->max_attempts == 0)
 	{
-		if (TxRx_Buffer[i] != HM10_Clone_OK_resp[i])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: An OK Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_Clone_EC_ERR;
-		}
+		return HM10_Clone_EC_ERR;
 	}
+	module_lock();
+	memcpy(&retry_policy, policy, sizeof(HM10_Clone_Retry_Policy));
+	module_unlock();
 
-	#if ETX_OTA_VERBOSE
-		printf("DONE: A Pin Command was successfully sent to the HM-10 Clone BLE Device.\r\n");
-	#endif
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status get_hm10clone_retry_policy(HM10_Clone_Retry_Policy *policy)
+{
+	module_lock();
+	memcpy(policy, &retry_policy, sizeof(HM10_Clone_Retry_Policy));
+	module_unlock();
 
 	return HM10_Clone_EC_OK;
 }
 
-HM10_Clone_Status get_hm10clone_pin(uint8_t *pin)
+static uint8_t retry_allowed(uint8_t failed_attempts, HM10_Clone_Status status)
 {
-	resp_attempts = 0; // Reset the response attempts counter.
-	return send_get_pin_cmd(pin); // Get the HM-10 Clone Device's Pin.
+	if (failed_attempts >= retry_policy.max_attempts)
+	{
+		return 0;
+	}
+	switch (status)
+	{
+		case HM10_Clone_EC_NR:
+			return retry_policy.retry_on_nr;
+		case HM10_Clone_EC_ERR:
+			return retry_policy.retry_on_err;
+		default:
+			return 0;
+	}
 }
 
-static HM10_Clone_Status send_get_pin_cmd(uint8_t *pin)
+static uint16_t retry_backoff(uint8_t failed_attempts)
 {
-	/* Flush the UART's RX before starting. */
-	HAL_uart_rx_flush();
+	/* The last step of the backoff schedule is repeated for any further attempts. */
+	if (failed_attempts > HM10_CLONE_RETRY_BACKOFF_STEPS)
+	{
+		failed_attempts = HM10_CLONE_RETRY_BACKOFF_STEPS;
+	}
 
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
-	int16_t  ret;
+	return retry_policy.backoff_ms[failed_attempts - 1];
+}
 
-	/* Populate the HM-10 Clone Device's Get Pin Command into the Tx/Rx Buffer. */
-	#if ETX_OTA_VERBOSE
-		printf("Sending Get Pin Command to HM-10 Clone BLE Device...\r\n");
-	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '+';
-	TxRx_Buffer[3] = 'P';
-	TxRx_Buffer[4] = 'I';
-	TxRx_Buffer[5] = 'N';
-	TxRx_Buffer[6] = '\r';
-	TxRx_Buffer[7] = '\n';
+static uint8_t cmd_retry(HM10_Clone_Status status)
+{
+	retry_requested = retry_allowed(resp_attempts + 1, status);
 
-	/* Send the HM-10 Clone Device's Get Pin Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_CLONE_GET_PIN_CMD_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	return retry_requested;
+}
+
+static uint8_t cmd_retry_pending()
+{
+	if (!retry_requested)
 	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to transmit Get Pin Command to HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_get_pin_cmd(pin);
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: Last attempt for transmitting the Get Pin Command to HM-10 Clone BLE Device has failed.\r\n");
-			}
-		#endif
-		return ret;
+		return 0;
 	}
+	retry_requested = 0;
+	resp_attempts++;
 
-	/* Receive the HM-10 Clone Device's Get Pin Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_CLONE_PIN_RESPONSE_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	/* Back off before the next attempt so that it does not run into the same transient condition. */
+	/** <b>Local variable backoff:</b> Time in milliseconds to wait before the next attempt. */
+	uint16_t backoff = retry_backoff(resp_attempts);
+	if (backoff > 0)
 	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to receive the Get Pin Response from HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_get_pin_cmd(pin);
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: A Get Pin Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n", ret);
-			}
-		#endif
-		return ret;
+		module_delay(backoff);
 	}
 
-	/* Validate the HM-10 Clone Device's Get Pin Response. */
-	/** <b>Local variable pin_resp_size_without_pin_cr_and_lf:</b> Size in bytes of the Pin Response from the HM-10 Clone BLE device but without considering the length of the pin value and without the Carriage Return and New Line bytes. */
-	uint8_t pin_resp_size_without_pin_cr_and_lf = HM10_CLONE_PIN_RESPONSE_SIZE - HM10_CLONE_PIN_VALUE_SIZE - CR_AND_LF_SIZE;
-	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Pin Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Pin Response (i.e., @ref HM10_Clone_Pin_resp ). */
-	uint8_t bytes_compared = 0;
-	for (; bytes_compared<pin_resp_size_without_pin_cr_and_lf; bytes_compared++)
+	return 1;
+}
+
+#if HM10_CLONE_ADAPTIVE_TIMEOUT
+static uint32_t uart_wire_time(uint16_t size)
+{
+	/** <b>Local variable baud_rate:</b> Current baud rate of the UART of the HM-10 Clone BLE Device. */
+	uint32_t baud_rate = p_huart->Init.BaudRate;
+
+	if (baud_rate == 0)
 	{
-		if (TxRx_Buffer[bytes_compared] != HM10_Clone_Pin_resp[bytes_compared])
+		return 0;
+	}
+	/* Each byte takes 10 bits in the wire (i.e., a start bit, 8 data bits and a stop bit). */
+	return (size * 10UL * 1000UL + baud_rate - 1) / baud_rate;
+}
+#endif
+
+static uint32_t cmd_tx_timeout(uint16_t size)
+{
+	#if HM10_CLONE_ADAPTIVE_TIMEOUT
+		/** <b>Local variable timeout:</b> Timeout in milliseconds for transmitting the AT Command. */
+		uint32_t timeout = uart_wire_time(size);
+
+		if (timeout < HM10_CLONE_ADAPTIVE_TIMEOUT_MIN)
 		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Pin Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_Clone_EC_ERR;
+			timeout = HM10_CLONE_ADAPTIVE_TIMEOUT_MIN;
 		}
-	}
-	for (uint8_t current_pin_character=0; current_pin_character<HM10_CLONE_PIN_VALUE_SIZE; current_pin_character++)
-	{
-		switch (TxRx_Buffer[bytes_compared])
+		if (timeout > HM10_CLONE_ADAPTIVE_TIMEOUT_MAX)
 		{
-			case Number_0_in_ASCII:
-			case Number_1_in_ASCII:
-			case Number_2_in_ASCII:
-			case Number_3_in_ASCII:
-			case Number_4_in_ASCII:
-			case Number_5_in_ASCII:
-			case Number_6_in_ASCII:
-			case Number_7_in_ASCII:
-			case Number_8_in_ASCII:
-			case Number_9_in_ASCII:
-				break;
-			default:
-				#if ETX_OTA_VERBOSE
-					printf("ERROR: Expected a number character value in ASCII code on received pin value at index %d, but the following ASCII value was given instead: %c.\r\n", current_pin_character, TxRx_Buffer[bytes_compared]);
-				#endif
-				return HM10_Clone_EC_ERR;
+			timeout = HM10_CLONE_ADAPTIVE_TIMEOUT_MAX;
 		}
-		bytes_compared++;
-	}
-	if ((TxRx_Buffer[bytes_compared]!='\r') || (TxRx_Buffer[bytes_compared+1]!='\n'))
+		return timeout;
+	#else
+		(void) size;
+		return HM10_CLONE_CUSTOM_HAL_TIMEOUT;
+	#endif
+}
+
+static uint32_t cmd_rx_timeout(HM10_Clone_Cmd cmd, uint16_t size)
+{
+	#if HM10_CLONE_ADAPTIVE_TIMEOUT
+		/** <b>Local variable rtt:</b> Pointer to the round-trip time estimate of the given AT Command. */
+		Rtt_Estimate *rtt = &rtt_estimates[cmd];
+		/** <b>Local variable timeout:</b> Timeout in milliseconds for receiving the Response. */
+		uint32_t timeout;
+
+		if (rtt->samples == 0)
+		{
+			/* Without any sample yet, start from the fixed timeout that has always been used. */
+			timeout = HM10_CLONE_CUSTOM_HAL_TIMEOUT;
+		}
+		else
+		{
+			timeout = (rtt->srtt_x8 >> 3) + rtt->rttvar_x4;
+		}
+		timeout = (timeout << rtt->backoff) + uart_wire_time(size);
+
+		if (timeout < HM10_CLONE_ADAPTIVE_TIMEOUT_MIN)
+		{
+			timeout = HM10_CLONE_ADAPTIVE_TIMEOUT_MIN;
+		}
+		if (timeout > HM10_CLONE_ADAPTIVE_TIMEOUT_MAX)
+		{
+			timeout = HM10_CLONE_ADAPTIVE_TIMEOUT_MAX;
+		}
+		return timeout;
+	#else
+		(void) cmd;
+		(void) size;
+		return HM10_CLONE_CUSTOM_HAL_TIMEOUT;
+	#endif
+}
+
+#if HM10_CLONE_ADAPTIVE_TIMEOUT
+static void rtt_update(uint32_t elapsed, uint16_t size, HM10_Clone_Status status)
+{
+	/** <b>Local variable rtt:</b> Pointer to the round-trip time estimate of the AT Command of the current call. */
+	Rtt_Estimate *rtt = &rtt_estimates[current_cmd];
+	/** <b>Local variable wire_time:</b> Wire time in milliseconds of the received Response. */
+	uint32_t wire_time = uart_wire_time(size);
+	/** <b>Local variable sample:</b> Round-trip time sample in milliseconds, without the wire time of the Response. */
+	int32_t sample = (elapsed > wire_time) ? (int32_t) (elapsed - wire_time) : 0;
+	/** <b>Local variable error:</b> Difference between the sample and the smoothed round-trip time. */
+	int32_t error;
+
+	switch (status)
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Pin Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-		#endif
-		return HM10_Clone_EC_ERR;
+		case HM10_Clone_EC_OK:
+			/* Update the smoothed mean and variation just like the retransmission timer of TCP (RFC 6298). */
+			if (rtt->samples == 0)
+			{
+				rtt->srtt_x8 = sample << 3;
+				rtt->rttvar_x4 = sample << 1;
+			}
+			else
+			{
+				error = sample - (rtt->srtt_x8 >> 3);
+				rtt->srtt_x8 += error;
+				if (error < 0)
+				{
+					error = -error;
+				}
+				rtt->rttvar_x4 += error - (rtt->rttvar_x4 >> 2);
+			}
+			rtt->samples++;
+			rtt->backoff = 0;
+			break;
+		case HM10_Clone_EC_NR:
+			/* Back off exponentially until a Response is received again. */
+			if (rtt->backoff < HM10_CLONE_ADAPTIVE_TIMEOUT_MAX_BACKOFF)
+			{
+				rtt->backoff++;
+			}
+			break;
+		default:
+			break;
 	}
+}
+#endif
 
-	/* Pass the BLE Pin from the Buffer that is storing it into the \p pin param. */
-	memcpy(pin, &TxRx_Buffer[pin_resp_size_without_pin_cr_and_lf], HM10_CLONE_PIN_VALUE_SIZE);
+static HM10_Clone_Status HAL_uart_cmd_tx(uint8_t *data, uint16_t size)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+
+	ret = HAL_uart_tx(data, size, cmd_tx_timeout(size));
+	#if HM10_CLONE_ADAPTIVE_TIMEOUT
+		rtt_sample_pending = (ret == HM10_Clone_EC_OK);
+	#endif
+
+	return ret;
+}
+
+static HM10_Clone_Status HAL_uart_cmd_rx(uint8_t *data, uint16_t size)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
+	/** <b>Local variable start_tick:</b> HAL Tick at which the reception was started. */
+	uint32_t start_tick = HAL_GetTick();
+
+	ret = HAL_uart_rx(data, size, cmd_rx_timeout(current_cmd, size));
+	#if HM10_CLONE_ADAPTIVE_TIMEOUT
+		if (rtt_sample_pending)
+		{
+			rtt_sample_pending = 0;
+			rtt_update(HAL_GetTick() - start_tick, size, ret);
+		}
+	#else
+		(void) start_tick;
+	#endif
+
+	return ret;
+}
+
+static HM10_Clone_Status HAL_uart_ota_tx(uint8_t *data, uint16_t size, uint32_t timeout)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Clone_Status function type. */
+	HM10_Clone_Status ret;
 
-	#if ETX_OTA_VERBOSE
-		printf("DONE: The BLE Pin was successfully received from the HM-10 Clone BLE Device.\r\n");
+	ret = HAL_uart_tx(data, size, timeout);
+	#if HM10_CLONE_STATS
+		if (ret == HM10_Clone_EC_OK)
+		{
+			stats.link.ota_tx_bytes += size;
+		}
 	#endif
 
-	return HM10_Clone_EC_OK;
+	return ret;
 }
 
-HM10_Clone_Status set_hm10clone_pin_code_mode(HM10_Clone_Pin_Code_Mode pin_code_mode)
+#if HM10_CLONE_RTOS || HM10_CLONE_NONBLOCKING_API
+void hm10clone_uart_tx_cplt_isr(UART_HandleTypeDef *huart)
 {
-	resp_attempts = 0; // Reset the response attempts counter.
-	return send_set_type_cmd(pin_code_mode); // Send the HM-10 Clone Device's Type Command with the desired pin code mode to set in it.
+	if (huart != p_huart)
+	{
+		return;
+	}
+	uart_tx_cplt_tick = HAL_GetTick();
+	uart_tx_cplt_stamped = 1;
+	#if HM10_CLONE_RTOS
+		if (os_tx_semaphore != NULL)
+		{
+			os_port->semaphore_give(os_tx_semaphore);
+		}
+	#endif
 }
+#endif
 
-static HM10_Clone_Status send_set_type_cmd(HM10_Clone_Pin_Code_Mode pin_code_mode)
+#if HM10_CLONE_RTOS || HM10_CLONE_NONBLOCKING_API || HM10_CLONE_ZERO_COPY_RX
+void hm10clone_uart_rx_cplt_isr(UART_HandleTypeDef *huart)
 {
-	/* Flush the UART's RX before starting. */
-	HAL_uart_rx_flush();
+	if (huart != p_huart)
+	{
+		return;
+	}
+	#if HM10_CLONE_ZERO_COPY_RX
+		if (rx_stream_active)
+		{
+			/* The DMA has filled the upper half of the RX ring buffer and has wrapped around to its start. */
+			rx_ring_halves++;
+			return;
+		}
+	#endif
+	#if HM10_CLONE_RTOS || HM10_CLONE_NONBLOCKING_API
+		uart_rx_cplt_tick = HAL_GetTick();
+		uart_rx_cplt_stamped = 1;
+	#endif
+	#if HM10_CLONE_RTOS
+		if (os_rx_semaphore != NULL)
+		{
+			os_port->semaphore_give(os_rx_semaphore);
+		}
+	#endif
+}
+#endif
 
-	/* Validating given pin code mode. */
-	switch (pin_code_mode)
+#if HM10_CLONE_ZERO_COPY_RX
+void hm10clone_uart_rx_half_cplt_isr(UART_HandleTypeDef *huart)
+{
+	if ((huart == p_huart) && rx_stream_active)
 	{
-		case HM10_Clone_Pin_Code_DISABLED:
-		case HM10_Clone_Pin_Code_ENABLED:
-			break;
-		default:
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: An invalid pin code mode value has been given: %c_ASCII.\r\n", pin_code_mode);
-			#endif
-			return HM10_Clone_EC_ERR;
+		rx_ring_halves++;
 	}
+}
+#endif
 
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
-	int16_t  ret;
+#if HM10_CLONE_RTOS
+HM10_Clone_Status set_hm10clone_os_port(const HM10_Clone_OS_Port *port)
+{
+	if ((port == NULL) || (port->mutex_create == NULL) || (port->mutex_lock == NULL) || (port->mutex_unlock == NULL)
+		|| (port->semaphore_create == NULL) || (port->semaphore_take == NULL) || (port->semaphore_give == NULL)
+		|| (port->delay == NULL))
+	{
+		return HM10_Clone_EC_ERR;
+	}
+	os_port = port;
 
-	/* Populate the HM-10 Clone Device's Type Command into the Tx/Rx Buffer. */
-	#if ETX_OTA_VERBOSE
-		printf("Sending Type Command to HM-10 Clone BLE Device...\r\n");
-	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '+';
-	TxRx_Buffer[3] = 'T';
-	TxRx_Buffer[4] = 'Y';
-	TxRx_Buffer[5] = 'P';
-	TxRx_Buffer[6] = 'E';
-	TxRx_Buffer[7] = pin_code_mode;
-	TxRx_Buffer[8] = '\r';
-	TxRx_Buffer[9] = '\n';
+	return HM10_Clone_EC_OK;
+}
 
-	/* Send the HM-10 Clone Device's Role Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_CLONE_SET_TYPE_CMD_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+void hm10clone_uart_error_isr(UART_HandleTypeDef *huart)
+{
+	if ((huart == p_huart) && (os_tx_semaphore != NULL) && (os_rx_semaphore != NULL))
 	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to transmit Type Command to HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_set_type_cmd(pin_code_mode);
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: Last attempt for transmitting the Type Command to HM-10 Clone BLE Device has failed.\r\n");
-			}
-		#endif
-		return ret;
+		os_uart_error = 1;
+		os_port->semaphore_give(os_tx_semaphore);
+		os_port->semaphore_give(os_rx_semaphore);
 	}
+}
+#endif
 
-	/* Receive the HM-10 Clone Device's Type Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_CLONE_TYPE_RESPONSE_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+#if HM10_CLONE_TIMER
+HM10_Clone_Status set_hm10clone_timer_source(TIM_HandleTypeDef *htim)
+{
+	/** <b>Local variable primask:</b> PRIMASK register before the interrupts were disabled. */
+	uint32_t primask = timer_lock();
+
+	/* Stop every timer, since their deadlines were counted with the previous hardware timer. */
+	if (timer_wheel_running)
 	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to receive Type Response from HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_set_type_cmd(pin_code_mode);
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: A Type Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n", ret);
-			}
-		#endif
-		return ret;
+		HAL_TIM_Base_Stop_IT(p_htim);
+		timer_wheel_running = 0;
 	}
-
-	/* Validate the HM-10 Clone Device's Type Response. */
-	/** <b>Local variable type_resp_size_without_pin_cr_and_lf:</b> Size in bytes of the Type Response from the HM-10 Clone BLE device but without considering the length of the Type value and without the Carriage Return and New Line bytes. */
-	uint8_t type_resp_size_without_pin_cr_and_lf = HM10_CLONE_TYPE_RESPONSE_SIZE - 3;
-	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Type Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Type Response (i.e., @ref HM10_Clone_Type_resp ). */
-	uint8_t bytes_compared = 0;
-	for (; bytes_compared<type_resp_size_without_pin_cr_and_lf; bytes_compared++)
+	for (uint16_t slot=0; slot<HM10_CLONE_TIMER_WHEEL_SLOTS; slot++)
 	{
-		if (TxRx_Buffer[bytes_compared] != HM10_Clone_Type_resp[bytes_compared])
+		while (timer_wheel[slot] != NULL)
 		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Type Response from the HM-10 Clone BLE Device was expected, but something else was received instead at index %d. The received value was %c_ASCII and the expected value is %c_ASCII.\r\n", bytes_compared, TxRx_Buffer[bytes_compared], HM10_Clone_Type_resp[bytes_compared]);
-			#endif
-			return HM10_Clone_EC_ERR;
+			timer_unlink(timer_wheel[slot]);
 		}
 	}
-	if (TxRx_Buffer[bytes_compared++] != pin_code_mode)
+	while (timer_expired_head != NULL)
 	{
-		#if ETX_OTA_VERBOSE
-		printf("ERROR: A Type Response from the HM-10 Clone BLE Device was expected, but something else was received instead at index %d. The received value was %c_ASCII and the expected value is %c_ASCII.\r\n", bytes_compared-1, TxRx_Buffer[bytes_compared-1], pin_code_mode);
-		#endif
-		return HM10_Clone_EC_ERR;
+		timer_unlink(timer_expired_head);
 	}
-	if ((TxRx_Buffer[bytes_compared]!='\r') || (TxRx_Buffer[bytes_compared+1]!='\n'))
+	p_htim = htim;
+	timer_unlock(primask);
+
+	return HM10_Clone_EC_OK;
+}
+
+HM10_Clone_Status start_hm10clone_timer(HM10_Clone_Timer *timer, uint32_t timeout_us, HM10_Clone_Timer_Callback callback, void *context)
+{
+	/** <b>Local variable primask:</b> PRIMASK register before the interrupts were disabled. */
+	uint32_t primask;
+	/** <b>Local variable ticks:</b> Number of ticks of the timer wheel from now until the deadline of the timer. */
+	uint32_t ticks;
+
+	if (p_htim == NULL)
 	{
-		#if ETX_OTA_VERBOSE
-		printf("ERROR: A Type Response from the HM-10 Clone BLE Device was expected, but something else was received instead at index %d and %d. The received values were %c_ASCII and %c_ASCII respectively and the expected values were %c_ASCII and %c_ASCII respectively.\r\n", bytes_compared, bytes_compared+1, TxRx_Buffer[bytes_compared], TxRx_Buffer[bytes_compared+1], '\r', '\n');
-		#endif
 		return HM10_Clone_EC_ERR;
 	}
 
-	/* Receive the HM-10 Clone Device's OK Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_CLONE_OK_RESPONSE_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	primask = timer_lock();
+	timer_unlink(timer);
+	if (!timer_wheel_running)
 	{
-		if (resp_attempts == 0)
+		/* Start the hardware timer from zero, so that its first tick comes after a whole period. */
+		__HAL_TIM_SET_COUNTER(p_htim, 0);
+		if (HAL_TIM_Base_Start_IT(p_htim) != HAL_OK)
 		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to receive OK Response from HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_set_type_cmd(pin_code_mode);
+			timer_unlock(primask);
+			return HM10_Clone_EC_ERR;
 		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: An OK Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n", ret);
-			}
-		#endif
-		return ret;
+		timer_wheel_running = 1;
 	}
+	else
+	{
+		/** <b>Local variable elapsed_us:</b> Part of the current tick of the timer wheel that has already elapsed. */
+		uint32_t elapsed_us = (uint32_t) (((uint64_t) __HAL_TIM_GET_COUNTER(p_htim) * HM10_CLONE_TIMER_TICK_US) / ((uint64_t) __HAL_TIM_GET_AUTORELOAD(p_htim) + 1U));
 
-	/* Validate the HM-10 Clone Device's OK Response. */
-	for (int i=0; i<HM10_CLONE_OK_RESPONSE_SIZE; i++)
+		/* Count the part of the current tick that has already elapsed, so that the timer never expires early. */
+		timeout_us = (timeout_us > (UINT32_MAX - elapsed_us)) ? UINT32_MAX : (timeout_us + elapsed_us);
+	}
+	ticks = (timeout_us / HM10_CLONE_TIMER_TICK_US) + ((timeout_us % HM10_CLONE_TIMER_TICK_US) ? 1 : 0);
+	if (ticks == 0)
 	{
-		if (TxRx_Buffer[i] != HM10_Clone_OK_resp[i])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: An OK Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_Clone_EC_ERR;
-		}
+		ticks = 1;
 	}
 
-	#if ETX_OTA_VERBOSE
-		printf("DONE: A Type Command was successfully sent to the HM-10 Clone BLE Device.\r\n");
-	#endif
+	/* Link the timer into the slot of its deadline, which is visited once per revolution of the timer wheel. */
+	timer->slot = (timer_wheel_slot + ticks) & (HM10_CLONE_TIMER_WHEEL_SLOTS - 1);
+	timer->rounds = (ticks - 1) / HM10_CLONE_TIMER_WHEEL_SLOTS;
+	timer->callback = callback;
+	timer->context = context;
+	timer->next = timer_wheel[timer->slot];
+	timer_wheel[timer->slot] = timer;
+	timer->state = HM10_Clone_Timer_ARMED;
+	timer_armed_count++;
+	timer_unlock(primask);
 
 	return HM10_Clone_EC_OK;
 }
 
-HM10_Clone_Status get_hm10clone_pin_code_mode(HM10_Clone_Pin_Code_Mode *pin_code_mode)
+HM10_Clone_Status stop_hm10clone_timer(HM10_Clone_Timer *timer)
 {
-	resp_attempts = 0; // Reset the response attempts counter.
-	return send_get_type_cmd(pin_code_mode); // Get the HM-10 Clone Device's Pin Code Mode.
-}
+	/** <b>Local variable primask:</b> PRIMASK register before the interrupts were disabled. */
+	uint32_t primask = timer_lock();
 
-static HM10_Clone_Status send_get_type_cmd(HM10_Clone_Pin_Code_Mode *pin_code_mode)
-{
-	/* Flush the UART's RX before starting. */
-	HAL_uart_rx_flush();
+	timer_unlink(timer);
+	timer_unlock(primask);
 
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
-	int16_t  ret;
+	return HM10_Clone_EC_OK;
+}
 
-	/* Populate the HM-10 Clone Device's Get Type Command into the Tx/Rx Buffer. */
-	#if ETX_OTA_VERBOSE
-		printf("Sending Get Type Command to HM-10 Clone BLE Device...\r\n");
-	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '+';
-	TxRx_Buffer[3] = 'T';
-	TxRx_Buffer[4] = 'Y';
-	TxRx_Buffer[5] = 'P';
-	TxRx_Buffer[6] = 'E';
-	TxRx_Buffer[7] = '\r';
-	TxRx_Buffer[8] = '\n';
+HM10_Clone_Status poll_hm10clone_timers()
+{
+	/** <b>Local variable primask:</b> PRIMASK register before the interrupts were disabled. */
+	uint32_t primask;
+	/** <b>Local variable timer:</b> Oldest expired timer whose callback has not been called yet. */
+	HM10_Clone_Timer *timer;
 
-	/* Send the HM-10 Clone Device's Get Type Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_CLONE_GET_TYPE_CMD_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	while (1)
 	{
-		if (resp_attempts == 0)
+		primask = timer_lock();
+		timer = timer_expired_head;
+		if (timer != NULL)
 		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to transmit Get Type Command to HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_get_type_cmd(pin_code_mode);
-		}
-		#if ETX_OTA_VERBOSE
-			else
+			timer_expired_head = timer->next;
+			if (timer_expired_head == NULL)
 			{
-				printf("ERROR: Last attempt for transmitting the Get Type Command to HM-10 Clone BLE Device has failed.\r\n");
+				timer_expired_tail = NULL;
 			}
-		#endif
-		return ret;
+			timer->next = NULL;
+			timer->state = HM10_Clone_Timer_EXPIRED;
+		}
+		timer_unlock(primask);
+		if (timer == NULL)
+		{
+			return HM10_Clone_EC_OK;
+		}
+
+		/* The timer is no longer linked anywhere, so its callback is free to start it again. */
+		timer->callback(timer, timer->context);
 	}
+}
 
-	/* Receive the HM-10 Clone Device's Get Type Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_CLONE_TYPE_RESPONSE_SIZE, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+void hm10clone_timer_tick_isr(TIM_HandleTypeDef *htim)
+{
+	/** <b>Local variable link:</b> Pointer to the link that points to the timer that is being visited. */
+	HM10_Clone_Timer **link;
+
+	if ((p_htim == NULL) || (htim->Instance != p_htim->Instance))
 	{
-		if (resp_attempts == 0)
-		{
-			resp_attempts++;
-			#if ETX_OTA_VERBOSE
-				printf("WARNING: Attempt %d to receive the Get Type Response from HM-10 Clone BLE Device has failed.\r\n", resp_attempts);
-			#endif
-			ret = send_get_type_cmd(pin_code_mode);
-		}
-		#if ETX_OTA_VERBOSE
-			else
-			{
-				printf("ERROR: A Get Type Response from the HM-10 Clone BLE Device was expected, but none was received (HM-10 Clone Exception code = %d)\r\n", ret);
-			}
-		#endif
-		return ret;
+		return;
 	}
 
-	/* Validate the HM-10 Clone Device's Get Type Response. */
-	/** <b>Local variable type_resp_size_without_type_cr_and_lf:</b> Size in bytes of the Type Response from the HM-10 Clone BLE device but without considering the length of the Type value and without the Carriage Return and New Line bytes. */
-	uint8_t type_resp_size_without_type_cr_and_lf = HM10_CLONE_TYPE_RESPONSE_SIZE - 3;
-	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Type Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Type Response (i.e., @ref HM10_Clone_Type_resp ). */
-	uint8_t bytes_compared = 0;
-	for (; bytes_compared<type_resp_size_without_type_cr_and_lf; bytes_compared++)
+	/* Visit only the timers of the slot of this tick, expiring those that are on their last revolution. */
+	timer_wheel_slot = (timer_wheel_slot + 1) & (HM10_CLONE_TIMER_WHEEL_SLOTS - 1);
+	link = &timer_wheel[timer_wheel_slot];
+	while (*link != NULL)
 	{
-		if (TxRx_Buffer[bytes_compared] != HM10_Clone_Type_resp[bytes_compared])
+		/** <b>Local variable timer:</b> Timer that is being visited. */
+		HM10_Clone_Timer *timer = *link;
+		if (timer->rounds > 0)
 		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Type Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_Clone_EC_ERR;
+			timer->rounds--;
+			link = &timer->next;
+			continue;
+		}
+		*link = timer->next;
+		timer->next = NULL;
+		timer_armed_count--;
+		if (timer->callback == NULL)
+		{
+			timer->state = HM10_Clone_Timer_EXPIRED;
+			continue;
+		}
+		timer->state = HM10_Clone_Timer_PENDING;
+		if (timer_expired_tail != NULL)
+		{
+			timer_expired_tail->next = timer;
+		}
+		else
+		{
+			timer_expired_head = timer;
 		}
+		timer_expired_tail = timer;
 	}
-	switch (TxRx_Buffer[bytes_compared])
+
+	/* Stop interrupting the CPU while there are no deadlines to wait for. */
+	if (timer_armed_count == 0)
 	{
-		case HM10_Clone_Pin_Code_DISABLED:
-		case HM10_Clone_Pin_Code_ENABLED:
+		HAL_TIM_Base_Stop_IT(p_htim);
+		timer_wheel_running = 0;
+	}
+}
+
+static uint32_t timer_lock()
+{
+	/** <b>Local variable primask:</b> PRIMASK register before disabling the interrupts. */
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+
+	return primask;
+}
+
+static void timer_unlock(uint32_t primask)
+{
+	if (!primask)
+	{
+		__enable_irq();
+	}
+}
+
+static void timer_unlink(HM10_Clone_Timer *timer)
+{
+	/** <b>Local variable link:</b> Pointer to the link that is being checked for pointing to the \c timer param. */
+	HM10_Clone_Timer **link;
+	/** <b>Local variable previous:</b> Timer that holds the \c link local variable, or \c NULL if it is a list head. */
+	HM10_Clone_Timer *previous = NULL;
+
+	/* Only trust the fields of the timer once it is found in its list, since it might have never been started. */
+	switch (timer->state)
+	{
+		case HM10_Clone_Timer_ARMED:
+			link = &timer_wheel[timer->slot & (HM10_CLONE_TIMER_WHEEL_SLOTS - 1)];
+			break;
+		case HM10_Clone_Timer_PENDING:
+			link = &timer_expired_head;
 			break;
 		default:
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: An invalid pin code mode value has been given: %c_ASCII.\r\n", TxRx_Buffer[bytes_compared]);
-			#endif
-			return HM10_Clone_EC_ERR;
+			timer->state = HM10_Clone_Timer_IDLE;
+			return;
 	}
-	bytes_compared++;
-	if ((TxRx_Buffer[bytes_compared]!='\r') || (TxRx_Buffer[bytes_compared+1]!='\n'))
+	while ((*link != NULL) && (*link != timer))
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Type Response from the HM-10 Clone BLE Device was expected, but something else was received instead.\r\n");
-		#endif
-		return HM10_Clone_EC_ERR;
+		previous = *link;
+		link = &previous->next;
+	}
+	if (*link == timer)
+	{
+		*link = timer->next;
+		if (timer->state == HM10_Clone_Timer_ARMED)
+		{
+			timer_armed_count--;
+		}
+		else if (timer_expired_tail == timer)
+		{
+			timer_expired_tail = previous;
+		}
 	}
+	timer->next = NULL;
+	timer->state = HM10_Clone_Timer_IDLE;
+}
+#endif
 
-	/* Pass the BLE Pin Code Mode from the Buffer that is storing it into the \p pin_code_mode param. */
-	*pin_code_mode = TxRx_Buffer[type_resp_size_without_type_cr_and_lf];
+static void module_lock()
+{
+	#if HM10_CLONE_RTOS
+		os_port->mutex_lock(os_mutex);
+	#endif
+}
 
-	#if ETX_OTA_VERBOSE
-		printf("DONE: The BLE Pin Code Mode was successfully received from the HM-10 Clone BLE Device.\r\n");
+static void module_unlock()
+{
+	#if HM10_CLONE_RTOS
+		os_port->mutex_unlock(os_mutex);
 	#endif
+}
 
-	return HM10_Clone_EC_OK;
+static void module_delay(uint32_t ms)
+{
+	#if HM10_CLONE_RTOS
+		os_port->delay(ms);
+	#else
+		HAL_Delay(ms);
+	#endif
 }
 
-HM10_Clone_Status send_hm10clone_ota_data(uint8_t *ble_ota_data, uint16_t size, uint32_t timeout)
+static HAL_StatusTypeDef uart_transmit(uint8_t *data, uint16_t size, uint32_t timeout)
 {
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
-	int16_t  ret;
+	#if HM10_CLONE_RTOS
+		/** <b>Local variable ret:</b> Return value of a HAL function type. */
+		HAL_StatusTypeDef ret;
 
-	/* Send the requested data Over the Air (OTA) via the HM-10 Clone BLE Device. */
-	ret = HAL_UART_Transmit(p_huart, ble_ota_data, size, timeout);
-	ret = HAL_ret_handler(ret);
+		/* Discard any signal that was left by a previous transfer that timed out or that was not made by this function. */
+		while (os_port->semaphore_take(os_tx_semaphore, 0));
+		os_uart_error = 0;
 
-	return ret;
+		ret = HAL_UART_Transmit_IT(p_huart, data, size);
+		if (ret != HAL_OK)
+		{
+			return ret;
+		}
+		if (!os_port->semaphore_take(os_tx_semaphore, timeout))
+		{
+			HAL_UART_AbortTransmit(p_huart);
+			return HAL_TIMEOUT;
+		}
+		if (os_uart_error)
+		{
+			HAL_UART_AbortTransmit(p_huart);
+			return HAL_ERROR;
+		}
+
+		return HAL_OK;
+	#else
+		return HAL_UART_Transmit(p_huart, data, size, timeout);
+	#endif
 }
 
-HM10_Clone_Status get_hm10clone_ota_data(uint8_t *ble_ota_data, uint16_t size, uint32_t timeout)
+static HAL_StatusTypeDef uart_receive(uint8_t *data, uint16_t size, uint32_t timeout)
 {
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Clone_Status function type. */
-	int16_t  ret;
+	#if HM10_CLONE_RTOS
+		/** <b>Local variable ret:</b> Return value of a HAL function type. */
+		HAL_StatusTypeDef ret;
 
-	/* Receive the HM-10 Clone Device's BLE data that is received Over the Air (OTA), if there is any. */
-	ret = HAL_UART_Receive(p_huart, ble_ota_data, size, timeout);
-	ret = HAL_ret_handler(ret);
+		/* Discard any signal that was left by a previous transfer that timed out or that was not made by this function. */
+		while (os_port->semaphore_take(os_rx_semaphore, 0));
+		os_uart_error = 0;
 
-	return ret;
+		ret = HAL_UART_Receive_IT(p_huart, data, size);
+		if (ret != HAL_OK)
+		{
+			return ret;
+		}
+		if (!os_port->semaphore_take(os_rx_semaphore, timeout))
+		{
+			HAL_UART_AbortReceive(p_huart);
+			return HAL_TIMEOUT;
+		}
+		if (os_uart_error)
+		{
+			/* Non-blocking UART errors (e.g., a noise error) do not stop the reception by themselves. */
+			HAL_UART_AbortReceive(p_huart);
+			return HAL_ERROR;
+		}
+
+		return HAL_OK;
+	#else
+		return HAL_UART_Receive(p_huart, data, size, timeout);
+	#endif
 }
 
-static void HAL_uart_rx_flush()
+static HM10_Clone_Status HAL_uart_tx(uint8_t *data, uint16_t size, uint32_t timeout)
+{
+	/** <b>Local variable ret:</b> Return value of a HAL function type. */
+	HAL_StatusTypeDef ret;
+	#if HM10_CLONE_CAPTURE
+		/** <b>Local variable start_tick:</b> HAL Tick at which the transmission was started. */
+		uint32_t start_tick = HAL_GetTick();
+	#endif
+
+	ret = uart_transmit(data, size, timeout);
+	#if HM10_CLONE_CAPTURE
+		capture_record(HM10_CLONE_CAPTURE_TX | ret, start_tick, size, data);
+	#endif
+	#if HM10_CLONE_STATS
+		if (ret == HAL_ERROR)
+		{
+			stats.link.uart_errors++;
+		}
+	#endif
+
+	return HAL_ret_handler(ret);
+}
+
+static HM10_Clone_Status HAL_uart_rx(uint8_t *data, uint16_t size, uint32_t timeout)
+{
+	/** <b>Local variable ret:</b> Return value of a HAL function type. */
+	HAL_StatusTypeDef ret;
+	#if HM10_CLONE_CAPTURE
+		/** <b>Local variable start_tick:</b> HAL Tick at which the reception was started. */
+		uint32_t start_tick = HAL_GetTick();
+	#endif
+
+	ret = uart_receive(data, size, timeout);
+	#if HM10_CLONE_CAPTURE
+		capture_record(HM10_CLONE_CAPTURE_RX | ret, start_tick, size, (ret == HAL_OK) ? data : NULL);
+	#endif
+	#if HM10_CLONE_STATS
+		if (ret == HAL_ERROR)
+		{
+			stats.link.uart_errors++;
+		}
+	#endif
+
+	return HAL_ret_handler(ret);
+}
+
+static uint8_t cmd_populate(const uint8_t *cmd_prefix, uint8_t cmd_prefix_size, const uint8_t *value, uint8_t value_size)
 {
-	/** <b>Local variable ret:</b> Return value of either a HAL function type. */
-	HAL_StatusTypeDef  ret;
+	memcpy(TxRx_Buffer, cmd_prefix, cmd_prefix_size);
+	if (value_size > 0)
+	{
+		memcpy(&TxRx_Buffer[cmd_prefix_size], value, value_size);
+	}
+	memcpy(&TxRx_Buffer[cmd_prefix_size + value_size], HM10_Clone_CR_LF, sizeof(HM10_Clone_CR_LF));
+
+	return cmd_prefix_size + value_size + sizeof(HM10_Clone_CR_LF);
+}
 
+static void HAL_uart_rx_flush()
+{
 	/* Receive the HM-10 Clone Device's BLE data that is received Over the Air (OTA), if there is any. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, 1, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
-	if (ret != HAL_TIMEOUT)
+	for (uint16_t flushed_bytes=0; flushed_bytes<HM10_CLONE_MAX_FLUSH_BYTES; flushed_bytes++)
 	{
-		HAL_uart_rx_flush();
+		#if HM10_CLONE_CAPTURE
+			/** <b>Local variable start_tick:</b> HAL Tick at which the reception was started. */
+			uint32_t start_tick = HAL_GetTick();
+		#endif
+		/** <b>Local variable ret:</b> Return value of a HAL function type. */
+		HAL_StatusTypeDef ret = uart_receive(TxRx_Buffer, 1, HM10_CLONE_CUSTOM_HAL_TIMEOUT);
+		#if HM10_CLONE_CAPTURE
+			capture_record(HM10_CLONE_CAPTURE_RX | ret, start_tick, 1, (ret == HAL_OK) ? TxRx_Buffer : NULL);
+		#endif
+		if (ret != HAL_OK)
+		{
+			return;
+		}
+		HM10_CLONE_LOG(HM10_CLONE_EV_FLUSH_BYTE, TxRx_Buffer[0]);
 	}
+	HM10_CLONE_LOG(HM10_CLONE_EV_FLUSH_LIMIT, HM10_CLONE_MAX_FLUSH_BYTES);
 }
 
 static HM10_Clone_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status)
@@ -0,0 +1,539 @@
+/**@file
+ * @brief	Host-side replayer of the UART traffic that was captured by the AT-09 zs040 BLE Driver.
+ *
+ * @details This program takes a file with the capture records that were made by the @ref hm10_ble_clone with
+ *          @ref HM10_CLONE_CAPTURE enabled (e.g., on a unit in the field, see @ref read_hm10clone_capture ), and calls
+ *          the @ref hm10_ble_clone again with the same AT Commands and OTA data functions that were captured. The HAL
+ *          functions that the @ref hm10_ble_clone uses are implemented right in this file over a virtual clock, where
+ *          the captured Responses of the HM-10 Clone BLE Device are fed back at their original timing relative to the
+ *          beginning of each call, so that the current version of the @ref hm10_ble_clone can be benchmarked and
+ *          regression-tested against the real behaviour of the captured module.
+ *
+ *          A call diverges whenever the @ref hm10_ble_clone transmits other bytes than the captured ones, makes other
+ *          transfers than the captured ones, or returns another status than the captured one. The time that each
+ *          call took is compared against the captured one, and the calls that take longer than the captured time plus
+ *          the tolerance of the -t option are reported as timing regressions. This program exits with a non-zero value
+ *          whenever any call diverges or regresses.
+ *
+ * @note    This program is meant to be compiled and executed on a POSIX host computer, for example with:
+ *          gcc -std=gnu11 -DAT_09_APP_CONFIG_H_ -DHM10_CLONE_NONBLOCKING_API=0 -DHM10_CLONE_CAPTURE=1 -Iposix_hal
+ *              -I../Inc -o AT-09_capture_replayer AT-09_capture_replayer.c ../Src/AT-09_zs040_ble_driver.c
+ *          where the @ref hm10_ble_clone should be compiled with the same configurations as the captured one (e.g.,
+ *          the same timeouts and retry policy), except for the ones that are being evaluated.
+ *
+ * @note    Usage: ./AT-09_capture_replayer [options] <capture file>
+ *          -b <baud rate>  Baud rate of the captured UART (9600 by default).
+ *          -t <ms>         Report the calls that take longer than their captured time plus <ms> as regressions.
+ *          -v              Also show the outcome of each replayed call and each divergence.
+ *
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf", "fopen" and "fread" are located at.
+#include <stdlib.h>	// Library from which "malloc" and "strtoul" are located at.
+#include <string.h>	// Library from which "memcpy", "memcmp" and "strlen" are located at.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <unistd.h>	// Library from which "getopt" is located at.
+#include "AT-09_zs040_ble_driver.h" // This custom Mortrack's library contains the AT-09 zs040 BLE Driver Library.
+
+#if !HM10_CLONE_CAPTURE
+#error "The AT-09 zs040 BLE Driver must be compiled with HM10_CLONE_CAPTURE set to 1 for this program."
+#endif
+
+#define DEFAULT_BAUD_RATE			(9600U)		/**< @brief Default baud rate of the captured UART. */
+#define HAL_CALL_COST_US			(10U)		/**< @brief Virtual time in microseconds that each HAL call takes, so that the loops that poll the HAL Tick advance. */
+#define OTA_TIMEOUT_MARGIN			(1000U)		/**< @brief Time in milliseconds added to the captured time of the OTA data functions and of the calls that did not time out, which is given to them as their timeout. */
+#define MAX_SHOWN_DIVERGENCES		(20)		/**< @brief Number of divergences that are shown without the -v option. */
+
+/**@brief	Capture record together with the data that follows it.
+ */
+typedef struct
+{
+	HM10_Clone_Capture_Record header;	//!< Capture record.
+	const uint8_t *data;				//!< Pointer to the data that follows the capture record, or \c NULL if there is none.
+} Replay_Record;
+
+/**@brief	Names of each @ref HM10_Clone_Cmd .
+ */
+static const char *const cmd_names[HM10_Clone_Cmd_Count] = {"test", "reset", "set_name", "get_name", "set_role", "get_role",
+		"set_pin", "get_pin", "set_pin_code_mode", "get_pin_code_mode", "scan", "connect", "set_auto_reconnect"};
+
+static UART_HandleTypeDef huart;			/**< @brief Simulated UART of the HM-10 Clone BLE Device. */
+static GPIO_TypeDef state_port;				/**< @brief Simulated GPIO Port of the STATE pin. */
+static uint64_t now_us;						/**< @brief Virtual time in microseconds. */
+static int64_t shift_us;					/**< @brief Virtual time minus the captured time at the beginning of the current call. */
+static Replay_Record *records;				/**< @brief Capture records of the capture file. */
+static size_t cursor;						/**< @brief Index of the next capture record that the current call is expected to make. */
+static size_t script_end;					/**< @brief Index after the last capture record of the current call. */
+static uint64_t connected_us;				/**< @brief Virtual time at which the STATE pin goes high, or \c UINT64_MAX if it does not. */
+static uint32_t byte_time_us;				/**< @brief Wire time in microseconds of each byte. */
+static unsigned divergences;				/**< @brief Number of transfers that were not made as captured. */
+static int verbose;							/**< @brief Flag that indicates whether the -v option was given. */
+
+/**@brief	Reports a transfer that was not made as captured.
+ *
+ * @param[in] what	Description of the divergence.
+ */
+static void diverge(const char *what)
+{
+	if (verbose || (divergences < MAX_SHOWN_DIVERGENCES))
+	{
+		printf("    divergence at record %zu: %s\n", cursor, what);
+	}
+	divergences++;
+}
+
+/**@brief	Gives the next capture record of the current call if it is of the given type.
+ *
+ * @param type	Expected type of the capture record (i.e., @ref HM10_CLONE_CAPTURE_TX or @ref HM10_CLONE_CAPTURE_RX ).
+ *
+ * @return	The capture record, which is consumed, or \c NULL if the current call has no more capture records or if
+ *          the next one is of another type, in which case it is not consumed.
+ */
+static const Replay_Record *script_next(uint8_t type)
+{
+	if ((cursor >= script_end) || ((records[cursor].header.info & HM10_CLONE_CAPTURE_TYPE_MASK) != type))
+	{
+		return NULL;
+	}
+	return &records[cursor++];
+}
+
+/**@brief	Gives the virtual time at which a captured transfer concluded.
+ *
+ * @param[in] record	Captured transfer.
+ *
+ * @return	The virtual time in microseconds.
+ */
+static uint64_t record_end_us(const Replay_Record *record)
+{
+	return (uint64_t) (shift_us + ((int64_t) record->header.tick + record->header.duration) * 1000);
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *uart, const uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	const Replay_Record *record = script_next(HM10_CLONE_CAPTURE_TX);
+
+	(void) uart;
+	(void) Timeout;
+	now_us += HAL_CALL_COST_US + (uint64_t) Size * byte_time_us;
+	if (record == NULL)
+	{
+		diverge("transmission that was not captured");
+		return HAL_OK;
+	}
+	if ((record->header.size != Size) || (memcmp(record->data, pData, Size) != 0))
+	{
+		diverge("transmitted bytes differ from the captured ones");
+	}
+	if (record_end_us(record) > now_us)
+	{
+		now_us = record_end_us(record);
+	}
+	return (HAL_StatusTypeDef) (record->header.info & HM10_CLONE_CAPTURE_STATUS_MASK);
+}
+
+HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *uart, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	const Replay_Record *record = script_next(HM10_CLONE_CAPTURE_RX);
+	uint64_t deadline_us = (Timeout == HAL_MAX_DELAY) ? UINT64_MAX : (now_us + (uint64_t) Timeout * 1000U);
+
+	(void) uart;
+	now_us += HAL_CALL_COST_US;
+	if (record == NULL)
+	{
+		/* The captured module did not send anything else during this call. */
+		diverge("reception that was not captured");
+		now_us = deadline_us;
+		return HAL_TIMEOUT;
+	}
+	if (record->header.size != Size)
+	{
+		diverge("reception of another length than the captured one");
+	}
+	if (!(record->header.info & HM10_CLONE_CAPTURE_DATA))
+	{
+		/* The captured reception failed, which is a silence for as long as the current timeout whenever it timed out. */
+		HAL_StatusTypeDef status = (HAL_StatusTypeDef) (record->header.info & HM10_CLONE_CAPTURE_STATUS_MASK);
+		if (status == HAL_TIMEOUT)
+		{
+			now_us = deadline_us;
+		}
+		else if (record_end_us(record) > now_us)
+		{
+			now_us = record_end_us(record);
+		}
+		return status;
+	}
+	if (record_end_us(record) > deadline_us)
+	{
+		diverge("captured Response arrived after the current timeout");
+		now_us = deadline_us;
+		return HAL_TIMEOUT;
+	}
+	if (record_end_us(record) > now_us)
+	{
+		now_us = record_end_us(record);
+	}
+	memcpy(pData, record->data, (record->header.size < Size) ? record->header.size : Size);
+	return HAL_OK;
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+	(void) GPIOx;
+	(void) GPIO_Pin;
+	now_us += HAL_CALL_COST_US;
+	return (now_us >= connected_us) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	now_us += HAL_CALL_COST_US;
+	return (uint32_t) (now_us / 1000U);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+	now_us += HAL_CALL_COST_US + (uint64_t) Delay * 1000U;
+}
+
+/**@brief	Calls the public AT Command function of a captured call with the arguments that were captured.
+ *
+ * @details The arguments are taken from the first captured transmission of the call (i.e., from its AT Command),
+ *          while the timeouts of the Scan and Connect Commands are taken from the captured time that went by since
+ *          that AT Command was transmitted.
+ *
+ * @param cmd			AT Command of the call.
+ * @param[in] tx		First captured transmission of the call, or \c NULL if there is none.
+ * @param[in] end		Captured end of the call.
+ *
+ * @return	The @ref HM10_Clone_Status value returned by the call.
+ */
+static HM10_Clone_Status replay_cmd(HM10_Clone_Cmd cmd, const Replay_Record *tx, const Replay_Record *end)
+{
+	static const uint8_t no_value[HM10_CLONE_MAX_BLE_NAME_SIZE] = "000000000000";
+	uint8_t buffer[HM10_CLONE_MAX_BLE_NAME_SIZE + 2];
+	uint8_t size;
+	const uint8_t *value = no_value;
+	uint16_t value_size = 0;
+	uint32_t timeout = end->header.duration;
+
+	(void) buffer;
+	(void) size;
+	if ((tx != NULL) && ((tx->header.tick + tx->header.duration) < (end->header.tick + end->header.duration)))
+	{
+		/* The timeout of the Scan and Connect Commands starts once their AT Command has been transmitted. */
+		timeout = end->header.tick + end->header.duration - tx->header.tick - tx->header.duration;
+	}
+	if ((end->header.info & HM10_CLONE_CAPTURE_STATUS_MASK) != HM10_Clone_EC_NR)
+	{
+		timeout += OTA_TIMEOUT_MARGIN;
+	}
+	if ((tx != NULL) && (tx->header.size > 2))
+	{
+		/* Skip the AT Command itself (e.g., "AT+NAME") and its Carriage Return and New Line characters. */
+		static const uint8_t prefix_sizes[HM10_Clone_Cmd_Count] = {2, 8, 7, 7, 7, 7, 6, 6, 7, 7, 0, 0, 7};
+		if (tx->header.size >= (prefix_sizes[cmd] + 2))
+		{
+			value = &tx->data[prefix_sizes[cmd]];
+			value_size = tx->header.size - prefix_sizes[cmd] - 2;
+		}
+	}
+
+	switch (cmd)
+	{
+		case HM10_Clone_Cmd_Test:
+			return send_hm10clone_test_cmd();
+		case HM10_Clone_Cmd_Reset:
+			return send_hm10clone_reset_cmd();
+		#if HM10_CLONE_NAME_CMDS
+			case HM10_Clone_Cmd_Set_Name:
+				memcpy(buffer, value, (value_size < sizeof(buffer)) ? value_size : sizeof(buffer));
+				return set_hm10clone_name(buffer, (uint8_t) value_size);
+			#if HM10_CLONE_GETTER_CMDS
+				case HM10_Clone_Cmd_Get_Name:
+					return get_hm10clone_name(buffer, &size);
+			#endif
+		#endif
+		#if HM10_CLONE_ROLE_CMDS
+			case HM10_Clone_Cmd_Set_Role:
+				return set_hm10clone_role((HM10_Clone_Role) value[0]);
+			#if HM10_CLONE_GETTER_CMDS
+				case HM10_Clone_Cmd_Get_Role:
+					return get_hm10clone_role((HM10_Clone_Role *) buffer);
+			#endif
+		#endif
+		#if HM10_CLONE_PIN_CMDS
+			case HM10_Clone_Cmd_Set_Pin:
+				memcpy(buffer, value, HM10_CLONE_PIN_VALUE_SIZE);
+				return set_hm10clone_pin(buffer);
+			#if HM10_CLONE_GETTER_CMDS
+				case HM10_Clone_Cmd_Get_Pin:
+					return get_hm10clone_pin(buffer);
+			#endif
+		#endif
+		#if HM10_CLONE_TYPE_CMDS
+			case HM10_Clone_Cmd_Set_Type:
+				return set_hm10clone_pin_code_mode((HM10_Clone_Pin_Code_Mode) value[0]);
+			#if HM10_CLONE_GETTER_CMDS
+				case HM10_Clone_Cmd_Get_Type:
+					return get_hm10clone_pin_code_mode((HM10_Clone_Pin_Code_Mode *) buffer);
+			#endif
+		#endif
+		#if HM10_CLONE_CENTRAL_API
+			case HM10_Clone_Cmd_Scan:
+				return scan_hm10clone_devices(timeout, NULL, &size);
+			case HM10_Clone_Cmd_Connect:
+			{
+				const size_t prefix_size = sizeof(HM10_CLONE_CONNECT_CMD) - 1 + sizeof(HM10_CLONE_CONNECT_ADDRESS_PREFIX) - 1;
+				uint8_t address[HM10_CLONE_BLE_ADDRESS_SIZE] = {0};
+				uint32_t connect_time;
+				for (size_t digit=0; (tx != NULL) && (digit < HM10_CLONE_BLE_ADDRESS_SIZE*2) && ((prefix_size + digit) < tx->header.size); digit++)
+				{
+					uint8_t c = tx->data[prefix_size + digit];
+					uint8_t nibble = (c >= 'A') ? (c - 'A' + 10) : (c - '0');
+					address[digit / 2] |= (digit % 2) ? nibble : (nibble << 4);
+				}
+				return connect_hm10clone_device(address, timeout, &connect_time);
+			}
+			case HM10_Clone_Cmd_Set_Auto_Reconnect:
+				return set_hm10clone_auto_reconnect((tx != NULL) && (tx->header.size == (sizeof(HM10_CLONE_AUTO_RECONNECT_ON_CMD) - 1 + 2))
+						&& (memcmp(tx->data, HM10_CLONE_AUTO_RECONNECT_ON_CMD, tx->header.size - 2) == 0));
+		#endif
+		default:
+			return HM10_Clone_EC_NA;
+	}
+}
+
+/**@brief	Loads the capture records of a capture file.
+ *
+ * @param[in] path				Path of the capture file.
+ * @param[out] records_count	Number of capture records that were loaded.
+ *
+ * @return	The capture records, or \c NULL on error.
+ */
+static Replay_Record *load_capture(const char *path, size_t *records_count)
+{
+	FILE *file = fopen(path, "rb");
+	uint8_t *bytes;
+	long file_size;
+	Replay_Record *loaded;
+	size_t offset = 0;
+
+	if ((file == NULL) || (fseek(file, 0, SEEK_END) != 0) || ((file_size = ftell(file)) < 0))
+	{
+		perror(path);
+		return NULL;
+	}
+	rewind(file);
+	bytes = malloc(file_size + 1);
+	loaded = malloc((file_size / sizeof(HM10_Clone_Capture_Record) + 1) * sizeof(Replay_Record));
+	if ((bytes == NULL) || (loaded == NULL) || (fread(bytes, 1, file_size, file) != (size_t) file_size))
+	{
+		fprintf(stderr, "ERROR: The capture file \"%s\" could not be read.\n", path);
+		fclose(file);
+		return NULL;
+	}
+	fclose(file);
+
+	*records_count = 0;
+	while ((offset + sizeof(HM10_Clone_Capture_Record)) <= (size_t) file_size)
+	{
+		Replay_Record *record = &loaded[(*records_count)++];
+		memcpy(&record->header, &bytes[offset], sizeof(HM10_Clone_Capture_Record));
+		offset += sizeof(HM10_Clone_Capture_Record);
+		record->data = NULL;
+		if (record->header.info & HM10_CLONE_CAPTURE_DATA)
+		{
+			if ((offset + record->header.size) > (size_t) file_size)
+			{
+				fprintf(stderr, "ERROR: The capture file \"%s\" is truncated at its record %zu.\n", path, *records_count - 1);
+				return NULL;
+			}
+			record->data = &bytes[offset];
+			offset += record->header.size;
+		}
+	}
+	if (offset != (size_t) file_size)
+	{
+		fprintf(stderr, "WARNING: The last %zu bytes of the capture file \"%s\" are not a whole record.\n", file_size - offset, path);
+	}
+	return loaded;
+}
+
+int main(int argc, char *argv[])
+{
+	long tolerance_ms = -1;
+	int option;
+
+	huart.Init.BaudRate = DEFAULT_BAUD_RATE;
+	while ((option = getopt(argc, argv, "b:t:v")) != -1)
+	{
+		switch (option)
+		{
+			case 'b': huart.Init.BaudRate = strtoul(optarg, NULL, 10); break;
+			case 't': tolerance_ms = strtol(optarg, NULL, 10); break;
+			case 'v': verbose = 1; break;
+			default:
+				fprintf(stderr, "Usage: %s [-b baud] [-t ms] [-v] <capture file>\n", argv[0]);
+				return 1;
+		}
+	}
+	if ((optind != (argc - 1)) || (huart.Init.BaudRate == 0))
+	{
+		fprintf(stderr, "Usage: %s [-b baud] [-t ms] [-v] <capture file>\n", argv[0]);
+		return 1;
+	}
+	byte_time_us = (10U * 1000000U + huart.Init.BaudRate - 1) / huart.Init.BaudRate;
+
+	size_t records_count;
+	records = load_capture(argv[optind], &records_count);
+	if (records == NULL)
+	{
+		return 1;
+	}
+
+	/* Replay the captured calls in order, starting each of them no earlier than at its captured time. */
+	GPIO_def_t state_pin = {&state_port, 1};
+	unsigned calls = 0, ota_calls = 0, status_mismatches = 0, regressions = 0, skipped = 0;
+	uint64_t captured_ms = 0, replayed_ms = 0;
+	int64_t offset_us = (records_count > 0) ? (int64_t) now_us - (int64_t) records[0].header.tick * 1000 : 0;
+	init_hm10_clone_module(&huart);
+	#if HM10_CLONE_STATE_PIN
+		set_hm10clone_state_pin(&state_pin);
+	#else
+		(void) state_pin;
+	#endif
+	for (size_t index=0; index<records_count; )
+	{
+		const Replay_Record *begin = &records[index];
+		uint8_t type = begin->header.info & HM10_CLONE_CAPTURE_TYPE_MASK;
+		uint64_t start_us = (uint64_t) (offset_us + (int64_t) begin->header.tick * 1000);
+		const Replay_Record *end = NULL;
+		HM10_Clone_Status status;
+		HM10_Clone_Status captured_status;
+		uint32_t captured_duration;
+		const char *name;
+
+		if (start_us > now_us)
+		{
+			now_us = start_us;
+		}
+		shift_us = (int64_t) now_us - (int64_t) begin->header.tick * 1000;
+		connected_us = UINT64_MAX;
+		uint64_t call_start_us = now_us;
+
+		if (type == HM10_CLONE_CAPTURE_CALL_BEGIN)
+		{
+			/* The capture records of the call are the ones up to its end, which might be missing if the capture was cut. */
+			for (script_end=index+1; script_end<records_count; script_end++)
+			{
+				if ((records[script_end].header.info & HM10_CLONE_CAPTURE_TYPE_MASK) == HM10_CLONE_CAPTURE_CALL_END)
+				{
+					end = &records[script_end];
+					break;
+				}
+			}
+			if ((end == NULL) || (begin->header.size >= HM10_Clone_Cmd_Count))
+			{
+				skipped++;
+				index = script_end + 1;
+				continue;
+			}
+			cursor = index + 1;
+			const Replay_Record *tx = NULL;
+			const Replay_Record *last_tx = NULL;
+			for (size_t i=cursor; i<script_end; i++)
+			{
+				if ((records[i].header.info & HM10_CLONE_CAPTURE_TYPE_MASK) == HM10_CLONE_CAPTURE_TX)
+				{
+					tx = (tx == NULL) ? &records[i] : tx;
+					last_tx = &records[i];
+				}
+			}
+			captured_status = (HM10_Clone_Status) (end->header.info & HM10_CLONE_CAPTURE_STATUS_MASK);
+			captured_duration = end->header.duration;
+			if (captured_status == HM10_Clone_EC_CONNECTED)
+			{
+				/* The STATE pin was high during the whole call, so the AT Command was held back by its connected policy. */
+				connected_us = 0;
+			}
+			if ((begin->header.size == HM10_Clone_Cmd_Connect) && (captured_status == HM10_Clone_EC_OK) && (last_tx != NULL))
+			{
+				/* The STATE pin went high right before the Responses of the connection started to be flushed. */
+				connected_us = UINT64_MAX;
+				for (const Replay_Record *r=last_tx+1; r<end; r++)
+				{
+					if ((r->header.info & HM10_CLONE_CAPTURE_TYPE_MASK) == HM10_CLONE_CAPTURE_RX)
+					{
+						connected_us = (uint64_t) (shift_us + (int64_t) r->header.tick * 1000);
+						break;
+					}
+				}
+				if (connected_us == UINT64_MAX)
+				{
+					connected_us = (uint64_t) (shift_us + ((int64_t) begin->header.tick + captured_duration) * 1000);
+				}
+			}
+			name = cmd_names[begin->header.size];
+			status = replay_cmd((HM10_Clone_Cmd) begin->header.size, tx, end);
+			calls++;
+			index = script_end + 1;
+		}
+		else if ((type == HM10_CLONE_CAPTURE_TX) || (type == HM10_CLONE_CAPTURE_RX))
+		{
+			/* A transfer outside of the AT Command calls was made by the OTA data functions. */
+			uint8_t buffer[UINT16_MAX];
+			HAL_StatusTypeDef hal_status = (HAL_StatusTypeDef) (begin->header.info & HM10_CLONE_CAPTURE_STATUS_MASK);
+			uint32_t timeout = begin->header.duration + ((hal_status == HAL_TIMEOUT) ? 0 : OTA_TIMEOUT_MARGIN);
+			cursor = index;
+			script_end = index + 1;
+			captured_status = (hal_status == HAL_OK) ? HM10_Clone_EC_OK : ((hal_status == HAL_ERROR) ? HM10_Clone_EC_ERR : HM10_Clone_EC_NR);
+			captured_duration = begin->header.duration;
+			if (type == HM10_CLONE_CAPTURE_TX)
+			{
+				name = "send_ota_data";
+				memcpy(buffer, begin->data, begin->header.size);
+				status = send_hm10clone_ota_data(buffer, begin->header.size, timeout);
+			}
+			else
+			{
+				name = "get_ota_data";
+				status = get_hm10clone_ota_data(buffer, begin->header.size, timeout);
+			}
+			ota_calls++;
+			index++;
+		}
+		else
+		{
+			/* A call end without its beginning, which happens whenever the capture ring buffer discarded it. */
+			skipped++;
+			index++;
+			continue;
+		}
+
+		if (cursor < script_end)
+		{
+			diverge("captured transfers that were not made");
+		}
+		uint32_t elapsed_ms = (uint32_t) ((now_us - call_start_us + 999U) / 1000U);
+		int regressed = (tolerance_ms >= 0) && (elapsed_ms > (captured_duration + tolerance_ms));
+		captured_ms += captured_duration;
+		replayed_ms += elapsed_ms;
+		status_mismatches += (status != captured_status);
+		regressions += regressed;
+		if (verbose || (status != captured_status) || regressed)
+		{
+			printf("  %-20s captured: status %u in %6u ms   replayed: status %u in %6u ms%s\n", name, captured_status, captured_duration,
+					status, elapsed_ms, (status != captured_status) ? "  STATUS MISMATCH" : (regressed ? "  REGRESSION" : ""));
+		}
+	}
+
+	printf("\nReplayed %u AT Command calls and %u OTA data calls (%u capture records skipped).\n", calls, ota_calls, skipped);
+	printf("Captured time: %llu ms, replayed time: %llu ms (%+.1f%%).\n", (unsigned long long) captured_ms, (unsigned long long) replayed_ms,
+			captured_ms ? (100.0 * ((double) replayed_ms - (double) captured_ms) / (double) captured_ms) : 0.0);
+	printf("%u status mismatches, %u transfer divergences, %u timing regressions.\n", status_mismatches, divergences, regressions);
+
+	return (status_mismatches || divergences || regressions) ? 1 : 0;
+}
@@ -0,0 +1,570 @@
+/**@file
+ * @brief	Host-side parallel provisioning tool for many HM-10 Clone BLE Devices that are attached through serial ports.
+ *
+ * @details This program configures and verifies a whole batch of HM-10 Clone BLE Devices at once, where each of them is
+ *          attached to the host computer through its own serial port (e.g., through USB-serial hubs at the end of a
+ *          production line). It runs the very same AT Command engine of the @ref hm10_ble_clone on the host, through the
+ *          POSIX serial port shim of the HAL that is located at the "posix_hal" folder.
+ *
+ *          Since the @ref hm10_ble_clone drives a single UART, there is one worker process per serial port. All the
+ *          workers take the units to provision from a single job queue that is shared among them, so that a port that
+ *          finishes early simply takes the next unit. Each unit is given its BLE Name from its serial number (with the
+ *          prefix of the -n option), its Pin, its Role and its Pin Code Mode, and then all of them are read back with
+ *          the getters of the @ref hm10_ble_clone to verify them. A summary with the throughput and the failures is
+ *          shown at the end.
+ *
+ *          The jobs file has one unit per line with the following fields, where the omitted ones take the values of the
+ *          options and where the lines that start with '#' are ignored:
+ *          <serial number> [pin] [role: 0=Peripheral, 1=Central] [pin code mode: 0=Disabled, 1=Enabled]
+ *
+ * @note    This program is meant to be compiled and executed on a POSIX host computer, for example with:
+ *          gcc -std=gnu11 -pthread -DAT_09_APP_CONFIG_H_ -DHM10_CLONE_NONBLOCKING_API=0 -Iposix_hal -I../Inc
+ *              -o AT-09_fleet_provisioner AT-09_fleet_provisioner.c posix_hal/stm32f1xx_hal_posix.c
+ *              ../Src/AT-09_zs040_ble_driver.c
+ *          where "AT_09_APP_CONFIG_H_" is defined so that the configurations of the application of the MCU/MPU are not
+ *          used.
+ *
+ * @note    Usage: ./AT-09_fleet_provisioner [options] <jobs file> [serial port]...
+ *          -b <baud rate>  Baud rate of the serial ports (9600 by default).
+ *          -n <prefix>     Prefix of the BLE Names, which are followed by the serial numbers ("HM10-" by default).
+ *          -p <pin>        Default Pin of the units ("000000" by default).
+ *          -r <0|1>        Default Role of the units (0 by default).
+ *          -t <0|1>        Default Pin Code Mode of the units (0 by default).
+ *          -s <count>      Provision <count> simulated HM-10 Clone BLE Devices that are attached to pseudo-terminal pairs
+ *                          instead of the given serial ports, which is meant to test this program without hardware.
+ *          -d <ms>         Delay in milliseconds before each response of the simulated devices (0 by default).
+ *
+ * @date	October 18, 2026.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>	// Library from which "printf", "fopen" and "fgets" are located at.
+#include <stdlib.h>	// Library from which "strtoul", "posix_openpt", "grantpt", "unlockpt" and "ptsname" are located at.
+#include <string.h>	// Library from which "memcpy", "strlen" and "memcmp" are located at.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <unistd.h>	// Library from which "fork", "getopt", "read" and "write" are located at.
+#include <signal.h>	// Library from which "kill" is located at.
+#include <fcntl.h>	// Library from which "O_RDWR" and "O_NOCTTY" are located at.
+#include <errno.h>	// Library from which "errno" is located at.
+#include <termios.h>	// Library from which "cfmakeraw" and "tcsetattr" are located at.
+#include <sys/mman.h>	// Library from which "mmap" is located at.
+#include <sys/wait.h>	// Library from which "waitpid" is located at.
+#include "AT-09_zs040_ble_driver.h" // This custom Mortrack's library contains the AT-09 zs040 BLE Driver Library.
+
+#define DEFAULT_BAUD_RATE			(9600U)		/**< @brief Default baud rate of the serial ports. */
+#define DEFAULT_NAME_PREFIX			"HM10-"		/**< @brief Default prefix of the BLE Names of the units. */
+#define DEFAULT_PIN					"000000"	/**< @brief Default Pin of the units. */
+#define MAX_PORTS					(64)		/**< @brief Maximum number of serial ports, and therefore of workers. */
+#define MAX_JOBS					(4096)		/**< @brief Maximum number of units in the jobs file. */
+#define MAX_SERIAL_SIZE				(HM10_CLONE_MAX_BLE_NAME_SIZE)	/**< @brief Maximum length of a serial number. */
+#define SIM_LINE_SIZE				(64)		/**< @brief Length in bytes of the longest AT Command that a simulated device accepts. */
+
+/**@brief	Steps of the provisioning of a unit, which tell where a failed unit failed.
+ */
+typedef enum
+{
+	Step_Test = 0,
+	Step_Set_Name,
+	Step_Set_Role,
+	Step_Set_Pin,
+	Step_Set_Pin_Code_Mode,
+	Step_Verify_Name,
+	Step_Verify_Role,
+	Step_Verify_Pin,
+	Step_Verify_Pin_Code_Mode,
+	Step_Reset,
+	Step_Done
+} Provision_Step;
+
+/**@brief	Names of each @ref Provision_Step .
+ */
+static const char *const step_names[] =
+{
+	"test", "set name", "set role", "set pin", "set pin code mode", "verify name", "verify role", "verify pin",
+	"verify pin code mode", "reset", "done"
+};
+
+/**@brief	Configuration of a unit to provision.
+ */
+typedef struct
+{
+	char serial[MAX_SERIAL_SIZE + 1];					//!< Serial number of the unit.
+	uint8_t pin[HM10_CLONE_PIN_VALUE_SIZE];				//!< Pin of the unit.
+	HM10_Clone_Role role;								//!< Role of the unit.
+	HM10_Clone_Pin_Code_Mode pin_code_mode;				//!< Pin Code Mode of the unit.
+} Unit_Job;
+
+/**@brief	Outcome of the provisioning of a unit.
+ */
+typedef struct
+{
+	int port;						//!< Index of the serial port whose worker provisioned the unit, or -1 if none did.
+	Provision_Step step;			//!< Step at which the provisioning concluded, which is @ref Step_Done on success.
+	HM10_Clone_Status status;		//!< Status of the @ref hm10_ble_clone at the \c step field.
+	uint32_t elapsed_ms;			//!< Time in milliseconds that the provisioning took.
+} Unit_Result;
+
+/**@brief	Job queue that is shared among all the workers, which is placed in memory that is shared across @ref fork .
+ */
+typedef struct
+{
+	uint32_t next_job;				//!< Index of the next job to take, which is incremented atomically.
+	uint32_t jobs_count;			//!< Number of valid entries of the \c jobs field.
+	Unit_Job jobs[MAX_JOBS];		//!< Units to provision.
+	Unit_Result results[MAX_JOBS];	//!< Outcome of each of the units of the \c jobs field.
+} Job_Queue;
+
+static char name_prefix[HM10_CLONE_MAX_BLE_NAME_SIZE + 1] = DEFAULT_NAME_PREFIX;	/**< @brief Prefix of the BLE Names of the units. */
+
+/**@brief	Provisions the unit that is attached to the serial port of the current worker.
+ *
+ * @param[in] job		Configuration of the unit.
+ * @param[out] result	Outcome of the provisioning of the unit.
+ */
+static void provision_unit(const Unit_Job *job, Unit_Result *result)
+{
+	char name[sizeof(name_prefix) + MAX_SERIAL_SIZE];
+	uint8_t name_size = (uint8_t) snprintf(name, sizeof(name), "%s%s", name_prefix, job->serial); // Fits in a BLE Name, as checked by load_jobs().
+	uint8_t read_name[HM10_CLONE_MAX_BLE_NAME_SIZE + 2];
+	uint8_t read_name_size;
+	HM10_Clone_Role read_role;
+	uint8_t read_pin[HM10_CLONE_PIN_VALUE_SIZE];
+	HM10_Clone_Pin_Code_Mode read_pin_code_mode;
+	uint32_t start_tick = HAL_GetTick();
+
+	/* Configure the unit and then read everything back, stopping at the first step that fails. */
+	result->step = Step_Test;
+	result->status = send_hm10clone_test_cmd();
+	if (result->status == HM10_Clone_EC_OK)
+	{
+		result->step = Step_Set_Name;
+		result->status = set_hm10clone_name((uint8_t *) name, name_size);
+	}
+	if (result->status == HM10_Clone_EC_OK)
+	{
+		result->step = Step_Set_Role;
+		result->status = set_hm10clone_role(job->role);
+	}
+	if (result->status == HM10_Clone_EC_OK)
+	{
+		result->step = Step_Set_Pin;
+		result->status = set_hm10clone_pin((uint8_t *) job->pin);
+	}
+	if (result->status == HM10_Clone_EC_OK)
+	{
+		result->step = Step_Set_Pin_Code_Mode;
+		result->status = set_hm10clone_pin_code_mode(job->pin_code_mode);
+	}
+	if (result->status == HM10_Clone_EC_OK)
+	{
+		result->step = Step_Verify_Name;
+		result->status = get_hm10clone_name(read_name, &read_name_size);
+		if ((result->status == HM10_Clone_EC_OK) && ((read_name_size != name_size) || (memcmp(read_name, name, name_size) != 0)))
+		{
+			result->status = HM10_Clone_EC_ERR;
+		}
+	}
+	if (result->status == HM10_Clone_EC_OK)
+	{
+		result->step = Step_Verify_Role;
+		result->status = get_hm10clone_role(&read_role);
+		if ((result->status == HM10_Clone_EC_OK) && (read_role != job->role))
+		{
+			result->status = HM10_Clone_EC_ERR;
+		}
+	}
+	if (result->status == HM10_Clone_EC_OK)
+	{
+		result->step = Step_Verify_Pin;
+		result->status = get_hm10clone_pin(read_pin);
+		if ((result->status == HM10_Clone_EC_OK) && (memcmp(read_pin, job->pin, HM10_CLONE_PIN_VALUE_SIZE) != 0))
+		{
+			result->status = HM10_Clone_EC_ERR;
+		}
+	}
+	if (result->status == HM10_Clone_EC_OK)
+	{
+		result->step = Step_Verify_Pin_Code_Mode;
+		result->status = get_hm10clone_pin_code_mode(&read_pin_code_mode);
+		if ((result->status == HM10_Clone_EC_OK) && (read_pin_code_mode != job->pin_code_mode))
+		{
+			result->status = HM10_Clone_EC_ERR;
+		}
+	}
+	if (result->status == HM10_Clone_EC_OK)
+	{
+		/* Apply the new configuration, which the HM-10 Clone BLE Device only uses after a reset. */
+		result->step = Step_Reset;
+		result->status = send_hm10clone_reset_cmd();
+	}
+	if (result->status == HM10_Clone_EC_OK)
+	{
+		result->step = Step_Done;
+	}
+	result->elapsed_ms = HAL_GetTick() - start_tick;
+}
+
+/**@brief	Provisions units from the shared job queue through a serial port until the queue is empty.
+ *
+ * @param port			Index of the serial port.
+ * @param[in] path		Path of the serial port.
+ * @param baud_rate		Baud rate of the serial port.
+ * @param[in,out] queue	Shared job queue.
+ *
+ * @return	The exit status of the worker process.
+ */
+static int run_worker(int port, const char *path, uint32_t baud_rate, Job_Queue *queue)
+{
+	UART_HandleTypeDef huart = {0};
+
+	if (hal_posix_uart_open(&huart, path, baud_rate) != HAL_OK)
+	{
+		fprintf(stderr, "ERROR: The serial port %s could not be opened.\n", path);
+		return 1;
+	}
+	init_hm10_clone_module(&huart);
+
+	for (;;)
+	{
+		uint32_t job = __atomic_fetch_add(&queue->next_job, 1, __ATOMIC_SEQ_CST);
+		if (job >= queue->jobs_count)
+		{
+			break;
+		}
+		queue->results[job].port = port;
+		provision_unit(&queue->jobs[job], &queue->results[job]);
+	}
+
+	hal_posix_uart_close(&huart);
+	return 0;
+}
+
+/**@brief	Answers an AT Command the way that an HM-10 Clone BLE Device does.
+ *
+ * @param fd			File descriptor through which the response is sent.
+ * @param[in] line		AT Command, without its Carriage Return and New Line characters.
+ * @param[in,out] state	Name, Role, Pin and Pin Code Mode of the simulated device, in that order.
+ */
+static void simulate_command(int fd, const char *line, char state[4][HM10_CLONE_MAX_BLE_NAME_SIZE + 1])
+{
+	static const char *const keys[] = {"NAME", "ROLE", "PIN", "TYPE"};
+	static const uint8_t sends_ok[] = {1, 0, 1, 1};
+	char response[SIM_LINE_SIZE + 16];
+	int size = 0;
+
+	if ((strcmp(line, "AT") == 0) || (strcmp(line, "AT+RESET") == 0))
+	{
+		size = snprintf(response, sizeof(response), "OK\r\n");
+	}
+	else if (strncmp(line, "AT+", 3) == 0)
+	{
+		for (int key=0; key<4; key++)
+		{
+			size_t key_size = strlen(keys[key]);
+			if (strncmp(&line[3], keys[key], key_size) == 0)
+			{
+				const char *value = &line[3 + key_size];
+				if (*value != '\0')
+				{
+					snprintf(state[key], sizeof(state[key]), "%s", value);
+				}
+				size = snprintf(response, sizeof(response), "+%s=%s\r\n%s", keys[key], state[key], ((*value != '\0') && sends_ok[key]) ? "OK\r\n" : "");
+				break;
+			}
+		}
+	}
+	if (size == 0)
+	{
+		size = snprintf(response, sizeof(response), "ERROR\r\n");
+	}
+	if (write(fd, response, size) != size)
+	{
+		perror("simulated device");
+	}
+}
+
+/**@brief	Runs a simulated HM-10 Clone BLE Device on the master side of a pseudo-terminal pair.
+ *
+ * @param fd		File descriptor of the master side of the pseudo-terminal pair.
+ * @param delay_ms	Delay in milliseconds before each response.
+ */
+static void run_simulator(int fd, uint32_t delay_ms)
+{
+	char state[4][HM10_CLONE_MAX_BLE_NAME_SIZE + 1] = {"HMSoft", "0", "000000", "0"};
+	char line[SIM_LINE_SIZE];
+	size_t line_size = 0;
+	uint8_t byte;
+
+	for (;;)
+	{
+		ssize_t n = read(fd, &byte, 1);
+		if (n <= 0)
+		{
+			/* The master side reads EIO while no one has the slave side open. */
+			if ((n < 0) && (errno != EIO) && (errno != EINTR) && (errno != EAGAIN))
+			{
+				_exit(1);
+			}
+			HAL_Delay(1);
+			continue;
+		}
+		if (line_size < (sizeof(line) - 1))
+		{
+			line[line_size++] = (char) byte;
+		}
+		if ((line_size >= 2) && (line[line_size-2] == '\r') && (line[line_size-1] == '\n'))
+		{
+			line[line_size-2] = '\0';
+			HAL_Delay(delay_ms);
+			simulate_command(fd, line, state);
+			line_size = 0;
+		}
+	}
+}
+
+/**@brief	Creates a pseudo-terminal pair with a simulated HM-10 Clone BLE Device on its master side.
+ *
+ * @param[out] path		Buffer into which the path of the slave side will be stored.
+ * @param path_size		Length in bytes of the \p path param.
+ * @param delay_ms		Delay in milliseconds before each response of the simulated device.
+ * @param[out] slave_fd	File descriptor of the slave side, which is kept open so that the master side does not hang up.
+ *
+ * @return	The process ID of the simulated device, or -1 on error.
+ */
+static pid_t start_simulator(char *path, size_t path_size, uint32_t delay_ms, int *slave_fd)
+{
+	struct termios tio;
+	int master_fd = posix_openpt(O_RDWR | O_NOCTTY);
+	pid_t pid;
+
+	if ((master_fd < 0) || (grantpt(master_fd) != 0) || (unlockpt(master_fd) != 0))
+	{
+		return -1;
+	}
+	snprintf(path, path_size, "%s", ptsname(master_fd));
+
+	/* Put the slave side in raw mode before anything is written, so that the line discipline does not echo anything. */
+	*slave_fd = open(path, O_RDWR | O_NOCTTY);
+	if ((*slave_fd < 0) || (tcgetattr(*slave_fd, &tio) != 0))
+	{
+		return -1;
+	}
+	cfmakeraw(&tio);
+	tcsetattr(*slave_fd, TCSANOW, &tio);
+
+	pid = fork();
+	if (pid == 0)
+	{
+		close(*slave_fd);
+		run_simulator(master_fd, delay_ms);
+		_exit(0);
+	}
+	close(master_fd);
+
+	return pid;
+}
+
+/**@brief	Loads the units of a jobs file into the job queue.
+ *
+ * @param[in] path				Path of the jobs file.
+ * @param[in] default_pin		Pin of the units whose line does not give one.
+ * @param default_role			Role of the units whose line does not give one.
+ * @param default_pin_code_mode	Pin Code Mode of the units whose line does not give one.
+ * @param[out] queue			Job queue.
+ *
+ * @return	\c 0 on success, or \c 1 on error.
+ */
+static int load_jobs(const char *path, const char *default_pin, int default_role, int default_pin_code_mode, Job_Queue *queue)
+{
+	FILE *file = fopen(path, "r");
+	char line[128];
+	unsigned line_number = 0;
+
+	if (file == NULL)
+	{
+		fprintf(stderr, "ERROR: The jobs file %s could not be opened.\n", path);
+		return 1;
+	}
+	while (fgets(line, sizeof(line), file) != NULL)
+	{
+		char serial[64];
+		char pin[64];
+		int role = default_role;
+		int pin_code_mode = default_pin_code_mode;
+		int fields;
+
+		line_number++;
+		snprintf(pin, sizeof(pin), "%s", default_pin);
+		fields = sscanf(line, "%63s %63s %d %d", serial, pin, &role, &pin_code_mode);
+		if ((fields <= 0) || (serial[0] == '#'))
+		{
+			continue;
+		}
+		if ((strlen(name_prefix) + strlen(serial)) > HM10_CLONE_MAX_BLE_NAME_SIZE)
+		{
+			fprintf(stderr, "ERROR: Line %u of %s gives a BLE Name longer than %d bytes.\n", line_number, path, HM10_CLONE_MAX_BLE_NAME_SIZE);
+			fclose(file);
+			return 1;
+		}
+		if ((strlen(pin) != HM10_CLONE_PIN_VALUE_SIZE) || ((role != 0) && (role != 1)) || ((pin_code_mode != 0) && (pin_code_mode != 1)))
+		{
+			fprintf(stderr, "ERROR: Line %u of %s is invalid.\n", line_number, path);
+			fclose(file);
+			return 1;
+		}
+		if (queue->jobs_count == MAX_JOBS)
+		{
+			fprintf(stderr, "ERROR: The jobs file %s has more than %d units.\n", path, MAX_JOBS);
+			fclose(file);
+			return 1;
+		}
+
+		Unit_Job *job = &queue->jobs[queue->jobs_count];
+		memcpy(job->serial, serial, strlen(serial) + 1);
+		memcpy(job->pin, pin, HM10_CLONE_PIN_VALUE_SIZE);
+		job->role = role ? HM10_Clone_Role_Central : HM10_Clone_Role_Peripheral;
+		job->pin_code_mode = pin_code_mode ? HM10_Clone_Pin_Code_ENABLED : HM10_Clone_Pin_Code_DISABLED;
+		queue->results[queue->jobs_count].port = -1;
+		queue->jobs_count++;
+	}
+	fclose(file);
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t baud_rate = DEFAULT_BAUD_RATE;
+	const char *default_pin = DEFAULT_PIN;
+	int default_role = 0;
+	int default_pin_code_mode = 0;
+	int simulated_count = 0;
+	uint32_t simulated_delay_ms = 0;
+	int option;
+
+	while ((option = getopt(argc, argv, "b:n:p:r:t:s:d:")) != -1)
+	{
+		switch (option)
+		{
+			case 'b': baud_rate = strtoul(optarg, NULL, 10); break;
+			case 'n': snprintf(name_prefix, sizeof(name_prefix), "%s", optarg); break;
+			case 'p': default_pin = optarg; break;
+			case 'r': default_role = atoi(optarg); break;
+			case 't': default_pin_code_mode = atoi(optarg); break;
+			case 's': simulated_count = atoi(optarg); break;
+			case 'd': simulated_delay_ms = strtoul(optarg, NULL, 10); break;
+			default:
+				fprintf(stderr, "Usage: %s [-b baud] [-n prefix] [-p pin] [-r 0|1] [-t 0|1] [-s count] [-d ms] <jobs file> [serial port]...\n", argv[0]);
+				return 1;
+		}
+	}
+	int ports_count = (simulated_count > 0) ? simulated_count : (argc - optind - 1);
+	if ((optind >= argc) || (ports_count <= 0) || (ports_count > MAX_PORTS))
+	{
+		fprintf(stderr, "ERROR: A jobs file and from 1 up to %d serial ports (or -s <count>) must be given.\n", MAX_PORTS);
+		return 1;
+	}
+
+	/* Load the units into a job queue that stays shared among all the worker processes. */
+	Job_Queue *queue = mmap(NULL, sizeof(Job_Queue), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (queue == MAP_FAILED)
+	{
+		perror("mmap");
+		return 1;
+	}
+	queue->next_job = 0;
+	queue->jobs_count = 0;
+	if (load_jobs(argv[optind], default_pin, default_role, default_pin_code_mode, queue) != 0)
+	{
+		return 1;
+	}
+
+	/* Get the serial ports, which are pseudo-terminals with simulated devices whenever requested. */
+	char paths[MAX_PORTS][64];
+	pid_t simulators[MAX_PORTS];
+	int slave_fds[MAX_PORTS];
+	for (int port=0; port<ports_count; port++)
+	{
+		if (simulated_count > 0)
+		{
+			simulators[port] = start_simulator(paths[port], sizeof(paths[port]), simulated_delay_ms, &slave_fds[port]);
+			if (simulators[port] < 0)
+			{
+				fprintf(stderr, "ERROR: The simulated device %d could not be started.\n", port);
+				return 1;
+			}
+		}
+		else
+		{
+			snprintf(paths[port], sizeof(paths[port]), "%s", argv[optind + 1 + port]);
+		}
+	}
+
+	/* Run one worker process per serial port, since the AT-09 zs040 BLE Driver drives a single UART. */
+	uint32_t start_tick = HAL_GetTick();
+	pid_t workers[MAX_PORTS];
+	for (int port=0; port<ports_count; port++)
+	{
+		workers[port] = fork();
+		if (workers[port] == 0)
+		{
+			_exit(run_worker(port, paths[port], baud_rate, queue));
+		}
+	}
+	for (int port=0; port<ports_count; port++)
+	{
+		if (workers[port] > 0)
+		{
+			waitpid(workers[port], NULL, 0);
+		}
+	}
+	uint32_t elapsed_ms = HAL_GetTick() - start_tick;
+	for (int port=0; (simulated_count>0) && (port<ports_count); port++)
+	{
+		kill(simulators[port], SIGTERM);
+		waitpid(simulators[port], NULL, 0);
+		close(slave_fds[port]);
+	}
+
+	/* Display the outcome of each unit and the summary of the whole batch. */
+	unsigned ok_count = 0;
+	unsigned port_units[MAX_PORTS] = {0};
+	unsigned port_failures[MAX_PORTS] = {0};
+	unsigned step_failures[Step_Done] = {0};
+	for (uint32_t job=0; job<queue->jobs_count; job++)
+	{
+		const Unit_Result *result = &queue->results[job];
+		if (result->port < 0)
+		{
+			printf("%-*s  not provisioned\n", MAX_SERIAL_SIZE, queue->jobs[job].serial);
+			continue;
+		}
+		port_units[result->port]++;
+		if (result->step == Step_Done)
+		{
+			ok_count++;
+			printf("%-*s  %-20s OK      %6u ms\n", MAX_SERIAL_SIZE, queue->jobs[job].serial, paths[result->port], result->elapsed_ms);
+		}
+		else
+		{
+			port_failures[result->port]++;
+			step_failures[result->step]++;
+			printf("%-*s  %-20s FAILED  %6u ms  (%s: status %u)\n", MAX_SERIAL_SIZE, queue->jobs[job].serial, paths[result->port], result->elapsed_ms, step_names[result->step], result->status);
+		}
+	}
+	printf("\nProvisioned %u/%u units in %.2f s through %d ports (%.1f units/min).\n", ok_count, queue->jobs_count,
+			elapsed_ms / 1000.0, ports_count, elapsed_ms ? (ok_count * 60000.0 / elapsed_ms) : 0.0);
+	for (int port=0; port<ports_count; port++)
+	{
+		printf("  %-20s %u units, %u failed\n", paths[port], port_units[port], port_failures[port]);
+	}
+	for (int step=0; step<Step_Done; step++)
+	{
+		if (step_failures[step] > 0)
+		{
+			printf("  %u failures at %s\n", step_failures[step], step_names[step]);
+		}
+	}
+
+	return (ok_count == queue->jobs_count) ? 0 : 2;
+}
@@ -0,0 +1,322 @@
+/**@file
+ * @brief	Host-side round-trip latency probe of the Over the Air (OTA) data of an HM-10 Clone BLE Device.
+ *
+ * @details This program measures the round-trip latency of the link between the host computer and the other side of
+ *          the BLE Connection of an HM-10 Clone BLE Device that is attached through a serial port. It runs the very
+ *          same @ref AT_09_ping of the @ref hm10_ble_clone on the host, through the POSIX serial port shim of the HAL
+ *          that is located at the "posix_hal" folder, so that the other side only needs to call
+ *          @ref poll_hm10clone_ping periodically (or to run this very program with the -e option) to echo the probes
+ *          back.
+ *
+ *          Each probe is sent with @ref send_hm10clone_ping and its round-trip time is shown whenever the -v option is
+ *          given. A summary is shown at the end with the lost probes, the shortest, mean and longest round-trip times,
+ *          the exact percentiles of all the round-trip times that were measured, the percentiles that the
+ *          @ref AT_09_ping estimates from its histogram (which are the ones that are available on the MCU/MPU), and the
+ *          histogram itself.
+ *
+ * @note    This program is meant to be compiled and executed on a POSIX host computer, for example with:
+ *          gcc -std=gnu11 -pthread -DAT_09_APP_CONFIG_H_ -DHM10_CLONE_NONBLOCKING_API=0 -DHM10_CLONE_PING=1 -Iposix_hal
+ *              -I../Inc -o AT-09_latency_probe AT-09_latency_probe.c posix_hal/stm32f1xx_hal_posix.c
+ *              ../Src/AT-09_zs040_ble_driver.c ../Src/AT-09_ping.c
+ *          where "AT_09_APP_CONFIG_H_" is defined so that the configurations of the application of the MCU/MPU are not
+ *          used.
+ *
+ * @note    Usage: ./AT-09_latency_probe [options] [serial port]
+ *          -b <baud rate>  Baud rate of the serial port (9600 by default).
+ *          -c <count>      Number of probes to send (100 by default).
+ *          -l <bytes>      Length in bytes of the payload of each probe (16 by default).
+ *          -i <ms>         Interval in milliseconds between the probes (100 by default).
+ *          -t <ms>         Time in milliseconds to wait for the echo of each probe (1000 by default).
+ *          -e              Echo back the probes of the other side until this program is terminated, instead of
+ *                          sending probes.
+ *          -s              Send the probes to a simulated echo responder that is attached to a pseudo-terminal pair
+ *                          instead of the given serial port, which is meant to test this program without hardware.
+ *          -d <ms>         Period in milliseconds at which the simulated echo responder polls the received data, which
+ *                          emulates the Connection Interval of a BLE Connection (0 by default).
+ *          -v              Also show the round-trip time of each probe.
+ *
+ * @date	October 18, 2026.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>	// Library from which "printf" and "snprintf" are located at.
+#include <stdlib.h>	// Library from which "strtoul", "qsort", "posix_openpt", "grantpt", "unlockpt" and "ptsname" are located at.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <unistd.h>	// Library from which "fork", "getopt" and "close" are located at.
+#include <signal.h>	// Library from which "kill" is located at.
+#include <fcntl.h>	// Library from which "O_RDWR" and "O_NOCTTY" are located at.
+#include <termios.h>	// Library from which "cfmakeraw" and "tcsetattr" are located at.
+#include <sys/wait.h>	// Library from which "waitpid" is located at.
+#include "AT-09_zs040_ble_driver.h" // This custom Mortrack's library contains the AT-09 zs040 BLE Driver Library.
+#include "AT-09_ping.h" // This custom Mortrack's library contains the round-trip latency probe of the AT-09 zs040 BLE Driver Library.
+
+#define DEFAULT_BAUD_RATE			(9600U)		/**< @brief Default baud rate of the serial port. */
+#define DEFAULT_COUNT				(100U)		/**< @brief Default number of probes to send. */
+#define DEFAULT_PAYLOAD_SIZE		(16U)		/**< @brief Default length in bytes of the payload of each probe. */
+#define DEFAULT_INTERVAL			(100U)		/**< @brief Default interval in milliseconds between the probes. */
+#define DEFAULT_TIMEOUT				(1000U)		/**< @brief Default time in milliseconds to wait for the echo of each probe. */
+#define HISTOGRAM_BAR_SIZE			(40)		/**< @brief Length in characters of the longest bar of the histogram. */
+
+/**@brief	Echoes back the probes of the other side until this program is terminated.
+ *
+ * @param period_ms	Period in milliseconds at which the received data is polled, or \c 0 to poll it continuously.
+ */
+static void run_echo_responder(uint32_t period_ms)
+{
+	for (;;)
+	{
+		if (poll_hm10clone_ping() != HM10_Clone_EC_OK)
+		{
+			return;
+		}
+		if (period_ms > 0)
+		{
+			HAL_Delay(period_ms);
+		}
+	}
+}
+
+/**@brief	Starts a simulated echo responder, which runs the @ref AT_09_ping on the master side of a pseudo-terminal
+ *          pair.
+ *
+ * @param[out] path		Path of the slave side of the pseudo-terminal pair, which is the serial port to probe.
+ * @param path_size		Length in bytes of the \p path param.
+ * @param period_ms		Period in milliseconds at which the simulated echo responder polls the received data.
+ * @param[out] slave_fd	File descriptor of the slave side, which is kept open so that the master side is never hung up.
+ *
+ * @return	The process ID of the simulated echo responder, or \c -1 on error.
+ */
+static pid_t start_echo_responder(char *path, size_t path_size, uint32_t period_ms, int *slave_fd)
+{
+	struct termios tio;
+	int master_fd = posix_openpt(O_RDWR | O_NOCTTY);
+	pid_t pid;
+
+	if ((master_fd < 0) || (grantpt(master_fd) != 0) || (unlockpt(master_fd) != 0))
+	{
+		return -1;
+	}
+	snprintf(path, path_size, "%s", ptsname(master_fd));
+
+	/* Put the slave side in raw mode before anything is written, so that the line discipline does not echo anything. */
+	*slave_fd = open(path, O_RDWR | O_NOCTTY);
+	if ((*slave_fd < 0) || (tcgetattr(*slave_fd, &tio) != 0))
+	{
+		return -1;
+	}
+	cfmakeraw(&tio);
+	tcsetattr(*slave_fd, TCSANOW, &tio);
+
+	pid = fork();
+	if (pid == 0)
+	{
+		UART_HandleTypeDef huart = {0};
+
+		close(*slave_fd);
+		if (hal_posix_uart_attach(&huart, master_fd) != HAL_OK)
+		{
+			_exit(1);
+		}
+		init_hm10_clone_module(&huart);
+		init_hm10clone_ping();
+		run_echo_responder(period_ms);
+		_exit(0);
+	}
+	close(master_fd);
+
+	return pid;
+}
+
+/**@brief	Compares two round-trip times for @ref qsort .
+ */
+static int compare_rtt(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *) a;
+	uint32_t y = *(const uint32_t *) b;
+
+	return (x > y) - (x < y);
+}
+
+/**@brief	Shows the summary of the round-trip times that were measured.
+ *
+ * @param[in,out] rtts	Round-trip times in microseconds of the echoes that were received, which are sorted by this
+ *                      function.
+ * @param rtts_count	Number of valid entries of the \p rtts param.
+ */
+static void show_summary(uint32_t *rtts, uint32_t rtts_count)
+{
+	static const uint8_t percentiles[] = {50, 90, 99};
+	HM10_Clone_Ping_Stats stats;
+	uint32_t highest_count = 0;
+
+	get_hm10clone_ping_stats(&stats);
+	printf("\n%u probes sent, %u echoes received, %u lost (%.1f%%), %u late echoes.\n", stats.probes_sent,
+			stats.echoes_received, stats.timeouts, stats.probes_sent ? (stats.timeouts * 100.0 / stats.probes_sent) : 0.0,
+			stats.late_echoes);
+	if (rtts_count == 0)
+	{
+		return;
+	}
+	printf("Round-trip time (ms): min %.3f, avg %.3f, max %.3f\n", stats.rtt_min_us / 1000.0,
+			(double) stats.rtt_sum_us / stats.echoes_received / 1000.0, stats.rtt_max_us / 1000.0);
+
+	/* Compare the exact percentiles with the ones that the ping layer estimates from its histogram. */
+	qsort(rtts, rtts_count, sizeof(rtts[0]), compare_rtt);
+	printf("Percentile    exact (ms)    histogram (ms)\n");
+	for (size_t i=0; i<(sizeof(percentiles)/sizeof(percentiles[0])); i++)
+	{
+		uint32_t rank = (uint32_t) (((uint64_t) rtts_count * percentiles[i] + 99) / 100);
+		printf("  p%-9u  %10.3f    %14.3f\n", percentiles[i], rtts[rank - 1] / 1000.0,
+				get_hm10clone_ping_percentile(&stats, percentiles[i]) / 1000.0);
+	}
+
+	/* Show the buckets of the histogram from the first up to the last one that is not empty. */
+	int first = -1;
+	int last = -1;
+	for (int bucket=0; bucket<(int) HM10_CLONE_PING_HISTOGRAM_BUCKETS; bucket++)
+	{
+		if (stats.rtt_histogram[bucket] > 0)
+		{
+			first = (first < 0) ? bucket : first;
+			last = bucket;
+			highest_count = (stats.rtt_histogram[bucket] > highest_count) ? stats.rtt_histogram[bucket] : highest_count;
+		}
+	}
+	printf("Histogram (us)\n");
+	for (int bucket=first; bucket<=last; bucket++)
+	{
+		char range[32];
+		int bar_size = (int) (((uint64_t) stats.rtt_histogram[bucket] * HISTOGRAM_BAR_SIZE + highest_count - 1) / highest_count);
+
+		if (bucket == ((int) HM10_CLONE_PING_HISTOGRAM_BUCKETS - 1))
+		{
+			snprintf(range, sizeof(range), ">= %lu", 1UL << bucket);
+		}
+		else
+		{
+			snprintf(range, sizeof(range), "< %lu", 1UL << (bucket + 1));
+		}
+		printf("  %-12s %6u  %.*s\n", range, stats.rtt_histogram[bucket], bar_size, "########################################");
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t baud_rate = DEFAULT_BAUD_RATE;
+	uint32_t count = DEFAULT_COUNT;
+	uint32_t payload_size = DEFAULT_PAYLOAD_SIZE;
+	uint32_t interval_ms = DEFAULT_INTERVAL;
+	uint32_t timeout_ms = DEFAULT_TIMEOUT;
+	uint32_t simulated_period_ms = 0;
+	int echo_mode = 0;
+	int simulated = 0;
+	int verbose = 0;
+	int option;
+
+	while ((option = getopt(argc, argv, "b:c:l:i:t:esd:v")) != -1)
+	{
+		switch (option)
+		{
+			case 'b': baud_rate = strtoul(optarg, NULL, 10); break;
+			case 'c': count = strtoul(optarg, NULL, 10); break;
+			case 'l': payload_size = strtoul(optarg, NULL, 10); break;
+			case 'i': interval_ms = strtoul(optarg, NULL, 10); break;
+			case 't': timeout_ms = strtoul(optarg, NULL, 10); break;
+			case 'e': echo_mode = 1; break;
+			case 's': simulated = 1; break;
+			case 'd': simulated_period_ms = strtoul(optarg, NULL, 10); break;
+			case 'v': verbose = 1; break;
+			default:
+				fprintf(stderr, "Usage: %s [-b baud] [-c count] [-l bytes] [-i ms] [-t ms] [-e] [-s] [-d ms] [-v] [serial port]\n", argv[0]);
+				return 1;
+		}
+	}
+	if ((!simulated && (optind != (argc - 1))) || (simulated && echo_mode))
+	{
+		fprintf(stderr, "ERROR: Either a serial port or the -s option (but not together with -e) must be given.\n");
+		return 1;
+	}
+	if ((count == 0) || (payload_size > HM10_CLONE_PING_MAX_PAYLOAD))
+	{
+		fprintf(stderr, "ERROR: At least one probe of up to %u bytes of payload must be sent.\n", HM10_CLONE_PING_MAX_PAYLOAD);
+		return 1;
+	}
+
+	/* Get the serial port, which is a pseudo-terminal with a simulated echo responder whenever requested. */
+	char path[64];
+	pid_t responder = -1;
+	int slave_fd = -1;
+	if (simulated)
+	{
+		responder = start_echo_responder(path, sizeof(path), simulated_period_ms, &slave_fd);
+		if (responder < 0)
+		{
+			fprintf(stderr, "ERROR: The simulated echo responder could not be started.\n");
+			return 1;
+		}
+	}
+	else
+	{
+		snprintf(path, sizeof(path), "%s", argv[optind]);
+	}
+
+	UART_HandleTypeDef huart = {0};
+	if (hal_posix_uart_open(&huart, path, baud_rate) != HAL_OK)
+	{
+		fprintf(stderr, "ERROR: The serial port %s could not be opened.\n", path);
+		return 1;
+	}
+	init_hm10_clone_module(&huart);
+	init_hm10clone_ping();
+	if (echo_mode)
+	{
+		printf("Echoing back the probes received through %s.\n", path);
+		run_echo_responder(0);
+		hal_posix_uart_close(&huart);
+		return 1;
+	}
+
+	/* Send the probes and keep the round-trip time of each echo, so that the exact percentiles can be shown. */
+	uint32_t *rtts = malloc(count * sizeof(uint32_t));
+	uint32_t rtts_count = 0;
+	if (rtts == NULL)
+	{
+		perror("malloc");
+		return 1;
+	}
+	printf("Sending %u probes of %u bytes of payload through %s.\n", count, payload_size, path);
+	for (uint32_t probe=0; probe<count; probe++)
+	{
+		uint32_t rtt_us;
+		HM10_Clone_Status ret = send_hm10clone_ping((uint8_t) payload_size, timeout_ms, &rtt_us);
+
+		if (ret == HM10_Clone_EC_OK)
+		{
+			rtts[rtts_count++] = rtt_us;
+			if (verbose)
+			{
+				printf("  probe %-6u %10.3f ms\n", probe, rtt_us / 1000.0);
+			}
+		}
+		else if (verbose)
+		{
+			printf("  probe %-6u lost (status %u)\n", probe, ret);
+		}
+		if ((interval_ms > 0) && ((probe + 1) < count))
+		{
+			HAL_Delay(interval_ms);
+		}
+	}
+	show_summary(rtts, rtts_count);
+
+	free(rtts);
+	hal_posix_uart_close(&huart);
+	if (simulated)
+	{
+		kill(responder, SIGTERM);
+		waitpid(responder, NULL, 0);
+		close(slave_fd);
+	}
+
+	return (rtts_count > 0) ? 0 : 1;
+}
@@ -0,0 +1,596 @@
+/**@file
+ * @brief	Host-side benchmark of the Over the Air (OTA) data path of the AT-09 zs040 BLE Driver over a lossy link.
+ *
+ * @details This program measures the OTA data path of the @ref hm10_ble_clone with its own
+ *          @ref HM10_CLONE_OTA_BENCHMARK measurements, by running it on the host through the POSIX serial port shim of
+ *          the HAL that is located at the "posix_hal" folder against a simulated BLE link that is attached to a
+ *          pseudo-terminal pair. That simulated link splits the stream that it receives into BLE packets of up to
+ *          @ref LINK_PACKET_SIZE bytes, drops each of them with the requested probability (in both directions) and,
+ *          whenever requested, only delivers them once per Connection Interval. Its other side is a peer that
+ *          validates the frames of this program and acknowledges them.
+ *
+ *          Each frame is made of a sync byte, a 16-bit sequence number, a length byte, the payload and a CRC-8 of all
+ *          the previous bytes, where every byte after the sync byte that equals a sync byte or @ref FRAME_ESCAPE is sent
+ *          as @ref FRAME_ESCAPE followed by that byte XOR @ref FRAME_ESCAPE_XOR . Thus, a sync byte always starts a
+ *          frame, so the peer resynchronises on the very next frame after a dropped packet. Everything but the payload
+ *          (including those escapes) is reported as protocol overhead via @ref add_hm10clone_ota_benchmark_overhead .
+ *          Three traffic profiles can be measured:
+ *          - bulk: frames of @ref BULK_PAYLOAD_SIZE bytes of payload, sent with stop-and-wait and retransmitted until
+ *            they are acknowledged, just like a firmware transfer.
+ *          - chatty: the same as bulk but with frames of only @ref CHATTY_PAYLOAD_SIZE bytes of payload, just like a
+ *            command/response protocol.
+ *          - telemetry: records of @ref TELEMETRY_PAYLOAD_SIZE bytes that are sent periodically, without being
+ *            acknowledged nor retransmitted, just like a sensor stream.
+ *
+ *          The report shows the goodput, the protocol overhead (which includes the retransmissions and the
+ *          acknowledgements), the clock counts per delivered byte and the tail latencies of each direction, together
+ *          with the packets that the simulated link dropped and the frames that the peer delivered.
+ *
+ * @note    This program is meant to be compiled and executed on a POSIX host computer, for example with:
+ *          gcc -std=gnu11 -pthread -DAT_09_APP_CONFIG_H_ -DHM10_CLONE_NONBLOCKING_API=0 -DHM10_CLONE_OTA_BENCHMARK=1
+ *              -Iposix_hal -I../Inc -o AT-09_ota_benchmark AT-09_ota_benchmark.c posix_hal/stm32f1xx_hal_posix.c
+ *              ../Src/AT-09_zs040_ble_driver.c
+ *          where "AT_09_APP_CONFIG_H_" is defined so that the configurations of the application of the MCU/MPU are not
+ *          used. The clock of the measurements is then the one of @ref hal_posix_clock_us (see
+ *          @ref HM10_CLONE_OTA_BENCHMARK_CLOCK ), so the clock counts are microseconds instead of CPU cycles.
+ *
+ * @note    Usage: ./AT-09_ota_benchmark [options]
+ *          -p <profile>    Traffic profile to measure: bulk, chatty or telemetry (bulk by default).
+ *          -n <count>      Number of frames to deliver (200 by default).
+ *          -l <percent>    Probability in percent with which the simulated link drops each packet (0 by default).
+ *          -r <seed>       Seed of the drops of the simulated link (1 by default).
+ *          -d <ms>         Connection Interval in milliseconds of the simulated link, or 0 to deliver each packet as
+ *                          soon as possible (0 by default).
+ *          -t <ms>         Time in milliseconds to wait for the acknowledgement of each frame (200 by default).
+ *          -i <ms>         Period in milliseconds of the telemetry profile (20 by default).
+ *
+ * @date	October 18, 2026.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>	// Library from which "printf" and "snprintf" are located at.
+#include <stdlib.h>	// Library from which "strtoul", "strtod", "rand_r", "posix_openpt", "grantpt", "unlockpt" and "ptsname" are located at.
+#include <string.h>	// Library from which "strcmp" is located at.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <unistd.h>	// Library from which "fork", "getopt", "read", "write" and "close" are located at.
+#include <signal.h>	// Library from which "kill" is located at.
+#include <fcntl.h>	// Library from which "open", "O_RDWR" and "O_NOCTTY" are located at.
+#include <poll.h>	// Library from which "poll" is located at.
+#include <termios.h>	// Library from which "cfmakeraw" and "tcsetattr" are located at.
+#include <sys/mman.h>	// Library from which "mmap" is located at.
+#include <sys/wait.h>	// Library from which "waitpid" is located at.
+#include "AT-09_zs040_ble_driver.h" // This custom Mortrack's library contains the AT-09 zs040 BLE Driver Library.
+
+#if !HM10_CLONE_OTA_BENCHMARK
+#error "The AT-09 zs040 BLE Driver must be compiled with HM10_CLONE_OTA_BENCHMARK set to 1 for this program."
+#endif
+
+#define DEFAULT_COUNT				(200U)		/**< @brief Default number of frames to deliver. */
+#define DEFAULT_ACK_TIMEOUT			(200U)		/**< @brief Default time in milliseconds to wait for the acknowledgement of each frame. */
+#define DEFAULT_TELEMETRY_PERIOD	(20U)		/**< @brief Default period in milliseconds of the telemetry profile. */
+#define SEND_TIMEOUT				(1000U)		/**< @brief Time in milliseconds given to @ref send_hm10clone_ota_data for each frame. */
+#define MAX_RETRANSMISSIONS			(20U)		/**< @brief Number of retransmissions after which a frame is given up. */
+#define LINK_PACKET_SIZE			(18U)		/**< @brief Length in bytes of the BLE packets into which the simulated link splits the stream. */
+#define BULK_PAYLOAD_SIZE			(180U)		/**< @brief Length in bytes of the payload of each frame of the bulk profile. */
+#define CHATTY_PAYLOAD_SIZE			(4U)		/**< @brief Length in bytes of the payload of each frame of the chatty profile. */
+#define TELEMETRY_PAYLOAD_SIZE		(12U)		/**< @brief Length in bytes of the payload of each record of the telemetry profile. */
+#define FRAME_SYNC_ACKED			(0xA5)		/**< @brief Sync byte of the frames that the peer must acknowledge. */
+#define FRAME_SYNC_UNACKED			(0xA6)		/**< @brief Sync byte of the frames that the peer must not acknowledge. */
+#define ACK_SYNC					(0x5A)		/**< @brief Sync byte of the acknowledgements of the peer. */
+#define FRAME_ESCAPE				(0x7D)		/**< @brief Byte that precedes each escaped byte of a frame. */
+#define FRAME_ESCAPE_XOR			(0x20)		/**< @brief Value with which each escaped byte of a frame is XORed. */
+#define FRAME_HEADER_SIZE			(4U)		/**< @brief Length in bytes of the sync byte, the sequence number and the length byte of a frame. */
+#define FRAME_OVERHEAD_SIZE			(FRAME_HEADER_SIZE + 1U)	/**< @brief Length in bytes of everything in a frame but its payload. */
+#define ACK_SIZE					(4U)		/**< @brief Length in bytes of an acknowledgement, which is its sync byte, the sequence number that it acknowledges and a CRC-8. */
+#define MAX_FRAME_SIZE				(FRAME_OVERHEAD_SIZE + BULK_PAYLOAD_SIZE)	/**< @brief Length in bytes of the largest frame, without its escapes. */
+#define MAX_WIRE_FRAME_SIZE			(1U + 2U * (MAX_FRAME_SIZE - 1U))			/**< @brief Length in bytes of the largest frame, with every byte after its sync byte escaped. */
+
+/**@brief	Traffic profiles definitions.
+ */
+typedef enum
+{
+	Profile_BULK		= 0,	//!< Large frames with stop-and-wait and retransmissions.
+	Profile_CHATTY		= 1,	//!< Small frames with stop-and-wait and retransmissions.
+	Profile_TELEMETRY	= 2		//!< Small periodic frames without acknowledgements nor retransmissions.
+} Profile;
+
+/**@brief	Counters of the simulated link and of its peer, which are shared with the process of this program.
+ */
+typedef struct
+{
+	uint32_t packets;			//!< Packets that the simulated link carried in both directions, including the dropped ones.
+	uint32_t dropped_packets;	//!< Packets that the simulated link dropped in both directions.
+	uint32_t frames;			//!< Distinct frames that the peer delivered.
+	uint32_t duplicate_frames;	//!< Frames that the peer received again after having delivered them.
+	uint32_t bad_frames;		//!< Frames that the peer discarded because a dropped packet cut them short or because their CRC-8 or their length was wrong.
+	uint32_t payload_bytes;		//!< Bytes of payload of the distinct frames that the peer delivered.
+} Link_Counters;
+
+/**@brief	Parser states of the frames that the peer receives.
+ */
+typedef enum
+{
+	Peer_SYNC		= 0,	//!< Waiting for a sync byte.
+	Peer_HEADER		= 1,	//!< Receiving the rest of the header.
+	Peer_PAYLOAD	= 2		//!< Receiving the payload and the CRC-8.
+} Peer_State;
+
+/**@brief	Updates a CRC-8 (polynomial 0x07) with a byte.
+ *
+ * @param crc	Current value of the CRC.
+ * @param byte	Byte with which the CRC is updated.
+ *
+ * @return	The updated value of the CRC.
+ */
+static uint8_t crc8_update(uint8_t crc, uint8_t byte)
+{
+	crc ^= byte;
+	for (uint8_t bit=0; bit<8; bit++)
+	{
+		crc = (crc & 0x80) ? ((crc << 1) ^ 0x07) : (crc << 1);
+	}
+
+	return crc;
+}
+
+/**@brief	Gives a chunk of bytes to the simulated link, which drops each of its packets with the given probability.
+ *
+ * @param[in] data			Bytes that are carried.
+ * @param size				Length in bytes of the \p data param.
+ * @param loss_percent		Probability in percent with which each packet is dropped.
+ * @param[in,out] seed		Seed of the drops.
+ * @param[out] delivered	Pointer to the Memory Address into which the packets that were not dropped are copied.
+ * @param[in,out] counters	Counters of the simulated link.
+ *
+ * @return	The number of bytes that were copied into the \p delivered param.
+ */
+static size_t link_carry(const uint8_t *data, size_t size, double loss_percent, unsigned int *seed, uint8_t *delivered, Link_Counters *counters)
+{
+	size_t delivered_size = 0;
+
+	for (size_t offset=0; offset<size; offset+=LINK_PACKET_SIZE)
+	{
+		size_t packet_size = ((size - offset) < LINK_PACKET_SIZE) ? (size - offset) : LINK_PACKET_SIZE;
+
+		counters->packets++;
+		if ((rand_r(seed) * 100.0 / ((double) RAND_MAX + 1.0)) < loss_percent)
+		{
+			counters->dropped_packets++;
+			continue;
+		}
+		memcpy(&delivered[delivered_size], &data[offset], packet_size);
+		delivered_size += packet_size;
+	}
+
+	return delivered_size;
+}
+
+/**@brief	Runs the simulated link and its peer on the master side of a pseudo-terminal pair until it is terminated.
+ *
+ * @param fd				File descriptor of the master side.
+ * @param loss_percent		Probability in percent with which each packet is dropped.
+ * @param seed				Seed of the drops.
+ * @param interval_ms		Connection Interval in milliseconds, or \c 0 to deliver each packet as soon as possible.
+ * @param[in,out] counters	Counters of the simulated link, which are shared with the process of this program.
+ */
+static void run_link(int fd, double loss_percent, unsigned int seed, uint32_t interval_ms, Link_Counters *counters)
+{
+	static uint8_t received[4096];
+	static uint8_t delivered[4096];
+	static uint8_t frame[MAX_FRAME_SIZE];
+	static uint8_t delivered_seqs[65536 / 8];
+	Peer_State state = Peer_SYNC;
+	uint8_t escaped = 0;
+	uint16_t frame_size = 0;
+	uint16_t expected_size = 0;
+	struct pollfd pfd = {.fd = fd, .events = POLLIN};
+
+	for (;;)
+	{
+		/* Gather everything that was sent during a whole Connection Interval, whenever there is one. */
+		if (interval_ms > 0)
+		{
+			usleep(interval_ms * 1000U);
+		}
+		else if (poll(&pfd, 1, 100) <= 0)
+		{
+			continue;
+		}
+		ssize_t received_size = read(fd, received, sizeof(received));
+		if (received_size <= 0)
+		{
+			continue;
+		}
+		size_t delivered_size = link_carry(received, (size_t) received_size, loss_percent, &seed, delivered, counters);
+
+		/* Parse the frames out of the packets that were not dropped, where a sync byte always starts a new frame, since
+		 * any other one is escaped, and therefore ends any frame that lost a packet. */
+		for (size_t i=0; i<delivered_size; i++)
+		{
+			uint8_t byte = delivered[i];
+
+			if ((byte == FRAME_SYNC_ACKED) || (byte == FRAME_SYNC_UNACKED))
+			{
+				if (state != Peer_SYNC)
+				{
+					counters->bad_frames++;
+				}
+				frame[0] = byte;
+				frame_size = 1;
+				escaped = 0;
+				state = Peer_HEADER;
+				continue;
+			}
+			if (state == Peer_SYNC)
+			{
+				continue;
+			}
+			if (byte == FRAME_ESCAPE)
+			{
+				escaped = 1;
+				continue;
+			}
+			if (escaped)
+			{
+				byte ^= FRAME_ESCAPE_XOR;
+				escaped = 0;
+			}
+
+			switch (state)
+			{
+				case Peer_SYNC:
+					break;
+				case Peer_HEADER:
+					frame[frame_size++] = byte;
+					if (frame_size == FRAME_HEADER_SIZE)
+					{
+						expected_size = FRAME_OVERHEAD_SIZE + frame[3];
+						if (expected_size > MAX_FRAME_SIZE)
+						{
+							counters->bad_frames++;
+							state = Peer_SYNC;
+							break;
+						}
+						state = Peer_PAYLOAD;
+					}
+					break;
+				case Peer_PAYLOAD:
+					frame[frame_size++] = byte;
+					if (frame_size < expected_size)
+					{
+						break;
+					}
+					state = Peer_SYNC;
+
+					/* Besides the CRC-8, check the payload against its sequence number so that a frame that lost a
+					 * packet at its end and that was completed by the next frame is not accepted by a CRC-8 match. */
+					uint8_t crc = 0;
+					uint16_t seq = (uint16_t) ((frame[1] << 8) | frame[2]);
+					uint8_t valid = 1;
+					for (uint16_t j=0; j<(frame_size - 1); j++)
+					{
+						crc = crc8_update(crc, frame[j]);
+						if ((j >= FRAME_HEADER_SIZE) && (frame[j] != (uint8_t) (seq + j - FRAME_HEADER_SIZE)))
+						{
+							valid = 0;
+						}
+					}
+					if ((crc != frame[frame_size - 1]) || !valid)
+					{
+						counters->bad_frames++;
+						break;
+					}
+					if (delivered_seqs[seq / 8] & (1 << (seq % 8)))
+					{
+						counters->duplicate_frames++;
+					}
+					else
+					{
+						delivered_seqs[seq / 8] |= (1 << (seq % 8));
+						counters->frames++;
+						counters->payload_bytes += frame[3];
+					}
+
+					/* Acknowledge the frame through the simulated link, whose drops also apply to this direction. */
+					if (frame[0] == FRAME_SYNC_ACKED)
+					{
+						uint8_t ack[ACK_SIZE] = {ACK_SYNC, frame[1], frame[2], 0};
+						uint8_t carried[ACK_SIZE];
+						for (uint8_t j=0; j<(ACK_SIZE - 1); j++)
+						{
+							ack[ACK_SIZE - 1] = crc8_update(ack[ACK_SIZE - 1], ack[j]);
+						}
+						if (link_carry(ack, ACK_SIZE, loss_percent, &seed, carried, counters) == ACK_SIZE)
+						{
+							if (write(fd, carried, ACK_SIZE) != ACK_SIZE)
+							{
+								return;
+							}
+						}
+					}
+					break;
+			}
+		}
+	}
+}
+
+/**@brief	Starts the simulated link, which runs on the master side of a pseudo-terminal pair.
+ *
+ * @param[out] path			Path of the slave side of the pseudo-terminal pair, which is the serial port to use.
+ * @param path_size			Length in bytes of the \p path param.
+ * @param loss_percent		Probability in percent with which each packet is dropped.
+ * @param seed				Seed of the drops.
+ * @param interval_ms		Connection Interval in milliseconds of the simulated link.
+ * @param[in,out] counters	Counters of the simulated link, which must be shared among processes.
+ * @param[out] slave_fd		File descriptor of the slave side, which is kept open so that the master side is never hung up.
+ *
+ * @return	The process ID of the simulated link, or \c -1 on error.
+ */
+static pid_t start_link(char *path, size_t path_size, double loss_percent, unsigned int seed, uint32_t interval_ms,
+						Link_Counters *counters, int *slave_fd)
+{
+	struct termios tio;
+	int master_fd = posix_openpt(O_RDWR | O_NOCTTY);
+	pid_t pid;
+
+	if ((master_fd < 0) || (grantpt(master_fd) != 0) || (unlockpt(master_fd) != 0))
+	{
+		return -1;
+	}
+	snprintf(path, path_size, "%s", ptsname(master_fd));
+
+	/* Put the slave side in raw mode before anything is written, so that the line discipline does not echo anything. */
+	*slave_fd = open(path, O_RDWR | O_NOCTTY);
+	if ((*slave_fd < 0) || (tcgetattr(*slave_fd, &tio) != 0))
+	{
+		return -1;
+	}
+	cfmakeraw(&tio);
+	tcsetattr(*slave_fd, TCSANOW, &tio);
+
+	pid = fork();
+	if (pid == 0)
+	{
+		close(*slave_fd);
+		run_link(master_fd, loss_percent, seed, interval_ms, counters);
+		_exit(0);
+	}
+	close(master_fd);
+
+	return pid;
+}
+
+/**@brief	Builds a frame with a payload that is derived from its sequence number, escaping every byte after its sync
+ *          byte that equals a sync byte or @ref FRAME_ESCAPE .
+ *
+ * @param[out] wire		Pointer to the Memory Address into which the frame will be built, which must hold up to
+ *                      @ref MAX_WIRE_FRAME_SIZE bytes.
+ * @param sync			Sync byte of the frame.
+ * @param seq			Sequence number of the frame.
+ * @param payload_size	Length in bytes of the payload of the frame.
+ *
+ * @return	The length in bytes of the frame, with its escapes.
+ */
+static uint16_t build_frame(uint8_t *wire, uint8_t sync, uint16_t seq, uint8_t payload_size)
+{
+	uint8_t frame[MAX_FRAME_SIZE];
+	uint16_t size = 0;
+	uint16_t wire_size = 0;
+	uint8_t crc = 0;
+
+	frame[size++] = sync;
+	frame[size++] = (uint8_t) (seq >> 8);
+	frame[size++] = (uint8_t) seq;
+	frame[size++] = payload_size;
+	for (uint8_t i=0; i<payload_size; i++)
+	{
+		frame[size++] = (uint8_t) (seq + i);
+	}
+	for (uint16_t i=0; i<size; i++)
+	{
+		crc = crc8_update(crc, frame[i]);
+	}
+	frame[size++] = crc;
+
+	wire[wire_size++] = sync;
+	for (uint16_t i=1; i<size; i++)
+	{
+		if ((frame[i] == FRAME_SYNC_ACKED) || (frame[i] == FRAME_SYNC_UNACKED) || (frame[i] == FRAME_ESCAPE))
+		{
+			wire[wire_size++] = FRAME_ESCAPE;
+			wire[wire_size++] = frame[i] ^ FRAME_ESCAPE_XOR;
+		}
+		else
+		{
+			wire[wire_size++] = frame[i];
+		}
+	}
+
+	return wire_size;
+}
+
+/**@brief	Waits for the acknowledgement of a frame, discarding the late acknowledgements of the previous frames.
+ *
+ * @param seq			Sequence number of the frame.
+ * @param timeout_ms	Time in milliseconds to wait for the acknowledgement.
+ *
+ * @return	\c 1 if the frame was acknowledged. Otherwise, \c 0 .
+ */
+static int wait_ack(uint16_t seq, uint32_t timeout_ms)
+{
+	uint32_t start_tick = HAL_GetTick();
+	uint32_t elapsed;
+
+	while ((elapsed = HAL_GetTick() - start_tick) < timeout_ms)
+	{
+		uint8_t ack[ACK_SIZE];
+		uint8_t crc = 0;
+
+		if (get_hm10clone_ota_data(ack, ACK_SIZE, timeout_ms - elapsed) != HM10_Clone_EC_OK)
+		{
+			return 0;
+		}
+
+		/* The acknowledgements carry no payload, so all of their bytes are protocol overhead. */
+		add_hm10clone_ota_benchmark_overhead(HM10_Clone_OTA_RX, ACK_SIZE);
+		for (uint8_t i=0; i<(ACK_SIZE - 1); i++)
+		{
+			crc = crc8_update(crc, ack[i]);
+		}
+		if ((ack[0] == ACK_SYNC) && (ack[ACK_SIZE - 1] == crc) && (((ack[1] << 8) | ack[2]) == seq))
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+/**@brief	Shows the measurements of a direction of the OTA data path.
+ *
+ * @param[in] name			Name of the direction.
+ * @param[in] benchmark		Snapshot of the OTA data path measurements.
+ * @param direction			Direction that is shown.
+ */
+static void show_path(const char *name, HM10_Clone_OTA_Benchmark *benchmark, HM10_Clone_OTA_Direction direction)
+{
+	HM10_Clone_OTA_Benchmark_Path *path = &benchmark->path[direction];
+	uint32_t window_ms = benchmark->window_end_tick - benchmark->window_start_tick;
+	uint32_t goodput_bytes = path->wire_bytes - path->overhead_bytes;
+
+	printf("%s: %u calls (%u failed), %u bytes on the wire, %u of them overhead (%.1f%%)\n", name, path->calls,
+			path->failed_calls, path->wire_bytes, path->overhead_bytes,
+			path->wire_bytes ? (path->overhead_bytes * 100.0 / path->wire_bytes) : 0.0);
+	printf("  goodput %.1f B/s, %.1f clock counts per delivered byte (clock at %u Hz)\n",
+			window_ms ? (goodput_bytes * 1000.0 / window_ms) : 0.0,
+			goodput_bytes ? ((double) path->cycles / goodput_bytes) : 0.0, benchmark->core_clock_hz);
+	printf("  latency p50 < %u us, p99 < %u us, max %.0f us\n", get_hm10clone_ota_latency_percentile(path, 50),
+			get_hm10clone_ota_latency_percentile(path, 99),
+			path->max_latency_cycles / (benchmark->core_clock_hz / 1000000.0));
+}
+
+int main(int argc, char *argv[])
+{
+	Profile profile = Profile_BULK;
+	uint32_t count = DEFAULT_COUNT;
+	double loss_percent = 0;
+	unsigned int seed = 1;
+	uint32_t interval_ms = 0;
+	uint32_t ack_timeout_ms = DEFAULT_ACK_TIMEOUT;
+	uint32_t telemetry_period_ms = DEFAULT_TELEMETRY_PERIOD;
+	int option;
+
+	while ((option = getopt(argc, argv, "p:n:l:r:d:t:i:")) != -1)
+	{
+		switch (option)
+		{
+			case 'p':
+				if (strcmp(optarg, "bulk") == 0) profile = Profile_BULK;
+				else if (strcmp(optarg, "chatty") == 0) profile = Profile_CHATTY;
+				else if (strcmp(optarg, "telemetry") == 0) profile = Profile_TELEMETRY;
+				else
+				{
+					fprintf(stderr, "ERROR: The profile must be bulk, chatty or telemetry.\n");
+					return 1;
+				}
+				break;
+			case 'n': count = strtoul(optarg, NULL, 10); break;
+			case 'l': loss_percent = strtod(optarg, NULL); break;
+			case 'r': seed = strtoul(optarg, NULL, 10); break;
+			case 'd': interval_ms = strtoul(optarg, NULL, 10); break;
+			case 't': ack_timeout_ms = strtoul(optarg, NULL, 10); break;
+			case 'i': telemetry_period_ms = strtoul(optarg, NULL, 10); break;
+			default:
+				fprintf(stderr, "Usage: %s [-p bulk|chatty|telemetry] [-n count] [-l percent] [-r seed] [-d ms] [-t ms] [-i ms]\n", argv[0]);
+				return 1;
+		}
+	}
+	if ((count == 0) || (count > 65536) || (loss_percent < 0) || (loss_percent >= 100))
+	{
+		fprintf(stderr, "ERROR: From 1 up to 65536 frames must be delivered with a loss below 100%%.\n");
+		return 1;
+	}
+
+	/* Start the simulated link, whose counters stay shared with this process. */
+	Link_Counters *counters = mmap(NULL, sizeof(Link_Counters), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (counters == MAP_FAILED)
+	{
+		perror("mmap");
+		return 1;
+	}
+	memset(counters, 0, sizeof(Link_Counters));
+	char path[64];
+	int slave_fd = -1;
+	pid_t link = start_link(path, sizeof(path), loss_percent, seed, interval_ms, counters, &slave_fd);
+	if (link < 0)
+	{
+		fprintf(stderr, "ERROR: The simulated link could not be started.\n");
+		return 1;
+	}
+	UART_HandleTypeDef huart = {0};
+	if (hal_posix_uart_open(&huart, path, 115200) != HAL_OK)
+	{
+		fprintf(stderr, "ERROR: The serial port %s could not be opened.\n", path);
+		return 1;
+	}
+	init_hm10_clone_module(&huart);
+
+	/* Deliver the frames of the requested profile, where the measurement window starts right before the first one. */
+	static const char *const profile_names[] = {"bulk", "chatty", "telemetry"};
+	static const uint8_t payload_sizes[] = {BULK_PAYLOAD_SIZE, CHATTY_PAYLOAD_SIZE, TELEMETRY_PAYLOAD_SIZE};
+	uint8_t frame[MAX_WIRE_FRAME_SIZE];
+	uint32_t retransmissions = 0;
+	uint32_t given_up = 0;
+	printf("Delivering %u %s frames of %u bytes of payload through a link that drops %.1f%% of its packets.\n", count,
+			profile_names[profile], payload_sizes[profile], loss_percent);
+	reset_hm10clone_ota_benchmark();
+	for (uint32_t seq=0; seq<count; seq++)
+	{
+		uint8_t sync = (profile == Profile_TELEMETRY) ? FRAME_SYNC_UNACKED : FRAME_SYNC_ACKED;
+		uint16_t size = build_frame(frame, sync, (uint16_t) seq, payload_sizes[profile]);
+
+		for (uint32_t attempt=0; ; attempt++)
+		{
+			if (send_hm10clone_ota_data(frame, size, SEND_TIMEOUT) == HM10_Clone_EC_OK)
+			{
+				/* A retransmitted frame only repeats bytes that were already sent, so all of them are overhead. */
+				add_hm10clone_ota_benchmark_overhead(HM10_Clone_OTA_TX, (attempt == 0) ? (size - payload_sizes[profile]) : size);
+			}
+			if ((profile == Profile_TELEMETRY) || wait_ack((uint16_t) seq, ack_timeout_ms))
+			{
+				break;
+			}
+			if (attempt == MAX_RETRANSMISSIONS)
+			{
+				given_up++;
+				break;
+			}
+			retransmissions++;
+		}
+		if (profile == Profile_TELEMETRY)
+		{
+			HAL_Delay(telemetry_period_ms);
+		}
+	}
+
+	/* Give the simulated link time to deliver the last packets before reading its counters. */
+	HAL_Delay(interval_ms + 200U);
+	HM10_Clone_OTA_Benchmark benchmark;
+	get_hm10clone_ota_benchmark(&benchmark);
+	printf("\nWindow of %u ms, %u retransmissions, %u frames given up.\n", benchmark.window_end_tick - benchmark.window_start_tick,
+			retransmissions, given_up);
+	printf("Link: %u packets, %u dropped (%.1f%%). Peer: %u frames delivered (%u bytes of payload), %u lost (%.1f%%), %u duplicates, %u bad.\n",
+			counters->packets, counters->dropped_packets,
+			counters->packets ? (counters->dropped_packets * 100.0 / counters->packets) : 0.0, counters->frames,
+			counters->payload_bytes, count - counters->frames, (count - counters->frames) * 100.0 / count,
+			counters->duplicate_frames, counters->bad_frames);
+	show_path("TX", &benchmark, HM10_Clone_OTA_TX);
+	show_path("RX", &benchmark, HM10_Clone_OTA_RX);
+
+	hal_posix_uart_close(&huart);
+	kill(link, SIGTERM);
+	waitpid(link, NULL, 0);
+	close(slave_fd);
+
+	return (counters->frames > 0) ? 0 : 1;
+}
@@ -0,0 +1,577 @@
+/**@file
+ * @brief	Host-side stress test of the RTOS integration layer of the AT-09 zs040 BLE Driver.
+ *
+ * @details This program runs the @ref hm10_ble_clone with @ref HM10_CLONE_RTOS and @ref HM10_CLONE_NONBLOCKING_API
+ *          enabled on the host, through the POSIX serial port shim of the HAL and the POSIX threads
+ *          @ref HM10_Clone_OS_Port that are located at the "posix_hal" folder, where the UART interrupts are emulated by
+ *          the service thread of the shim. Several threads then use a single simulated HM-10 Clone BLE Device at once,
+ *          without any mutex of their own, just like several tasks of an RTOS would:
+ *          - name: sets a different BLE Name with each blocking Name Command and reads it back.
+ *          - pin: sets a different Pin with each blocking Pin Command and reads it back.
+ *          - role: sets a different Role with each non-blocking Role Command, polling it until it concludes, and reads
+ *            it back with the blocking getter.
+ *          - ota tx: sends numbered OTA frames of varying lengths, which the simulated device validates.
+ *          - ota rx: waits for OTA data, which the simulated device never sends, so that every byte that it gets is a
+ *            byte that was stolen from the Responses of the AT Commands.
+ *          Whenever a function returns @ref HM10_Clone_EC_BUSY because a non-blocking transaction is in progress, the
+ *          thread retries it a moment later. The simulated device answers the AT Commands that it receives and counts
+ *          every OTA frame and every AT Command that was corrupted by the bytes of another thread.
+ *
+ *          The report shows the operations of each thread, together with the CPU time that this process used, which
+ *          stays far below the elapsed time because the threads wait on the semaphores of the @ref HM10_Clone_OS_Port
+ *          instead of polling the UART. The exit status is non-zero if anything failed.
+ *
+ * @note    This program is meant to be compiled and executed on a POSIX host computer, for example with:
+ *          gcc -std=gnu11 -pthread -DAT_09_APP_CONFIG_H_ -DHM10_CLONE_RTOS=1 -Iposix_hal -I../Inc
+ *              -o AT-09_rtos_stress AT-09_rtos_stress.c posix_hal/stm32f1xx_hal_posix.c
+ *              posix_hal/AT-09_os_port_pthread.c ../Src/AT-09_zs040_ble_driver.c
+ *          where "AT_09_APP_CONFIG_H_" is defined so that the configurations of the application of the MCU/MPU are not
+ *          used.
+ *
+ * @note    Usage: ./AT-09_rtos_stress [options]
+ *          -n <count>      Number of operations of each thread (25 by default).
+ *          -d <ms>         Delay in milliseconds before each response of the simulated device (1 by default).
+ *
+ * @date	October 18, 2026.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>	// Library from which "printf" and "snprintf" are located at.
+#include <stdlib.h>	// Library from which "strtoul", "posix_openpt", "grantpt", "unlockpt" and "ptsname" are located at.
+#include <string.h>	// Library from which "memcmp", "strcmp" and "strlen" are located at.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <unistd.h>	// Library from which "fork", "getopt", "read", "write" and "close" are located at.
+#include <signal.h>	// Library from which "kill" is located at.
+#include <fcntl.h>	// Library from which "open", "O_RDWR" and "O_NOCTTY" are located at.
+#include <errno.h>	// Library from which "errno" is located at.
+#include <pthread.h>	// Library from which "pthread_create" and "pthread_join" are located at.
+#include <termios.h>	// Library from which "cfmakeraw" and "tcsetattr" are located at.
+#include <sys/mman.h>	// Library from which "mmap" is located at.
+#include <sys/wait.h>	// Library from which "waitpid" is located at.
+#include <sys/resource.h>	// Library from which "getrusage" is located at.
+#include "AT-09_zs040_ble_driver.h" // This custom Mortrack's library contains the AT-09 zs040 BLE Driver Library.
+#include "AT-09_os_port_pthread.h" // This custom Mortrack's library contains the POSIX threads porting interface of the AT-09 zs040 BLE Driver Library.
+
+#if !HM10_CLONE_RTOS || !HM10_CLONE_NONBLOCKING_API
+#error "The AT-09 zs040 BLE Driver must be compiled with HM10_CLONE_RTOS and HM10_CLONE_NONBLOCKING_API set to 1 for this program."
+#endif
+
+#define DEFAULT_COUNT				(25U)		/**< @brief Default number of operations of each thread. */
+#define DEFAULT_DELAY				(1U)		/**< @brief Default delay in milliseconds before each response of the simulated device. */
+#define BAUD_RATE					(115200U)	/**< @brief Baud rate of the serial port. */
+#define OTA_TIMEOUT					(1000U)		/**< @brief Time in milliseconds given to each call of the OTA data functions. */
+#define OTA_RX_TIMEOUT				(20U)		/**< @brief Time in milliseconds that the ota rx thread waits for OTA data on each call. */
+#define OTA_SYNC					(0xA5)		/**< @brief Sync byte of the OTA frames, which no AT Command starts with. */
+#define OTA_HEADER_SIZE				(4U)		/**< @brief Length in bytes of the sync byte, the sequence number and the length byte of an OTA frame. */
+#define OTA_MAX_PAYLOAD_SIZE		(96U)		/**< @brief Length in bytes of the payload of the largest OTA frame. */
+#define OTA_MAX_FRAME_SIZE			(OTA_HEADER_SIZE + OTA_MAX_PAYLOAD_SIZE + 1U)	/**< @brief Length in bytes of the largest OTA frame, which ends with a CRC-8. */
+#define SIM_LINE_SIZE				(64)		/**< @brief Length in bytes of the longest AT Command that the simulated device accepts. */
+
+/**@brief	Counters of the simulated device, which are placed in memory that is shared across @ref fork .
+ */
+typedef struct
+{
+	uint32_t commands;			//!< AT Commands that were answered.
+	uint32_t bad_commands;		//!< AT Commands that were answered with "ERROR" because they were corrupted.
+	uint32_t frames;			//!< OTA frames that were received intact and in order.
+	uint32_t bad_frames;		//!< OTA frames that were received corrupted or out of order.
+} Sim_Counters;
+
+/**@brief	Operations of a thread.
+ */
+typedef struct
+{
+	const char *name;			//!< Name of the thread.
+	void *(*run)(void *arg);	//!< Body of the thread.
+	uint32_t operations;		//!< Operations that concluded successfully.
+	uint32_t busy;				//!< Calls that returned @ref HM10_Clone_EC_BUSY and that were retried.
+	uint32_t failures;			//!< Operations that failed.
+} Stress_Thread;
+
+static uint32_t count = DEFAULT_COUNT;	/**< @brief Number of operations of each thread. */
+static volatile uint8_t done;			/**< @brief Flag that tells the ota rx thread to stop, once all the other threads have finished. */
+
+/**@brief	Updates a CRC-8 (polynomial 0x07) with a byte.
+ *
+ * @param crc	Current value of the CRC.
+ * @param byte	Byte with which the CRC is updated.
+ *
+ * @return	The updated value of the CRC.
+ */
+static uint8_t crc8_update(uint8_t crc, uint8_t byte)
+{
+	crc ^= byte;
+	for (uint8_t bit=0; bit<8; bit++)
+	{
+		crc = (crc & 0x80) ? ((crc << 1) ^ 0x07) : (crc << 1);
+	}
+
+	return crc;
+}
+
+/**@brief	Checks the result of an operation of a thread, showing it whenever it failed.
+ *
+ * @param[in,out] thread	Thread that made the operation.
+ * @param ok				\c 1 if the operation concluded successfully. Otherwise, \c 0 .
+ * @param[in] what			Description of the operation.
+ * @param status			Status that the operation concluded with.
+ */
+static void check(Stress_Thread *thread, int ok, const char *what, HM10_Clone_Status status)
+{
+	if (ok)
+	{
+		thread->operations++;
+		return;
+	}
+	thread->failures++;
+	fprintf(stderr, "%s: %s failed with status %d.\n", thread->name, what, status);
+}
+
+/**@brief	Calls a function of the @ref hm10_ble_clone until it does not return @ref HM10_Clone_EC_BUSY .
+ *
+ * @param[in,out] thread	Thread that makes the call, whose \c busy field counts the retries.
+ * @param call				Call to the function, which is evaluated again on each retry.
+ */
+#define CALL_UNTIL_NOT_BUSY(thread, call) ({ \
+	HM10_Clone_Status status_; \
+	while ((status_ = (call)) == HM10_Clone_EC_BUSY) \
+	{ \
+		(thread)->busy++; \
+		HAL_Delay(1); \
+	} \
+	status_; \
+})
+
+/**@brief	Sets and reads back a different BLE Name on each operation.
+ *
+ * @param[in,out] arg	Pointer to the @ref Stress_Thread of this thread.
+ *
+ * @return	\c NULL .
+ */
+static void *run_name_thread(void *arg)
+{
+	Stress_Thread *thread = (Stress_Thread *) arg;
+	char name[HM10_CLONE_MAX_BLE_NAME_SIZE + 1];
+	uint8_t read_name[HM10_CLONE_MAX_BLE_NAME_SIZE + 2];
+	uint8_t read_name_size;
+
+	for (uint32_t i=0; i<count; i++)
+	{
+		uint8_t name_size = (uint8_t) snprintf(name, sizeof(name), "STRESS%u", i);
+		HM10_Clone_Status status = CALL_UNTIL_NOT_BUSY(thread, set_hm10clone_name((uint8_t *) name, name_size));
+		if (status == HM10_Clone_EC_OK)
+		{
+			status = CALL_UNTIL_NOT_BUSY(thread, get_hm10clone_name(read_name, &read_name_size));
+		}
+		check(thread, (status == HM10_Clone_EC_OK) && (read_name_size == name_size) && (memcmp(read_name, name, name_size) == 0),
+				"Name Command", status);
+		HAL_Delay(1);
+	}
+
+	return NULL;
+}
+
+/**@brief	Sets and reads back a different Pin on each operation.
+ *
+ * @param[in,out] arg	Pointer to the @ref Stress_Thread of this thread.
+ *
+ * @return	\c NULL .
+ */
+static void *run_pin_thread(void *arg)
+{
+	Stress_Thread *thread = (Stress_Thread *) arg;
+	char pin[HM10_CLONE_PIN_VALUE_SIZE + 1];
+	uint8_t read_pin[HM10_CLONE_PIN_VALUE_SIZE];
+
+	for (uint32_t i=0; i<count; i++)
+	{
+		snprintf(pin, sizeof(pin), "%06u", i % 1000000U);
+		HM10_Clone_Status status = CALL_UNTIL_NOT_BUSY(thread, set_hm10clone_pin((uint8_t *) pin));
+		if (status == HM10_Clone_EC_OK)
+		{
+			status = CALL_UNTIL_NOT_BUSY(thread, get_hm10clone_pin(read_pin));
+		}
+		check(thread, (status == HM10_Clone_EC_OK) && (memcmp(read_pin, pin, HM10_CLONE_PIN_VALUE_SIZE) == 0), "Pin Command", status);
+		HAL_Delay(1);
+	}
+
+	return NULL;
+}
+
+/**@brief	Sets a different Role with a non-blocking transaction on each operation, and reads it back.
+ *
+ * @param[in,out] arg	Pointer to the @ref Stress_Thread of this thread.
+ *
+ * @return	\c NULL .
+ */
+static void *run_role_thread(void *arg)
+{
+	Stress_Thread *thread = (Stress_Thread *) arg;
+	HM10_Clone_Transaction transaction;
+	HM10_Clone_Role read_role;
+
+	for (uint32_t i=0; i<count; i++)
+	{
+		HM10_Clone_Role role = (i & 1) ? HM10_Clone_Role_Central : HM10_Clone_Role_Peripheral;
+		HM10_Clone_Status status = CALL_UNTIL_NOT_BUSY(thread, begin_hm10clone_set_role(&transaction, role));
+		if (status == HM10_Clone_EC_OK)
+		{
+			/* Poll the transaction the way a control loop would, while the other threads keep using the module. */
+			while ((status = poll_hm10clone_transaction(&transaction)) == HM10_Clone_EC_BUSY)
+			{
+				HAL_Delay(1);
+			}
+		}
+		if (status == HM10_Clone_EC_OK)
+		{
+			status = CALL_UNTIL_NOT_BUSY(thread, get_hm10clone_role(&read_role));
+		}
+		check(thread, (status == HM10_Clone_EC_OK) && (read_role == role), "Role transaction", status);
+		HAL_Delay(1);
+	}
+
+	return NULL;
+}
+
+/**@brief	Sends a numbered OTA frame of a different length on each operation.
+ *
+ * @param[in,out] arg	Pointer to the @ref Stress_Thread of this thread.
+ *
+ * @return	\c NULL .
+ */
+static void *run_ota_tx_thread(void *arg)
+{
+	Stress_Thread *thread = (Stress_Thread *) arg;
+	uint8_t frame[OTA_MAX_FRAME_SIZE];
+
+	for (uint32_t seq=0; seq<count; seq++)
+	{
+		uint8_t payload_size = (uint8_t) (1U + (seq * 7U) % OTA_MAX_PAYLOAD_SIZE);
+		uint16_t size = 0;
+		uint8_t crc = 0;
+
+		frame[size++] = OTA_SYNC;
+		frame[size++] = (uint8_t) (seq >> 8);
+		frame[size++] = (uint8_t) seq;
+		frame[size++] = payload_size;
+		for (uint8_t i=0; i<payload_size; i++)
+		{
+			frame[size++] = (uint8_t) (seq + i);
+		}
+		for (uint16_t i=0; i<size; i++)
+		{
+			crc = crc8_update(crc, frame[i]);
+		}
+		frame[size++] = crc;
+
+		HM10_Clone_Status status = CALL_UNTIL_NOT_BUSY(thread, send_hm10clone_ota_data(frame, size, OTA_TIMEOUT));
+		check(thread, status == HM10_Clone_EC_OK, "OTA frame", status);
+		HAL_Delay(1);
+	}
+
+	return NULL;
+}
+
+/**@brief	Waits for OTA data until all the other threads have finished, where none is ever expected.
+ *
+ * @param[in,out] arg	Pointer to the @ref Stress_Thread of this thread.
+ *
+ * @return	\c NULL .
+ */
+static void *run_ota_rx_thread(void *arg)
+{
+	Stress_Thread *thread = (Stress_Thread *) arg;
+	uint8_t byte;
+
+	while (!done)
+	{
+		HM10_Clone_Status status = get_hm10clone_ota_data(&byte, 1, OTA_RX_TIMEOUT);
+		if (status == HM10_Clone_EC_BUSY)
+		{
+			thread->busy++;
+		}
+		else
+		{
+			check(thread, status == HM10_Clone_EC_NR, "OTA wait (a byte was stolen)", status);
+		}
+		HAL_Delay(2);
+	}
+
+	return NULL;
+}
+
+/**@brief	Answers an AT Command the way that an HM-10 Clone BLE Device does.
+ *
+ * @param fd				File descriptor through which the response is sent.
+ * @param[in] line			AT Command, without its Carriage Return and New Line characters.
+ * @param[in,out] state		Name, Role and Pin of the simulated device, in that order.
+ * @param[in,out] counters	Counters of the simulated device.
+ */
+static void simulate_command(int fd, const char *line, char state[3][HM10_CLONE_MAX_BLE_NAME_SIZE + 1], Sim_Counters *counters)
+{
+	static const char *const keys[] = {"NAME", "ROLE", "PIN"};
+	static const uint8_t sends_ok[] = {1, 0, 1};
+	char response[SIM_LINE_SIZE + 16];
+	int size = 0;
+
+	if ((strcmp(line, "AT") == 0) || (strcmp(line, "AT+RESET") == 0))
+	{
+		size = snprintf(response, sizeof(response), "OK\r\n");
+	}
+	else if (strncmp(line, "AT+", 3) == 0)
+	{
+		for (int key=0; key<3; key++)
+		{
+			size_t key_size = strlen(keys[key]);
+			if (strncmp(&line[3], keys[key], key_size) == 0)
+			{
+				const char *value = &line[3 + key_size];
+				if (*value != '\0')
+				{
+					snprintf(state[key], sizeof(state[key]), "%s", value);
+				}
+				size = snprintf(response, sizeof(response), "+%s=%s\r\n%s", keys[key], state[key], ((*value != '\0') && sends_ok[key]) ? "OK\r\n" : "");
+				break;
+			}
+		}
+	}
+	counters->commands++;
+	if (size == 0)
+	{
+		counters->bad_commands++;
+		size = snprintf(response, sizeof(response), "ERROR\r\n");
+	}
+	if (write(fd, response, size) != size)
+	{
+		perror("simulated device");
+	}
+}
+
+/**@brief	Runs a simulated HM-10 Clone BLE Device on the master side of a pseudo-terminal pair, which answers the AT
+ *          Commands and validates the OTA frames that it receives.
+ *
+ * @param fd				File descriptor of the master side of the pseudo-terminal pair.
+ * @param delay_ms			Delay in milliseconds before each response.
+ * @param[in,out] counters	Counters of the simulated device, which are shared with the process of this program.
+ */
+static void run_simulator(int fd, uint32_t delay_ms, Sim_Counters *counters)
+{
+	char state[3][HM10_CLONE_MAX_BLE_NAME_SIZE + 1] = {"HMSoft", "0", "000000"};
+	char line[SIM_LINE_SIZE];
+	size_t line_size = 0;
+	uint8_t frame[OTA_MAX_FRAME_SIZE];
+	uint16_t frame_size = 0;
+	uint16_t next_seq = 0;
+	uint8_t byte;
+
+	for (;;)
+	{
+		ssize_t n = read(fd, &byte, 1);
+		if (n <= 0)
+		{
+			/* The master side reads EIO while no one has the slave side open. */
+			if ((n < 0) && (errno != EIO) && (errno != EINTR) && (errno != EAGAIN))
+			{
+				_exit(1);
+			}
+			HAL_Delay(1);
+			continue;
+		}
+
+		/* An OTA frame can only start in between AT Commands, and it is expected to arrive whole. */
+		if ((frame_size > 0) || ((line_size == 0) && (byte == OTA_SYNC)))
+		{
+			frame[frame_size++] = byte;
+			if ((frame_size < OTA_HEADER_SIZE) || (frame_size < (OTA_HEADER_SIZE + frame[3] + 1U)))
+			{
+				if ((frame_size == OTA_HEADER_SIZE) && (frame[3] > OTA_MAX_PAYLOAD_SIZE))
+				{
+					counters->bad_frames++;
+					frame_size = 0;
+				}
+				continue;
+			}
+			uint8_t crc = 0;
+			uint8_t valid = (((frame[1] << 8) | frame[2]) == next_seq);
+			for (uint16_t i=0; i<(frame_size - 1); i++)
+			{
+				crc = crc8_update(crc, frame[i]);
+				if ((i >= OTA_HEADER_SIZE) && (frame[i] != (uint8_t) (next_seq + i - OTA_HEADER_SIZE)))
+				{
+					valid = 0;
+				}
+			}
+			if (valid && (crc == frame[frame_size - 1]))
+			{
+				counters->frames++;
+			}
+			else
+			{
+				counters->bad_frames++;
+			}
+			next_seq = (uint16_t) (((frame[1] << 8) | frame[2]) + 1U);
+			frame_size = 0;
+			continue;
+		}
+
+		if (line_size < (sizeof(line) - 1))
+		{
+			line[line_size++] = (char) byte;
+		}
+		if ((line_size >= 2) && (line[line_size-2] == '\r') && (line[line_size-1] == '\n'))
+		{
+			line[line_size-2] = '\0';
+			HAL_Delay(delay_ms);
+			simulate_command(fd, line, state, counters);
+			line_size = 0;
+		}
+	}
+}
+
+/**@brief	Creates a pseudo-terminal pair with a simulated HM-10 Clone BLE Device on its master side.
+ *
+ * @param[out] path			Buffer into which the path of the slave side will be stored.
+ * @param path_size			Length in bytes of the \p path param.
+ * @param delay_ms			Delay in milliseconds before each response of the simulated device.
+ * @param[in,out] counters	Counters of the simulated device, which must be shared among processes.
+ * @param[out] slave_fd		File descriptor of the slave side, which is kept open so that the master side does not hang up.
+ *
+ * @return	The process ID of the simulated device, or -1 on error.
+ */
+static pid_t start_simulator(char *path, size_t path_size, uint32_t delay_ms, Sim_Counters *counters, int *slave_fd)
+{
+	struct termios tio;
+	int master_fd = posix_openpt(O_RDWR | O_NOCTTY);
+	pid_t pid;
+
+	if ((master_fd < 0) || (grantpt(master_fd) != 0) || (unlockpt(master_fd) != 0))
+	{
+		return -1;
+	}
+	snprintf(path, path_size, "%s", ptsname(master_fd));
+
+	/* Put the slave side in raw mode before anything is written, so that the line discipline does not echo anything. */
+	*slave_fd = open(path, O_RDWR | O_NOCTTY);
+	if ((*slave_fd < 0) || (tcgetattr(*slave_fd, &tio) != 0))
+	{
+		return -1;
+	}
+	cfmakeraw(&tio);
+	tcsetattr(*slave_fd, TCSANOW, &tio);
+
+	pid = fork();
+	if (pid == 0)
+	{
+		close(*slave_fd);
+		run_simulator(master_fd, delay_ms, counters);
+		_exit(0);
+	}
+	close(master_fd);
+
+	return pid;
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t delay_ms = DEFAULT_DELAY;
+	int option;
+
+	while ((option = getopt(argc, argv, "n:d:")) != -1)
+	{
+		switch (option)
+		{
+			case 'n': count = strtoul(optarg, NULL, 10); break;
+			case 'd': delay_ms = strtoul(optarg, NULL, 10); break;
+			default:
+				fprintf(stderr, "Usage: %s [-n count] [-d ms]\n", argv[0]);
+				return 1;
+		}
+	}
+	if ((count == 0) || (count > 65536))
+	{
+		fprintf(stderr, "ERROR: Each thread must make from 1 up to 65536 operations.\n");
+		return 1;
+	}
+
+	/* Start the simulated device, whose counters stay shared with this process. */
+	Sim_Counters *counters = mmap(NULL, sizeof(Sim_Counters), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (counters == MAP_FAILED)
+	{
+		perror("mmap");
+		return 1;
+	}
+	memset(counters, 0, sizeof(Sim_Counters));
+	char path[64];
+	int slave_fd = -1;
+	pid_t simulator = start_simulator(path, sizeof(path), delay_ms, counters, &slave_fd);
+	if (simulator < 0)
+	{
+		fprintf(stderr, "ERROR: The simulated device could not be started.\n");
+		return 1;
+	}
+	UART_HandleTypeDef huart = {0};
+	if (hal_posix_uart_open(&huart, path, BAUD_RATE) != HAL_OK)
+	{
+		fprintf(stderr, "ERROR: The serial port %s could not be opened.\n", path);
+		return 1;
+	}
+	if ((set_hm10clone_os_port(&hm10clone_pthread_os_port) != HM10_Clone_EC_OK) || (init_hm10_clone_module(&huart) != HM10_Clone_EC_OK))
+	{
+		fprintf(stderr, "ERROR: The AT-09 zs040 BLE Driver could not be initialized.\n");
+		return 1;
+	}
+
+	/* Run all the threads at once, where the ota rx thread runs until all the others have finished. */
+	Stress_Thread threads[] =
+	{
+		{.name = "name", .run = run_name_thread},
+		{.name = "pin", .run = run_pin_thread},
+		{.name = "role", .run = run_role_thread},
+		{.name = "ota tx", .run = run_ota_tx_thread},
+		{.name = "ota rx", .run = run_ota_rx_thread}
+	};
+	const size_t threads_count = sizeof(threads) / sizeof(threads[0]);
+	pthread_t ids[sizeof(threads) / sizeof(threads[0])];
+	struct rusage usage;
+	uint32_t start_tick = HAL_GetTick();
+	printf("Running %zu threads with %u operations each against the simulated device at %s.\n", threads_count, count, path);
+	for (size_t i=0; i<threads_count; i++)
+	{
+		pthread_create(&ids[i], NULL, threads[i].run, &threads[i]);
+	}
+	for (size_t i=0; i<(threads_count - 1); i++)
+	{
+		pthread_join(ids[i], NULL);
+	}
+	done = 1;
+	pthread_join(ids[threads_count - 1], NULL);
+	uint32_t elapsed_ms = HAL_GetTick() - start_tick;
+	getrusage(RUSAGE_SELF, &usage);
+
+	/* Give the simulated device time to validate the last OTA frame before reading its counters. */
+	HAL_Delay(100);
+	uint32_t failures = 0;
+	printf("\n%-8s %10s %10s %10s\n", "Thread", "Operations", "Busy", "Failures");
+	for (size_t i=0; i<threads_count; i++)
+	{
+		printf("%-8s %10u %10u %10u\n", threads[i].name, threads[i].operations, threads[i].busy, threads[i].failures);
+		failures += threads[i].failures;
+	}
+	double cpu_ms = (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000.0 + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000.0;
+	printf("\nSimulated device: %u AT Commands (%u corrupted), %u OTA frames intact of %u (%u corrupted).\n",
+			counters->commands, counters->bad_commands, counters->frames, count, counters->bad_frames);
+	printf("Elapsed %u ms, CPU time %.0f ms (%.1f%% of the elapsed time).\n", elapsed_ms, cpu_ms,
+			elapsed_ms ? (cpu_ms * 100.0 / elapsed_ms) : 0.0);
+	if ((counters->bad_commands != 0) || (counters->bad_frames != 0) || (counters->frames != count))
+	{
+		failures++;
+	}
+	printf("%s\n", (failures == 0) ? "PASSED" : "FAILED");
+
+	hal_posix_uart_close(&huart);
+	kill(simulator, SIGTERM);
+	waitpid(simulator, NULL, 0);
+	close(slave_fd);
+
+	return (failures == 0) ? 0 : 1;
+}
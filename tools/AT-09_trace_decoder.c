@@ -0,0 +1,114 @@
+/**@file
+ * @brief	Host-side decoder of the binary trace records of the AT-09 zs040 BLE Driver.
+ *
+ * @details This program turns the @ref HM10_Clone_Trace_Record records that were recorded by the @ref hm10_ble_clone
+ *          back into the human-readable messages that the @ref hm10_ble_clone would display via @ref printf . The
+ *          records can be given either as they were read with @ref read_hm10clone_trace or as a raw RAM dump of the
+ *          whole binary trace ring buffer (e.g., with the "dump binary memory" command of GDB), where the oldest record
+ *          is located by looking for the discontinuity in their sequence numbers.
+ *
+ * @note    This program is meant to be compiled and executed on a little-endian host computer, for example with:
+ *          gcc -I../Inc -o AT-09_trace_decoder AT-09_trace_decoder.c
+ *
+ * @note    Usage: ./AT-09_trace_decoder <binary trace file> [core clock frequency in Hz]
+ *          where the core clock frequency (72000000 by default) is used to convert the DWT Cycle Counter timestamps into
+ *          milliseconds.
+ *
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf", "fopen" and "fread" are located at.
+#include <stdlib.h>	// Library from which "malloc", "free" and "strtoul" are located at.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "AT-09_trace_events.h" // This custom Mortrack's library contains the events that the AT-09 zs040 BLE Driver Library can record into its binary trace.
+
+#define DEFAULT_CORE_CLOCK_HZ       (72000000UL)    /**< @brief Default core clock frequency in Hz of the MCU/MPU that recorded the binary trace. */
+
+/**@brief	Human-readable messages of each @ref HM10_Clone_Trace_Event .
+ */
+static const char *const trace_formats[] =
+{
+	#define HM10_CLONE_TRACE_EVENT_FORMAT(event, subsystem, level, format)	format,
+	HM10_CLONE_TRACE_EVENTS(HM10_CLONE_TRACE_EVENT_FORMAT)
+	#undef HM10_CLONE_TRACE_EVENT_FORMAT
+};
+
+int main(int argc, char *argv[])
+{
+	if ((argc < 2) || (argc > 3))
+	{
+		fprintf(stderr, "Usage: %s <binary trace file> [core clock frequency in Hz]\n", argv[0]);
+		return 1;
+	}
+
+	/** <b>Local variable core_clock_hz:</b> Core clock frequency in Hz of the MCU/MPU that recorded the binary trace. */
+	unsigned long core_clock_hz = (argc == 3) ? strtoul(argv[2], NULL, 10) : DEFAULT_CORE_CLOCK_HZ;
+	if (core_clock_hz == 0)
+	{
+		fprintf(stderr, "ERROR: An invalid core clock frequency has been given: %s.\n", argv[2]);
+		return 1;
+	}
+
+	/* Read all the records from the given binary trace file. */
+	FILE *file = fopen(argv[1], "rb");
+	if (file == NULL)
+	{
+		fprintf(stderr, "ERROR: The binary trace file %s could not be opened.\n", argv[1]);
+		return 1;
+	}
+	fseek(file, 0, SEEK_END);
+	long file_size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	/** <b>Local variable records_count:</b> Number of complete records contained in the binary trace file. */
+	size_t records_count = (size_t) file_size / sizeof(HM10_Clone_Trace_Record);
+	HM10_Clone_Trace_Record *records = malloc((records_count > 0 ? records_count : 1) * sizeof(HM10_Clone_Trace_Record));
+	if ((records == NULL) || (fread(records, sizeof(HM10_Clone_Trace_Record), records_count, file) != records_count))
+	{
+		fprintf(stderr, "ERROR: The binary trace file %s could not be read.\n", argv[1]);
+		fclose(file);
+		free(records);
+		return 1;
+	}
+	fclose(file);
+
+	/* Locate the oldest record, which is the one whose previous record (circularly) does not precede it. */
+	/** <b>Local variable oldest:</b> Index of the oldest record in the binary trace file. */
+	size_t oldest = 0;
+	for (size_t i=0; i<records_count; i++)
+	{
+		const HM10_Clone_Trace_Record *previous = &records[(i + records_count - 1) % records_count];
+		uint16_t expected_sequence = (uint16_t) (previous->sequence + 1);
+		if (expected_sequence == 0)
+		{
+			expected_sequence = 1;
+		}
+		if ((records[i].sequence != 0) && ((previous->sequence == 0) || (records[i].sequence != expected_sequence)))
+		{
+			oldest = i;
+			break;
+		}
+	}
+
+	/* Display the human-readable message of each record, from the oldest to the newest. */
+	/** <b>Local variable first_timestamp:</b> Timestamp of the oldest record, towards which the displayed times are relative to. */
+	uint32_t first_timestamp = records_count ? records[oldest].timestamp : 0;
+	for (size_t n=0; n<records_count; n++)
+	{
+		const HM10_Clone_Trace_Record *record = &records[(oldest + n) % records_count];
+		if (record->sequence == 0)
+		{
+			continue;
+		}
+
+		printf("[%5u] %12.3f ms  ", record->sequence, (double) (uint32_t) (record->timestamp - first_timestamp) * 1000.0 / (double) core_clock_hz);
+		if (record->event >= HM10_CLONE_EV_COUNT)
+		{
+			printf("UNKNOWN EVENT %u (%u, %u, %u, %u)\r\n", record->event, record->args[0], record->args[1], record->args[2], record->args[3]);
+			continue;
+		}
+		printf(trace_formats[record->event], record->args[0], record->args[1], record->args[2], record->args[3]);
+	}
+
+	free(records);
+	return 0;
+}
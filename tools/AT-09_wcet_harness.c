@@ -0,0 +1,758 @@
+/**@file
+ * @brief	Host-side worst-case execution time and stack depth harness of the AT-09 zs040 BLE Driver.
+ *
+ * @details This program calls every blocking function of the @ref hm10_ble_clone against a simulated HM-10 Clone BLE
+ *          Device that answers in several adversarial ways (see @ref Scenario ), and measures for each call the time that
+ *          it took and the depth of stack that it used. The HAL functions that the @ref hm10_ble_clone uses are
+ *          implemented right in this file over a virtual clock, so that the time of each call is given by the
+ *          timeouts, delays and wire times that it would take on the MCU/MPU, while the whole run takes only a few
+ *          seconds. Each call runs on its own stack that is painted beforehand, so that its depth is given by the
+ *          deepest byte that was overwritten.
+ *
+ *          The time budget of each function is derived from the configurations of the @ref hm10_ble_clone (i.e.,
+ *          its timeouts, its retry policy and @ref HM10_CLONE_MAX_FLUSH_BYTES ), which is the time that the function
+ *          must not exceed no matter how the HM-10 Clone BLE Device behaves. A function fails whenever its worst
+ *          scenario exceeds its time budget or the stack budget, or whenever it does not return at all, in which case
+ *          this program exits with a non-zero value.
+ *
+ * @note    The stack depths are given in bytes of the host computer, which are meant to be compared among functions
+ *          and across changes of the @ref hm10_ble_clone rather than to be used as the stack size of the MCU/MPU.
+ *
+ * @note    This program is meant to be compiled and executed on a POSIX host computer, for example with:
+ *          gcc -std=gnu11 -DAT_09_APP_CONFIG_H_ -DHM10_CLONE_NONBLOCKING_API=0 -Iposix_hal -I../Inc
+ *              -o AT-09_wcet_harness AT-09_wcet_harness.c ../Src/AT-09_zs040_ble_driver.c
+ *          where the HAL header of the "posix_hal" folder is used but not its serial port implementation.
+ *
+ * @note    Usage: ./AT-09_wcet_harness [options]
+ *          -b <baud rate>      Baud rate of the simulated UART (9600 by default).
+ *          -s <bytes>          Stack budget of every function (4096 by default).
+ *          -t <ms>             Time budget of every function, instead of the one derived from the configurations.
+ *          -f <function>=<ms>  Time budget of a single function, which can be given several times.
+ *          -v                  Also show the outcome of each scenario of each function.
+ *
+ * @date	October 18, 2026.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>	// Library from which "printf" and "snprintf" are located at.
+#include <stdlib.h>	// Library from which "strtoul" is located at.
+#include <string.h>	// Library from which "memset", "memcpy", "strcmp" and "strncmp" are located at.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <unistd.h>	// Library from which "getopt" is located at.
+#include <ucontext.h>	// Library from which "getcontext", "makecontext" and "swapcontext" are located at.
+#include "AT-09_zs040_ble_driver.h" // This custom Mortrack's library contains the AT-09 zs040 BLE Driver Library.
+
+#define DEFAULT_BAUD_RATE			(9600U)		/**< @brief Default baud rate of the simulated UART. */
+#define DEFAULT_STACK_BUDGET		(4096U)		/**< @brief Default stack budget in bytes of every function. */
+#define RUN_STACK_SIZE				(256U * 1024U)	/**< @brief Length in bytes of the stack on which each call runs. */
+#define RUN_STACK_GUARD				(16U * 1024U)	/**< @brief Length in bytes at the end of the stack of each call from which a call is aborted as a runaway recursion. */
+#define STACK_PAINT					(0xA5U)		/**< @brief Value with which the stack of each call is painted. */
+#define MAX_HAL_CALLS				(10000000UL)	/**< @brief Number of HAL calls after which a call is aborted as one that does not return. */
+#define HAL_CALL_COST_US			(10U)		/**< @brief Virtual time in microseconds that each HAL call takes, so that the loops that poll the HAL Tick advance. */
+#define RESPONSE_DELAY_US			(20000U)	/**< @brief Virtual time in microseconds between an AT Command and the first byte of its Response. */
+#define CONNECT_DELAY_US			(50000U)	/**< @brief Virtual time in microseconds between the Connect Command and the STATE pin going high. */
+#define GARBAGE_SIZE				(64U)		/**< @brief Number of bytes of the garbage Responses. */
+#define RX_QUEUE_SIZE				(256U)		/**< @brief Length in bytes of the queue of the bytes that the simulated device sends. */
+#define TX_LINE_SIZE				(64U)		/**< @brief Length in bytes of the longest AT Command that the simulated device parses. */
+#define OTA_PACKET_SIZE				(18U)		/**< @brief Length in bytes of the OTA data of each call, which is the size of a packet of the HM-10 Clone BLE Device. */
+#define OTA_TIMEOUT					(1000U)		/**< @brief Timeout in milliseconds given to the OTA data functions. */
+#define SCAN_TIMEOUT				(2000U)		/**< @brief Timeout in milliseconds given to @ref scan_hm10clone_devices . */
+#define CONNECT_TIMEOUT				(1000U)		/**< @brief Timeout in milliseconds given to @ref connect_hm10clone_device . */
+#define SLACK_MS					(5U)		/**< @brief Time in milliseconds added to each attempt of a time budget for the cost of the HAL calls. */
+#define MAX_OVERRIDES				(32)		/**< @brief Maximum number of -f options. */
+
+/**@brief	Ways in which the simulated HM-10 Clone BLE Device answers.
+ */
+typedef enum
+{
+	Scenario_Valid = 0,		//!< The expected Response to each AT Command.
+	Scenario_Silence,		//!< No Response at all.
+	Scenario_Garbage,		//!< Printable bytes without any line ending instead of each Response.
+	Scenario_Partial,		//!< The first half of each Response and then silence.
+	Scenario_Endless,		//!< A stream of garbage at the full speed of the UART that never stops, regardless of the AT Commands.
+	Scenario_Drip,			//!< Each Response without its last line ending and then its last byte endlessly, where each byte arrives right before the timeout of the reception that waits for it.
+	Scenario_Uart_Error,	//!< Every reception fails with @ref HAL_ERROR (e.g., an overrun or a framing error).
+	Scenario_Count			//!< Number of scenarios.
+} Scenario;
+
+/**@brief	Names of each @ref Scenario .
+ */
+static const char *const scenario_names[Scenario_Count] = {"valid", "silence", "garbage", "partial", "endless", "drip", "uart-error"};
+
+/**@brief	Kinds of functions of the @ref hm10_ble_clone , which tell how their time budget is derived.
+ */
+typedef enum
+{
+	Kind_Cmd = 0,	//!< AT Command that receives the number of Responses given by the \c rx_count field of @ref Api_Function .
+	Kind_Scan,		//!< AT Command that receives Responses for up to @ref SCAN_TIMEOUT .
+	Kind_Connect,	//!< AT Command that waits for the STATE pin for up to @ref CONNECT_TIMEOUT and then flushes the RX of the UART.
+	Kind_Ota		//!< OTA data function that is bounded by @ref OTA_TIMEOUT .
+} Api_Kind;
+
+/**@brief	Function of the @ref hm10_ble_clone that is measured, together with its worst measurements.
+ */
+typedef struct
+{
+	const char *name;					//!< Name of the function.
+	HM10_Clone_Status (*call)(void);	//!< Calls the function with valid arguments.
+	Api_Kind kind;						//!< Kind of the function.
+	uint8_t rx_count;					//!< Number of receptions of each attempt whenever the \c kind field is @ref Kind_Cmd .
+	uint32_t budget_ms;					//!< Time budget in milliseconds.
+	uint32_t max_ms;					//!< Longest time in milliseconds that a call took.
+	uint32_t max_stack;					//!< Deepest stack in bytes that a call used.
+	Scenario worst;						//!< Scenario of the longest call.
+	uint8_t aborted;					//!< \c 1 if any call did not return. Otherwise, \c 0 .
+} Api_Function;
+
+static UART_HandleTypeDef huart;				/**< @brief Simulated UART of the HM-10 Clone BLE Device. */
+static GPIO_TypeDef state_port;					/**< @brief Simulated GPIO Port of the STATE pin. */
+static uint64_t now_us;							/**< @brief Virtual time in microseconds. */
+static Scenario scenario;						/**< @brief Scenario of the current call. */
+static uint8_t rx_queue[RX_QUEUE_SIZE];			/**< @brief Bytes that the simulated device has sent and that have not been received yet. */
+static uint16_t rx_head;						/**< @brief Index of the next byte of @ref rx_queue to receive. */
+static uint16_t rx_tail;						/**< @brief Index after the last byte of @ref rx_queue . */
+static uint64_t rx_next_us;						/**< @brief Virtual time at which the next byte of @ref rx_queue can arrive. */
+static uint8_t drip_byte;						/**< @brief Byte that is sent endlessly in @ref Scenario_Drip once @ref rx_queue is empty. */
+static uint32_t garbage_seed;					/**< @brief State of the generator of the garbage bytes. */
+static char tx_line[TX_LINE_SIZE];				/**< @brief AT Command that is being received by the simulated device. */
+static uint16_t tx_line_size;					/**< @brief Number of bytes of @ref tx_line . */
+static uint64_t connected_us;					/**< @brief Virtual time at which the STATE pin goes high, or 0 if it does not. */
+static uint32_t hal_calls;						/**< @brief Number of HAL calls of the current call. */
+static uint32_t byte_time_us;					/**< @brief Wire time in microseconds of each byte. */
+
+static ucontext_t main_context;					/**< @brief Context of the harness. */
+static ucontext_t run_context;					/**< @brief Context of the current call. */
+static uint8_t run_stack[RUN_STACK_SIZE];		/**< @brief Stack of the current call. */
+static Api_Function *run_function;				/**< @brief Function of the current call. */
+static uint8_t run_aborted;						/**< @brief \c 1 if the current call was aborted. Otherwise, \c 0 . */
+
+/**@brief	Gives the next garbage byte, which is printable so that it never completes a line.
+ *
+ * @return	The garbage byte.
+ */
+static uint8_t garbage_byte(void)
+{
+	garbage_seed = garbage_seed * 1103515245U + 12345U;
+	return (uint8_t) (' ' + ((garbage_seed >> 16) % 95U));
+}
+
+/**@brief	Aborts the current call and goes back to the harness, which never resumes it.
+ */
+static void abort_run(void)
+{
+	run_aborted = 1;
+	swapcontext(&run_context, &main_context);
+}
+
+/**@brief	Accounts a HAL call, and aborts the current call whenever it looks like it will never return.
+ */
+static void hal_enter(void)
+{
+	uint8_t marker;
+
+	now_us += HAL_CALL_COST_US;
+	if ((++hal_calls > MAX_HAL_CALLS) || ((uintptr_t) &marker < (uintptr_t) &run_stack[RUN_STACK_GUARD]))
+	{
+		abort_run();
+	}
+}
+
+/**@brief	Queues bytes that the simulated device sends, which start to arrive after @ref RESPONSE_DELAY_US .
+ *
+ * @param[in] data	Bytes to send.
+ * @param size		Number of bytes of the \p data param.
+ */
+static void rx_push(const void *data, uint16_t size)
+{
+	if (rx_head == rx_tail)
+	{
+		rx_head = rx_tail = 0;
+		rx_next_us = now_us + RESPONSE_DELAY_US;
+	}
+	if (size > (RX_QUEUE_SIZE - rx_tail))
+	{
+		size = RX_QUEUE_SIZE - rx_tail;
+	}
+	memcpy(&rx_queue[rx_tail], data, size);
+	rx_tail += size;
+}
+
+/**@brief	Gives the Response of an HM-10 Clone BLE Device to an AT Command.
+ *
+ * @param[in] line			AT Command, without its Carriage Return and New Line characters.
+ * @param[out] response		Buffer into which the Response will be stored.
+ * @param response_size		Length in bytes of the \p response param.
+ *
+ * @return	The length in bytes of the Response.
+ */
+static int valid_response(const char *line, char *response, size_t response_size)
+{
+	static const char *const keys[] = {"NAME", "ROLE", "PIN", "TYPE"};
+	static const char *const values[] = {"HMSoft", "0", "000000", "0"};
+	static const uint8_t sends_ok[] = {1, 0, 1, 1};
+
+	if ((strcmp(line, "AT") == 0) || (strcmp(line, "AT+RESET") == 0) || (strncmp(line, "AT+IMME", 7) == 0))
+	{
+		return snprintf(response, response_size, "OK\r\n");
+	}
+	if (strcmp(line, HM10_CLONE_SCAN_CMD) == 0)
+	{
+		return snprintf(response, response_size, "%s1 0x001583005A1B\r\n%s\r\n", HM10_CLONE_SCAN_RESULT_PREFIX, HM10_CLONE_SCAN_END_PREFIX);
+	}
+	if (strncmp(line, HM10_CLONE_CONNECT_CMD, sizeof(HM10_CLONE_CONNECT_CMD) - 1) == 0)
+	{
+		connected_us = now_us + CONNECT_DELAY_US;
+		return snprintf(response, response_size, "OK+CONNA\r\n");
+	}
+	for (int key=0; (strncmp(line, "AT+", 3) == 0) && (key<4); key++)
+	{
+		size_t key_size = strlen(keys[key]);
+		if (strncmp(&line[3], keys[key], key_size) == 0)
+		{
+			const char *value = &line[3 + key_size];
+			return snprintf(response, response_size, "+%s=%s\r\n%s", keys[key], (*value != '\0') ? value : values[key], ((*value != '\0') && sends_ok[key]) ? "OK\r\n" : "");
+		}
+	}
+	return snprintf(response, response_size, "ERROR\r\n");
+}
+
+/**@brief	Answers an AT Command according to the current @ref Scenario .
+ *
+ * @param[in] line	AT Command, without its Carriage Return and New Line characters.
+ */
+static void simulate_command(const char *line)
+{
+	char response[RX_QUEUE_SIZE];
+	int size = valid_response(line, response, sizeof(response));
+
+	switch (scenario)
+	{
+		case Scenario_Valid:
+			rx_push(response, size);
+			break;
+		case Scenario_Garbage:
+			for (uint16_t i=0; i<GARBAGE_SIZE; i++)
+			{
+				response[i] = (char) garbage_byte();
+			}
+			rx_push(response, GARBAGE_SIZE);
+			break;
+		case Scenario_Partial:
+			rx_push(response, size / 2);
+			break;
+		case Scenario_Drip:
+			rx_push(response, size - 2);
+			drip_byte = (uint8_t) response[size - 3];
+			break;
+		default:
+			break;
+	}
+}
+
+/**@brief	Gives the next byte that the simulated device sends, if it arrives before a deadline.
+ *
+ * @param deadline_us	Virtual time up to which the byte is waited for.
+ * @param[out] byte		Byte that arrived.
+ *
+ * @return	\c 1 if the byte arrived, in which case the virtual time is advanced up to its arrival. Otherwise, \c 0 , in
+ *          which case the virtual time is advanced up to the \p deadline_us param.
+ */
+static uint8_t rx_next(uint64_t deadline_us, uint8_t *byte)
+{
+	uint64_t arrival_us;
+
+	switch (scenario)
+	{
+		case Scenario_Endless:
+			arrival_us = (rx_next_us > now_us) ? rx_next_us : now_us;
+			*byte = garbage_byte();
+			break;
+		case Scenario_Drip:
+			if ((rx_head == rx_tail) && (drip_byte == 0))
+			{
+				now_us = deadline_us;
+				return 0;
+			}
+			arrival_us = (deadline_us > 1000U) ? (deadline_us - 1000U) : now_us;
+			if (arrival_us < (now_us + byte_time_us))
+			{
+				arrival_us = now_us + byte_time_us;
+			}
+			*byte = (rx_head != rx_tail) ? rx_queue[rx_head++] : drip_byte;
+			break;
+		default:
+			if (rx_head == rx_tail)
+			{
+				now_us = deadline_us;
+				return 0;
+			}
+			arrival_us = (rx_next_us > now_us) ? rx_next_us : now_us;
+			*byte = rx_queue[rx_head];
+			if (arrival_us <= deadline_us)
+			{
+				rx_head++;
+			}
+			break;
+	}
+	if (arrival_us > deadline_us)
+	{
+		now_us = deadline_us;
+		return 0;
+	}
+	now_us = arrival_us;
+	rx_next_us = arrival_us + byte_time_us;
+	return 1;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *uart, const uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	(void) uart;
+	(void) Timeout;
+	hal_enter();
+	now_us += (uint64_t) Size * byte_time_us;
+	for (uint16_t i=0; i<Size; i++)
+	{
+		if (tx_line_size < (sizeof(tx_line) - 1))
+		{
+			tx_line[tx_line_size++] = (char) pData[i];
+		}
+		if ((tx_line_size >= 2) && (tx_line[tx_line_size-2] == '\r') && (tx_line[tx_line_size-1] == '\n'))
+		{
+			tx_line[tx_line_size-2] = '\0';
+			simulate_command(tx_line);
+			tx_line_size = 0;
+		}
+	}
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *uart, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	(void) uart;
+	hal_enter();
+	if (scenario == Scenario_Uart_Error)
+	{
+		return HAL_ERROR;
+	}
+
+	/* Just like the HAL, the timeout applies to the whole reception rather than to each byte. */
+	uint64_t deadline_us = (Timeout == HAL_MAX_DELAY) ? UINT64_MAX : (now_us + (uint64_t) Timeout * 1000U);
+	for (uint16_t i=0; i<Size; i++)
+	{
+		if (!rx_next(deadline_us, &pData[i]))
+		{
+			return HAL_TIMEOUT;
+		}
+	}
+	return HAL_OK;
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+	(void) GPIOx;
+	(void) GPIO_Pin;
+	hal_enter();
+	return ((connected_us != 0) && (now_us >= connected_us)) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	hal_enter();
+	return (uint32_t) (now_us / 1000U);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+	hal_enter();
+	now_us += (uint64_t) Delay * 1000U;
+}
+
+static HM10_Clone_Status call_nothing(void)
+{
+	return HM10_Clone_EC_OK;
+}
+
+static HM10_Clone_Status call_test(void)
+{
+	return send_hm10clone_test_cmd();
+}
+
+static HM10_Clone_Status call_reset(void)
+{
+	return send_hm10clone_reset_cmd();
+}
+
+#if HM10_CLONE_NAME_CMDS
+static HM10_Clone_Status call_set_name(void)
+{
+	uint8_t name[] = "HM10-WCET";
+	return set_hm10clone_name(name, sizeof(name) - 1);
+}
+#if HM10_CLONE_GETTER_CMDS
+static HM10_Clone_Status call_get_name(void)
+{
+	uint8_t name[HM10_CLONE_MAX_BLE_NAME_SIZE + 2];
+	uint8_t size;
+	return get_hm10clone_name(name, &size);
+}
+#endif
+#endif
+
+#if HM10_CLONE_ROLE_CMDS
+static HM10_Clone_Status call_set_role(void)
+{
+	return set_hm10clone_role(HM10_Clone_Role_Peripheral);
+}
+#if HM10_CLONE_GETTER_CMDS
+static HM10_Clone_Status call_get_role(void)
+{
+	HM10_Clone_Role role;
+	return get_hm10clone_role(&role);
+}
+#endif
+#endif
+
+#if HM10_CLONE_PIN_CMDS
+static HM10_Clone_Status call_set_pin(void)
+{
+	uint8_t pin[] = "123456";
+	return set_hm10clone_pin(pin);
+}
+#if HM10_CLONE_GETTER_CMDS
+static HM10_Clone_Status call_get_pin(void)
+{
+	uint8_t pin[HM10_CLONE_PIN_VALUE_SIZE];
+	return get_hm10clone_pin(pin);
+}
+#endif
+#endif
+
+#if HM10_CLONE_TYPE_CMDS
+static HM10_Clone_Status call_set_pin_code_mode(void)
+{
+	return set_hm10clone_pin_code_mode(HM10_Clone_Pin_Code_DISABLED);
+}
+#if HM10_CLONE_GETTER_CMDS
+static HM10_Clone_Status call_get_pin_code_mode(void)
+{
+	HM10_Clone_Pin_Code_Mode pin_code_mode;
+	return get_hm10clone_pin_code_mode(&pin_code_mode);
+}
+#endif
+#endif
+
+static HM10_Clone_Status call_send_ota_data(void)
+{
+	uint8_t data[OTA_PACKET_SIZE] = {0};
+	return send_hm10clone_ota_data(data, sizeof(data), OTA_TIMEOUT);
+}
+
+static HM10_Clone_Status call_send_ota_data_vectored(void)
+{
+	static const uint8_t header[4] = {0};
+	static const uint8_t payload[64] = {0};
+	const HM10_Clone_Tx_Segment segments[] = {{header, sizeof(header)}, {payload, sizeof(payload)}};
+	return send_hm10clone_ota_data_vectored(segments, 2, OTA_TIMEOUT);
+}
+
+static HM10_Clone_Status call_get_ota_data(void)
+{
+	uint8_t data[OTA_PACKET_SIZE];
+	return get_hm10clone_ota_data(data, sizeof(data), OTA_TIMEOUT);
+}
+
+#if HM10_CLONE_CENTRAL_API
+static HM10_Clone_Status call_scan(void)
+{
+	uint8_t devices_found;
+	return scan_hm10clone_devices(SCAN_TIMEOUT, NULL, &devices_found);
+}
+
+static HM10_Clone_Status call_connect(void)
+{
+	static const uint8_t address[HM10_CLONE_BLE_ADDRESS_SIZE] = {0x00, 0x15, 0x83, 0x00, 0x5A, 0x1B};
+	uint32_t connect_time;
+	return connect_hm10clone_device(address, CONNECT_TIMEOUT, &connect_time);
+}
+
+static HM10_Clone_Status call_auto_reconnect(void)
+{
+	return set_hm10clone_auto_reconnect(1);
+}
+#endif
+
+/**@brief	Functions of the @ref hm10_ble_clone that are measured.
+ */
+static Api_Function functions[] = {
+	{.name = "send_hm10clone_test_cmd", .call = call_test, .kind = Kind_Cmd, .rx_count = 1},
+	{.name = "send_hm10clone_reset_cmd", .call = call_reset, .kind = Kind_Cmd, .rx_count = 1},
+	#if HM10_CLONE_NAME_CMDS
+		{.name = "set_hm10clone_name", .call = call_set_name, .kind = Kind_Cmd, .rx_count = 2},
+		#if HM10_CLONE_GETTER_CMDS
+			{.name = "get_hm10clone_name", .call = call_get_name, .kind = Kind_Cmd, .rx_count = 1 + HM10_CLONE_MAX_BLE_NAME_SIZE},
+		#endif
+	#endif
+	#if HM10_CLONE_ROLE_CMDS
+		{.name = "set_hm10clone_role", .call = call_set_role, .kind = Kind_Cmd, .rx_count = 1},
+		#if HM10_CLONE_GETTER_CMDS
+			{.name = "get_hm10clone_role", .call = call_get_role, .kind = Kind_Cmd, .rx_count = 1},
+		#endif
+	#endif
+	#if HM10_CLONE_PIN_CMDS
+		{.name = "set_hm10clone_pin", .call = call_set_pin, .kind = Kind_Cmd, .rx_count = 2},
+		#if HM10_CLONE_GETTER_CMDS
+			{.name = "get_hm10clone_pin", .call = call_get_pin, .kind = Kind_Cmd, .rx_count = 1},
+		#endif
+	#endif
+	#if HM10_CLONE_TYPE_CMDS
+		{.name = "set_hm10clone_pin_code_mode", .call = call_set_pin_code_mode, .kind = Kind_Cmd, .rx_count = 2},
+		#if HM10_CLONE_GETTER_CMDS
+			{.name = "get_hm10clone_pin_code_mode", .call = call_get_pin_code_mode, .kind = Kind_Cmd, .rx_count = 1},
+		#endif
+	#endif
+	{.name = "send_hm10clone_ota_data", .call = call_send_ota_data, .kind = Kind_Ota, .rx_count = 0},
+	{.name = "send_hm10clone_ota_data_vectored", .call = call_send_ota_data_vectored, .kind = Kind_Ota, .rx_count = 0},
+	{.name = "get_hm10clone_ota_data", .call = call_get_ota_data, .kind = Kind_Ota, .rx_count = 0},
+	#if HM10_CLONE_CENTRAL_API
+		{.name = "scan_hm10clone_devices", .call = call_scan, .kind = Kind_Scan, .rx_count = 0},
+		{.name = "connect_hm10clone_device", .call = call_connect, .kind = Kind_Connect, .rx_count = 0},
+		{.name = "set_hm10clone_auto_reconnect", .call = call_auto_reconnect, .kind = Kind_Cmd, .rx_count = 1},
+	#endif
+};
+
+/**@brief	Derives the time budget of a function from the configurations of the @ref hm10_ble_clone .
+ *
+ * @details Each attempt of an AT Command flushes the RX of the UART, which can take up to
+ *          @ref HM10_CLONE_MAX_FLUSH_BYTES receptions of @ref HM10_CLONE_CUSTOM_HAL_TIMEOUT each, then sends the AT
+ *          Command and then receives its Responses, where each transmission and reception takes up to its timeout.
+ *          The attempts are given by the retry policy together with the backoffs between them.
+ *
+ * @param[in] function	Function whose time budget is derived.
+ *
+ * @return	The time budget in milliseconds.
+ */
+static uint32_t derive_budget_ms(const Api_Function *function)
+{
+	#if HM10_CLONE_ADAPTIVE_TIMEOUT
+		const uint32_t transfer_ms = HM10_CLONE_ADAPTIVE_TIMEOUT_MAX;
+	#else
+		const uint32_t transfer_ms = HM10_CLONE_CUSTOM_HAL_TIMEOUT;
+	#endif
+	const uint32_t flush_ms = HM10_CLONE_MAX_FLUSH_BYTES * HM10_CLONE_CUSTOM_HAL_TIMEOUT;
+	HM10_Clone_Retry_Policy policy;
+	uint32_t attempt_ms;
+	uint32_t budget_ms = 0;
+
+	switch (function->kind)
+	{
+		case Kind_Ota:
+			return OTA_TIMEOUT + SLACK_MS;
+		case Kind_Scan:
+			attempt_ms = flush_ms + transfer_ms + SCAN_TIMEOUT;
+			break;
+		case Kind_Connect:
+			attempt_ms = flush_ms + transfer_ms + CONNECT_TIMEOUT + flush_ms;
+			break;
+		default:
+			attempt_ms = flush_ms + transfer_ms + function->rx_count * transfer_ms;
+			break;
+	}
+	get_hm10clone_retry_policy(&policy);
+	for (uint8_t attempt=1; attempt<=policy.max_attempts; attempt++)
+	{
+		budget_ms += attempt_ms + SLACK_MS;
+		if (attempt < policy.max_attempts)
+		{
+			budget_ms += policy.backoff_ms[((attempt > HM10_CLONE_RETRY_BACKOFF_STEPS) ? HM10_CLONE_RETRY_BACKOFF_STEPS : attempt) - 1];
+		}
+	}
+	return budget_ms;
+}
+
+/**@brief	Entry point of the context of each call.
+ */
+static void run_entry(void)
+{
+	run_function->call();
+}
+
+/**@brief	Calls a function against a scenario on a painted stack.
+ *
+ * @param[in,out] function	Function to call, whose worst measurements are updated.
+ * @param the_scenario		Scenario of the simulated device.
+ * @param[out] elapsed_ms	Time in milliseconds that the call took.
+ * @param[out] stack		Depth in bytes of the stack that the call used.
+ *
+ * @return	\c 1 if the call returned. Otherwise, \c 0 .
+ */
+static uint8_t run_call(Api_Function *function, Scenario the_scenario, uint32_t *elapsed_ms, uint32_t *stack)
+{
+	GPIO_def_t state_pin = {&state_port, 1};
+	uint64_t start_us;
+
+	/* Start each call from a fresh module and a fresh simulated device. */
+	scenario = the_scenario;
+	rx_head = rx_tail = 0;
+	rx_next_us = 0;
+	drip_byte = 0;
+	garbage_seed = 1;
+	tx_line_size = 0;
+	connected_us = 0;
+	init_hm10_clone_module(&huart);
+	#if HM10_CLONE_STATE_PIN
+		set_hm10clone_state_pin(&state_pin);
+	#else
+		(void) state_pin;
+	#endif
+
+	memset(run_stack, STACK_PAINT, sizeof(run_stack));
+	getcontext(&run_context);
+	run_context.uc_stack.ss_sp = run_stack;
+	run_context.uc_stack.ss_size = sizeof(run_stack);
+	run_context.uc_link = &main_context;
+	makecontext(&run_context, run_entry, 0);
+	run_function = function;
+	run_aborted = 0;
+	hal_calls = 0;
+	start_us = now_us;
+	swapcontext(&main_context, &run_context);
+
+	*elapsed_ms = (uint32_t) ((now_us - start_us + 999U) / 1000U);
+	for (*stack = 0; (*stack < sizeof(run_stack)) && (run_stack[*stack] == STACK_PAINT); (*stack)++);
+	*stack = sizeof(run_stack) - *stack;
+	return !run_aborted;
+}
+
+/**@brief	Gives the depth of stack that is used by the context of each call itself, which is not accounted to the
+ *          functions.
+ *
+ * @return	The depth in bytes of that stack.
+ */
+static uint32_t baseline_stack(void)
+{
+	Api_Function empty = {.name = "", .call = call_nothing, .kind = Kind_Ota};
+	uint32_t elapsed_ms;
+	uint32_t stack;
+
+	run_call(&empty, Scenario_Silence, &elapsed_ms, &stack);
+	return stack;
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t stack_budget = DEFAULT_STACK_BUDGET;
+	uint32_t global_budget_ms = 0;
+	const char *overrides[MAX_OVERRIDES];
+	int overrides_count = 0;
+	int verbose = 0;
+	int option;
+
+	huart.Init.BaudRate = DEFAULT_BAUD_RATE;
+	while ((option = getopt(argc, argv, "b:s:t:f:v")) != -1)
+	{
+		switch (option)
+		{
+			case 'b': huart.Init.BaudRate = strtoul(optarg, NULL, 10); break;
+			case 's': stack_budget = strtoul(optarg, NULL, 10); break;
+			case 't': global_budget_ms = strtoul(optarg, NULL, 10); break;
+			case 'v': verbose = 1; break;
+			case 'f':
+				if ((overrides_count < MAX_OVERRIDES) && (strchr(optarg, '=') != NULL))
+				{
+					overrides[overrides_count++] = optarg;
+					break;
+				}
+				/* fall through */
+			default:
+				fprintf(stderr, "Usage: %s [-b baud] [-s stack bytes] [-t ms] [-f function=ms]... [-v]\n", argv[0]);
+				return 1;
+		}
+	}
+	if (huart.Init.BaudRate == 0)
+	{
+		fprintf(stderr, "ERROR: The baud rate must not be 0.\n");
+		return 1;
+	}
+	byte_time_us = (10U * 1000000U + huart.Init.BaudRate - 1) / huart.Init.BaudRate;
+
+	/* Get the time budget of each function. */
+	const size_t functions_count = sizeof(functions) / sizeof(functions[0]);
+	for (size_t f=0; f<functions_count; f++)
+	{
+		functions[f].budget_ms = global_budget_ms ? global_budget_ms : derive_budget_ms(&functions[f]);
+	}
+	for (int o=0; o<overrides_count; o++)
+	{
+		size_t name_size = strchr(overrides[o], '=') - overrides[o];
+		size_t f;
+		for (f=0; f<functions_count; f++)
+		{
+			if ((strlen(functions[f].name) == name_size) && (strncmp(functions[f].name, overrides[o], name_size) == 0))
+			{
+				functions[f].budget_ms = strtoul(&overrides[o][name_size + 1], NULL, 10);
+				break;
+			}
+		}
+		if (f == functions_count)
+		{
+			fprintf(stderr, "ERROR: Unknown function in \"-f %s\".\n", overrides[o]);
+			return 1;
+		}
+	}
+
+	/* Call every function once beforehand, so that the lazy binding of the host does not count towards the first call. */
+	for (size_t f=0; f<functions_count; f++)
+	{
+		uint32_t elapsed_ms;
+		uint32_t stack;
+		run_call(&functions[f], Scenario_Valid, &elapsed_ms, &stack);
+	}
+
+	/* Call every function against every scenario. */
+	uint32_t baseline = baseline_stack();
+	for (size_t f=0; f<functions_count; f++)
+	{
+		Api_Function *function = &functions[f];
+		for (int s=0; s<Scenario_Count; s++)
+		{
+			uint32_t elapsed_ms;
+			uint32_t stack;
+			uint8_t returned = run_call(function, (Scenario) s, &elapsed_ms, &stack);
+
+			stack = (stack > baseline) ? (stack - baseline) : 0;
+			if (!returned)
+			{
+				function->aborted = 1;
+			}
+			if (elapsed_ms > function->max_ms)
+			{
+				function->max_ms = elapsed_ms;
+				function->worst = (Scenario) s;
+			}
+			if (stack > function->max_stack)
+			{
+				function->max_stack = stack;
+			}
+			if (verbose)
+			{
+				printf("  %-34s %-10s %8u ms %6u B%s\n", function->name, scenario_names[s], elapsed_ms, stack, returned ? "" : "  (did not return)");
+			}
+		}
+	}
+
+	/* Display the worst measurements of each function against its budgets. */
+	int failures = 0;
+	printf("%-34s %-10s %10s %10s %8s %8s  %s\n", "Function", "Worst", "Time ms", "Budget ms", "Stack B", "Budget B", "Verdict");
+	for (size_t f=0; f<functions_count; f++)
+	{
+		const Api_Function *function = &functions[f];
+		int failed = function->aborted || (function->max_ms > function->budget_ms) || (function->max_stack > stack_budget);
+
+		failures += failed;
+		printf("%-34s %-10s %10u %10u %8u %8u  %s\n", function->name, scenario_names[function->worst], function->max_ms,
+				function->budget_ms, function->max_stack, stack_budget, function->aborted ? "FAIL (did not return)" : (failed ? "FAIL" : "PASS"));
+	}
+	printf("\n%d of %zu functions exceeded their budgets at %u baud.\n", failures, functions_count, huart.Init.BaudRate);
+
+	return (failures > 0) ? 1 : 0;
+}
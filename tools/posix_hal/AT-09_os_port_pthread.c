@@ -0,0 +1,138 @@
+/**@file
+ * @brief	POSIX threads porting file of the AT-09 zs040 BLE Driver.
+ *
+ * @details See "AT-09_os_port_pthread.h" in this same folder.
+ *
+ * @date	October 18, 2026.
+ */
+
+#include "AT-09_os_port_pthread.h"
+
+#if HM10_CLONE_RTOS
+#include <stdlib.h>		// Library from which "malloc" and "free" are located at.
+#include <pthread.h>	// Library from which "pthread_mutex_t" and "pthread_cond_t" are located at.
+#include <time.h>		// Library from which "clock_gettime" is located at.
+
+/**@brief	Binary semaphore, which is made of a condition variable over the monotonic clock.
+ */
+typedef struct
+{
+	pthread_mutex_t lock;	//!< Mutex that protects the \c count field.
+	pthread_cond_t cond;	//!< Condition variable that is signalled whenever the semaphore is given.
+	uint8_t count;			//!< \c 1 if the semaphore has been given and not taken yet. Otherwise, \c 0 .
+} Pthread_Semaphore;
+
+static void *mutex_create(void)
+{
+	pthread_mutex_t *mutex = malloc(sizeof(pthread_mutex_t));
+	pthread_mutexattr_t attr;
+
+	if (mutex == NULL)
+	{
+		return NULL;
+	}
+
+	/* Just like the CMSIS-RTOS2 port, the mutex is recursive and inherits the priority of the threads that wait on it. */
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+	if (pthread_mutex_init(mutex, &attr) != 0)
+	{
+		free(mutex);
+		mutex = NULL;
+	}
+	pthread_mutexattr_destroy(&attr);
+
+	return mutex;
+}
+
+static void mutex_lock(void *mutex)
+{
+	pthread_mutex_lock((pthread_mutex_t *) mutex);
+}
+
+static void mutex_unlock(void *mutex)
+{
+	pthread_mutex_unlock((pthread_mutex_t *) mutex);
+}
+
+static void *semaphore_create(void)
+{
+	Pthread_Semaphore *semaphore = malloc(sizeof(Pthread_Semaphore));
+	pthread_condattr_t attr;
+
+	if (semaphore == NULL)
+	{
+		return NULL;
+	}
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_mutex_init(&semaphore->lock, NULL);
+	pthread_cond_init(&semaphore->cond, &attr);
+	pthread_condattr_destroy(&attr);
+	semaphore->count = 0;
+
+	return semaphore;
+}
+
+static uint8_t semaphore_take(void *semaphore, uint32_t timeout)
+{
+	Pthread_Semaphore *sem = (Pthread_Semaphore *) semaphore;
+	struct timespec deadline;
+	uint8_t taken;
+
+	clock_gettime(CLOCK_MONOTONIC, &deadline);
+	deadline.tv_sec += timeout / 1000U;
+	deadline.tv_nsec += (long) (timeout % 1000U) * 1000000L;
+	if (deadline.tv_nsec >= 1000000000L)
+	{
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000L;
+	}
+
+	pthread_mutex_lock(&sem->lock);
+	while ((sem->count == 0) && (timeout != 0))
+	{
+		if (timeout == HAL_MAX_DELAY)
+		{
+			pthread_cond_wait(&sem->cond, &sem->lock);
+		}
+		else if (pthread_cond_timedwait(&sem->cond, &sem->lock, &deadline) != 0)
+		{
+			break;
+		}
+	}
+	taken = sem->count;
+	sem->count = 0;
+	pthread_mutex_unlock(&sem->lock);
+
+	return taken;
+}
+
+static void semaphore_give(void *semaphore)
+{
+	Pthread_Semaphore *sem = (Pthread_Semaphore *) semaphore;
+
+	/* This is called from the service thread of the UART of the shim, which is the equivalent of an interrupt. */
+	pthread_mutex_lock(&sem->lock);
+	sem->count = 1;
+	pthread_cond_signal(&sem->cond);
+	pthread_mutex_unlock(&sem->lock);
+}
+
+static void delay(uint32_t ms)
+{
+	HAL_Delay(ms);
+}
+
+const HM10_Clone_OS_Port hm10clone_pthread_os_port =
+{
+	.mutex_create = mutex_create,
+	.mutex_lock = mutex_lock,
+	.mutex_unlock = mutex_unlock,
+	.semaphore_create = semaphore_create,
+	.semaphore_take = semaphore_take,
+	.semaphore_give = semaphore_give,
+	.delay = delay
+};
+#endif
@@ -0,0 +1,35 @@
+/**@file
+ * @brief	POSIX threads porting file of the AT-09 zs040 BLE Driver.
+ *
+ * @details This header file provides the @ref HM10_Clone_OS_Port of POSIX threads, so that the @ref hm10_ble_clone can
+ *          be compiled with @ref HM10_CLONE_RTOS enabled and be called from several threads of a host computer, just
+ *          like it would be from several tasks of an RTOS. The UART interrupts are emulated by the service thread of
+ *          the POSIX serial port shim of the HAL that is located at this same folder (see "stm32f1xx_hal.h"), whose
+ *          default callbacks already call @ref hm10clone_uart_tx_cplt_isr , @ref hm10clone_uart_rx_cplt_isr and
+ *          @ref hm10clone_uart_error_isr . Therefore, only the following has to be done:
+ *          @code
+ *          set_hm10clone_os_port(&hm10clone_pthread_os_port);
+ *          init_hm10_clone_module(&huart);
+ *          @endcode
+ *
+ * @date	October 18, 2026.
+ */
+
+#ifndef AT_09_OS_PORT_PTHREAD_H_
+#define AT_09_OS_PORT_PTHREAD_H_
+
+#include "AT-09_zs040_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from a AT-09 zs040 BLE Device.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if HM10_CLONE_RTOS
+extern const HM10_Clone_OS_Port hm10clone_pthread_os_port; /**< @brief Porting interface of POSIX threads for the @ref hm10_ble_clone . */
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT_09_OS_PORT_PTHREAD_H_ */
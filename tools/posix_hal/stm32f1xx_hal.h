@@ -0,0 +1,164 @@
+/**@file
+ * @brief	POSIX serial port shim of the STM32 HAL Driver for the AT-09 zs040 BLE Driver.
+ *
+ * @details This header file takes the place of "stm32f1xx_hal.h" whenever the @ref hm10_ble_clone is compiled for a
+ *          host computer instead of for an STM32 MCU/MPU, so that its AT Command engine can drive HM-10 Clone BLE
+ *          Devices that are attached to the host through USB-serial adapters. Only the parts of the HAL that the
+ *          @ref hm10_ble_clone uses in its polling mode are provided, where each UART is backed by the file descriptor of
+ *          a serial port (see @ref hal_posix_uart_open ).
+ *
+ *          The interrupt mode of the UART is emulated by a service thread per UART, which makes the transfers of
+ *          @ref HAL_UART_Transmit_IT and @ref HAL_UART_Receive_IT as the serial port becomes ready and then calls
+ *          @ref HAL_UART_TxCpltCallback , @ref HAL_UART_RxCpltCallback or @ref HAL_UART_ErrorCallback from that thread,
+ *          just like the UART interrupt would. Unless the application defines them, those callbacks are routed to the
+ *          ones of the @ref hm10_ble_clone (e.g., @ref hm10clone_uart_rx_cplt_isr ), so that both
+ *          @ref HM10_CLONE_NONBLOCKING_API and @ref HM10_CLONE_RTOS can be used on the host (see
+ *          "AT-09_os_port_pthread.h" in this same folder for the @ref HM10_Clone_OS_Port of the latter).
+ *
+ * @note    The @ref hm10_ble_clone must be compiled with @ref HM10_CLONE_ZERO_COPY_RX and @ref HM10_CLONE_TIMER left
+ *          disabled, since this shim does not provide the DMA nor the timers of the STM32 MCU/MPU, and this shim has to
+ *          be linked with "-pthread".
+ * @note    This shim also defines @ref HM10_CLONE_PING_CLOCK and @ref HM10_CLONE_OTA_BENCHMARK_CLOCK over a monotonic
+ *          clock of the host computer (see @ref hal_posix_clock_us ), since there is no DWT Cycle Counter there.
+ *
+ * @date	October 18, 2026.
+ */
+
+#ifndef STM32F1XX_HAL_POSIX_H_
+#define STM32F1XX_HAL_POSIX_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <stddef.h> // Library from which "NULL" is located at.
+#include <pthread.h> // Library from which "pthread_t" and "pthread_mutex_t" are located at.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HAL_MAX_DELAY											(0xFFFFFFFFU)	/**< @brief Timeout value with which a HAL function waits forever. */
+#define HM10_CLONE_PING_CLOCK()									(hal_posix_clock_us())	/**< @brief Clock of the probe frames of the @ref AT_09_ping , since there is no DWT Cycle Counter on a host computer. */
+#define HM10_CLONE_PING_CLOCK_HZ								(1000000U)		/**< @brief Frequency in Hertz of @ref HM10_CLONE_PING_CLOCK . */
+#define HM10_CLONE_OTA_BENCHMARK_CLOCK()						(hal_posix_clock_us())	/**< @brief Clock of the OTA data path measurements of the @ref hm10_ble_clone , since there is no DWT Cycle Counter on a host computer. */
+#define HM10_CLONE_OTA_BENCHMARK_CLOCK_HZ						(1000000U)		/**< @brief Frequency in Hertz of @ref HM10_CLONE_OTA_BENCHMARK_CLOCK . */
+#define HAL_UART_ERROR_NONE										(0x00000000U)	/**< @brief No error of the UART. */
+#define HAL_UART_ERROR_NE										(0x00000002U)	/**< @brief Noise error of the UART, which is the one given by this shim whenever the serial port fails. */
+
+/**@brief	HAL Status structures definition.
+ */
+typedef enum
+{
+	HAL_OK			= 0x00U,
+	HAL_ERROR		= 0x01U,
+	HAL_BUSY		= 0x02U,
+	HAL_TIMEOUT		= 0x03U
+} HAL_StatusTypeDef;
+
+/**@brief	HAL UART State structures definition.
+ */
+typedef enum
+{
+	HAL_UART_STATE_RESET	= 0x00U,	//!< The UART is not initialized yet.
+	HAL_UART_STATE_READY	= 0x20U,	//!< The UART is initialized and ready for a transfer.
+	HAL_UART_STATE_BUSY_TX	= 0x21U,	//!< A transmission is in progress.
+	HAL_UART_STATE_BUSY_RX	= 0x22U		//!< A reception is in progress.
+} HAL_UART_StateTypeDef;
+
+/**@brief	UART Init Structure definition, of which only the baud rate is used.
+ */
+typedef struct
+{
+	uint32_t BaudRate;	//!< Baud rate of the serial port.
+} UART_InitTypeDef;
+
+/**@brief	UART Handle Structure definition, which is backed by the file descriptor of a serial port.
+ */
+typedef struct
+{
+	UART_InitTypeDef Init;						//!< Configuration of the serial port.
+	int fd;										//!< File descriptor of the serial port.
+	const uint8_t *pTxBuffPtr;					//!< Data of the transmission of @ref HAL_UART_Transmit_IT , or \c NULL if there is none.
+	uint16_t TxXferSize;						//!< Length in bytes of the transmission of @ref HAL_UART_Transmit_IT .
+	uint16_t TxXferCount;						//!< Bytes of the transmission of @ref HAL_UART_Transmit_IT that are still to be sent.
+	uint8_t *pRxBuffPtr;						//!< Buffer of the reception of @ref HAL_UART_Receive_IT , or \c NULL if there is none.
+	uint16_t RxXferSize;						//!< Length in bytes of the reception of @ref HAL_UART_Receive_IT .
+	uint16_t RxXferCount;						//!< Bytes of the reception of @ref HAL_UART_Receive_IT that are still to be received.
+	volatile HAL_UART_StateTypeDef gState;		//!< State of the transmissions of the UART.
+	volatile HAL_UART_StateTypeDef RxState;		//!< State of the receptions of the UART.
+	volatile uint32_t ErrorCode;				//!< Errors of the last transfer of the UART (e.g., @ref HAL_UART_ERROR_NE ).
+	pthread_t it_thread;						//!< Service thread that emulates the interrupt mode of the UART.
+	pthread_mutex_t it_lock;					//!< Mutex that serialises the fields of the transfers with the service thread.
+	int it_wake_fd[2];							//!< Pipe through which the service thread is woken up whenever a transfer is started or aborted.
+	volatile uint8_t it_stop;					//!< Flag that tells the service thread to exit.
+} UART_HandleTypeDef;
+
+/**@brief	GPIO Port definition, which has no equivalent on a host computer.
+ */
+typedef struct
+{
+	uint32_t IDR;	//!< Input data of the GPIO Port.
+	uint32_t ODR;	//!< Output data of the GPIO Port.
+} GPIO_TypeDef;
+
+/**@brief	GPIO Bit SET and Bit RESET enumeration.
+ */
+typedef enum
+{
+	GPIO_PIN_RESET = 0U,
+	GPIO_PIN_SET
+} GPIO_PinState;
+
+/**@brief	Opens a serial port and configures it in raw mode, with 8 data bits, no parity and 1 stop bit.
+ *
+ * @param[out] huart	Pointer to the UART Handle Structure that will be backed by the serial port.
+ * @param[in] path		Path of the serial port (e.g., "/dev/ttyUSB0").
+ * @param baud_rate		Baud rate of the serial port.
+ *
+ * @retval	HAL_OK		if the serial port was opened.
+ * @retval	HAL_ERROR	otherwise.
+ */
+HAL_StatusTypeDef hal_posix_uart_open(UART_HandleTypeDef *huart, const char *path, uint32_t baud_rate);
+
+/**@brief	Backs a UART Handle Structure with a file descriptor that is already open (e.g., the master side of a
+ *          pseudo-terminal pair), which is made non-blocking, and starts the service thread of its interrupt mode.
+ *
+ * @note    This is already done by @ref hal_posix_uart_open .
+ *
+ * @param[out] huart	Pointer to the UART Handle Structure that will be backed by the file descriptor.
+ * @param fd			File descriptor, which is closed by @ref hal_posix_uart_close .
+ *
+ * @retval	HAL_OK		if the UART Handle Structure is ready to be used.
+ * @retval	HAL_ERROR	otherwise.
+ */
+HAL_StatusTypeDef hal_posix_uart_attach(UART_HandleTypeDef *huart, int fd);
+
+/**@brief	Closes the serial port of a UART Handle Structure, after stopping the service thread of its interrupt mode.
+ *
+ * @param[in,out] huart	Pointer to the UART Handle Structure whose serial port will be closed.
+ */
+void hal_posix_uart_close(UART_HandleTypeDef *huart);
+
+/**@brief	Gets the time elapsed on a monotonic clock with a resolution of one microsecond.
+ *
+ * @return	The time in microseconds, which wraps around every 2^32 microseconds.
+ */
+uint32_t hal_posix_clock_us(void);
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart);
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32F1XX_HAL_POSIX_H_ */
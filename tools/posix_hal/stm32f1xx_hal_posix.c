@@ -0,0 +1,529 @@
+/**@file
+ * @brief	POSIX serial port shim of the STM32 HAL Driver for the AT-09 zs040 BLE Driver.
+ *
+ * @details See "stm32f1xx_hal.h" in this same folder.
+ *
+ * @date	October 18, 2026.
+ */
+
+#include "stm32f1xx_hal.h"
+#include <fcntl.h>		// Library from which "open" and "fcntl" are located at.
+#include <unistd.h>		// Library from which "read", "write", "pipe" and "close" are located at.
+#include <termios.h>	// Library from which "tcgetattr", "cfmakeraw" and "tcsetattr" are located at.
+#include <poll.h>		// Library from which "poll" is located at.
+#include <errno.h>		// Library from which "errno" is located at.
+#include <time.h>		// Library from which "clock_gettime" and "nanosleep" are located at.
+
+/* Callbacks of the AT-09 zs040 BLE Driver, which are weak references so that this shim can also be linked whenever they
+ * are not compiled (e.g., with HM10_CLONE_NONBLOCKING_API and HM10_CLONE_RTOS disabled). */
+extern void hm10clone_uart_tx_cplt_isr(UART_HandleTypeDef *huart) __attribute__((weak));
+extern void hm10clone_uart_rx_cplt_isr(UART_HandleTypeDef *huart) __attribute__((weak));
+extern void hm10clone_uart_error_isr(UART_HandleTypeDef *huart) __attribute__((weak));
+
+/**@brief	Gets the termios speed constant of a baud rate.
+ *
+ * @param baud_rate	Baud rate in bits per second.
+ *
+ * @return	The termios speed constant, or \c B0 if the \p baud_rate param is not supported.
+ */
+static speed_t baud_rate_to_speed(uint32_t baud_rate)
+{
+	switch (baud_rate)
+	{
+		case 1200:		return B1200;
+		case 2400:		return B2400;
+		case 4800:		return B4800;
+		case 9600:		return B9600;
+		case 19200:		return B19200;
+		case 38400:		return B38400;
+		case 57600:		return B57600;
+		case 115200:	return B115200;
+		case 230400:	return B230400;
+		default:		return B0;
+	}
+}
+
+/**@brief	Waits until a file descriptor is ready or until a deadline expires.
+ *
+ * @param fd		File descriptor.
+ * @param events	Events of @ref poll that are waited for.
+ * @param deadline	HAL Tick at which the wait expires.
+ * @param forever	Flag that indicates whether the \p deadline param is to be ignored.
+ *
+ * @return	\c 1 if the file descriptor is ready, \c 0 if the deadline expired or \c -1 on error.
+ */
+static int wait_fd(int fd, short events, uint32_t deadline, int forever)
+{
+	struct pollfd pfd = {.fd = fd, .events = events};
+	int ret;
+
+	do
+	{
+		int timeout_ms = -1;
+		if (!forever)
+		{
+			int32_t remaining = (int32_t) (deadline - HAL_GetTick());
+			timeout_ms = (remaining > 0) ? remaining : 0;
+		}
+		ret = poll(&pfd, 1, timeout_ms);
+	}
+	while ((ret < 0) && (errno == EINTR));
+	if (ret <= 0)
+	{
+		return ret;
+	}
+
+	return (pfd.revents & (POLLERR | POLLNVAL)) ? -1 : 1;
+}
+
+/**@brief	Wakes up the service thread of a UART so that it looks again at its transfers.
+ *
+ * @param[in] huart	Pointer to the UART Handle Structure.
+ */
+static void wake_it_thread(UART_HandleTypeDef *huart)
+{
+	uint8_t byte = 0;
+
+	if (write(huart->it_wake_fd[1], &byte, 1) < 0)
+	{
+		/* The pipe is only full whenever the service thread has yet to be woken up anyway. */
+	}
+}
+
+/**@brief	Makes as much as possible of the transfer of @ref HAL_UART_Transmit_IT or of @ref HAL_UART_Receive_IT of a UART
+ *          without blocking, and calls the callback of its completion or of its failure, if any.
+ *
+ * @param[in,out] huart	Pointer to the UART Handle Structure.
+ * @param is_rx			\c 1 for the reception of the UART or \c 0 for its transmission.
+ */
+static void service_it_transfer(UART_HandleTypeDef *huart, int is_rx)
+{
+	void (*callback)(UART_HandleTypeDef *huart) = NULL;
+	ssize_t n;
+
+	pthread_mutex_lock(&huart->it_lock);
+	if (is_rx && (huart->RxState == HAL_UART_STATE_BUSY_RX) && (huart->pRxBuffPtr != NULL))
+	{
+		n = read(huart->fd, &huart->pRxBuffPtr[huart->RxXferSize - huart->RxXferCount], huart->RxXferCount);
+		if (n > 0)
+		{
+			huart->RxXferCount -= n;
+		}
+		if ((n == 0) || (huart->RxXferCount == 0) || ((n < 0) && (errno != EAGAIN) && (errno != EINTR)))
+		{
+			callback = HAL_UART_RxCpltCallback;
+			if (huart->RxXferCount != 0)
+			{
+				callback = HAL_UART_ErrorCallback;
+				huart->ErrorCode |= HAL_UART_ERROR_NE;
+			}
+			huart->pRxBuffPtr = NULL;
+			huart->RxState = HAL_UART_STATE_READY;
+		}
+	}
+	else if (!is_rx && (huart->gState == HAL_UART_STATE_BUSY_TX) && (huart->pTxBuffPtr != NULL))
+	{
+		n = write(huart->fd, &huart->pTxBuffPtr[huart->TxXferSize - huart->TxXferCount], huart->TxXferCount);
+		if (n > 0)
+		{
+			huart->TxXferCount -= n;
+		}
+		if ((huart->TxXferCount == 0) || ((n < 0) && (errno != EAGAIN) && (errno != EINTR)))
+		{
+			callback = HAL_UART_TxCpltCallback;
+			if (huart->TxXferCount != 0)
+			{
+				callback = HAL_UART_ErrorCallback;
+				huart->ErrorCode |= HAL_UART_ERROR_NE;
+			}
+			huart->pTxBuffPtr = NULL;
+			huart->gState = HAL_UART_STATE_READY;
+		}
+	}
+	pthread_mutex_unlock(&huart->it_lock);
+
+	/* Just like the STM32 HAL, the transfer is concluded before its callback is called, so that it can start the next one. */
+	if (callback != NULL)
+	{
+		callback(huart);
+	}
+}
+
+/**@brief	Service thread of a UART, which emulates its interrupt mode until @ref hal_posix_uart_close is called.
+ *
+ * @param[in,out] arg	Pointer to the UART Handle Structure.
+ *
+ * @return	\c NULL .
+ */
+static void *run_it_thread(void *arg)
+{
+	UART_HandleTypeDef *huart = (UART_HandleTypeDef *) arg;
+	uint8_t wake[16];
+
+	while (!huart->it_stop)
+	{
+		struct pollfd pfd[2] = {{.fd = huart->it_wake_fd[0], .events = POLLIN}, {.fd = huart->fd, .events = 0}};
+
+		/* Only wait for the serial port while there is a transfer, since it would otherwise keep this thread spinning
+		 * whenever it has unread bytes or whenever it has been hung up. */
+		pthread_mutex_lock(&huart->it_lock);
+		if ((huart->gState == HAL_UART_STATE_BUSY_TX) && (huart->pTxBuffPtr != NULL))
+		{
+			pfd[1].events |= POLLOUT;
+		}
+		if ((huart->RxState == HAL_UART_STATE_BUSY_RX) && (huart->pRxBuffPtr != NULL))
+		{
+			pfd[1].events |= POLLIN;
+		}
+		pthread_mutex_unlock(&huart->it_lock);
+		if (poll(pfd, (pfd[1].events != 0) ? 2 : 1, -1) < 0)
+		{
+			continue;
+		}
+		if (pfd[0].revents & POLLIN)
+		{
+			while (read(huart->it_wake_fd[0], wake, sizeof(wake)) > 0)
+			{
+			}
+		}
+		if (pfd[1].revents != 0)
+		{
+			service_it_transfer(huart, 0);
+			service_it_transfer(huart, 1);
+		}
+	}
+
+	return NULL;
+}
+
+HAL_StatusTypeDef hal_posix_uart_open(UART_HandleTypeDef *huart, const char *path, uint32_t baud_rate)
+{
+	struct termios tio;
+	speed_t speed = baud_rate_to_speed(baud_rate);
+
+	if (speed == B0)
+	{
+		return HAL_ERROR;
+	}
+	huart->gState = HAL_UART_STATE_RESET;
+	huart->RxState = HAL_UART_STATE_RESET;
+	huart->fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+	if (huart->fd < 0)
+	{
+		return HAL_ERROR;
+	}
+	if (tcgetattr(huart->fd, &tio) != 0)
+	{
+		hal_posix_uart_close(huart);
+		return HAL_ERROR;
+	}
+	cfmakeraw(&tio);
+	tio.c_cflag |= CLOCAL | CREAD;
+	tio.c_cflag &= ~(CSTOPB | CRTSCTS);
+	cfsetispeed(&tio, speed);
+	cfsetospeed(&tio, speed);
+	if (tcsetattr(huart->fd, TCSANOW, &tio) != 0)
+	{
+		hal_posix_uart_close(huart);
+		return HAL_ERROR;
+	}
+	tcflush(huart->fd, TCIOFLUSH);
+	huart->Init.BaudRate = baud_rate;
+
+	return hal_posix_uart_attach(huart, huart->fd);
+}
+
+HAL_StatusTypeDef hal_posix_uart_attach(UART_HandleTypeDef *huart, int fd)
+{
+	/* Start the service thread that emulates the interrupt mode of the UART. */
+	huart->fd = fd;
+	huart->gState = HAL_UART_STATE_RESET;
+	huart->RxState = HAL_UART_STATE_RESET;
+	huart->pTxBuffPtr = NULL;
+	huart->pRxBuffPtr = NULL;
+	huart->ErrorCode = HAL_UART_ERROR_NONE;
+	huart->it_stop = 0;
+	if ((fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) != 0) || (pipe(huart->it_wake_fd) != 0))
+	{
+		hal_posix_uart_close(huart);
+		return HAL_ERROR;
+	}
+	fcntl(huart->it_wake_fd[0], F_SETFL, O_NONBLOCK);
+	fcntl(huart->it_wake_fd[1], F_SETFL, O_NONBLOCK);
+	pthread_mutex_init(&huart->it_lock, NULL);
+	if (pthread_create(&huart->it_thread, NULL, run_it_thread, huart) != 0)
+	{
+		pthread_mutex_destroy(&huart->it_lock);
+		close(huart->it_wake_fd[0]);
+		close(huart->it_wake_fd[1]);
+		hal_posix_uart_close(huart);
+		return HAL_ERROR;
+	}
+	huart->gState = HAL_UART_STATE_READY;
+	huart->RxState = HAL_UART_STATE_READY;
+
+	return HAL_OK;
+}
+
+void hal_posix_uart_close(UART_HandleTypeDef *huart)
+{
+	if (huart->gState != HAL_UART_STATE_RESET)
+	{
+		huart->it_stop = 1;
+		wake_it_thread(huart);
+		pthread_join(huart->it_thread, NULL);
+		pthread_mutex_destroy(&huart->it_lock);
+		close(huart->it_wake_fd[0]);
+		close(huart->it_wake_fd[1]);
+		huart->gState = HAL_UART_STATE_RESET;
+		huart->RxState = HAL_UART_STATE_RESET;
+	}
+	if (huart->fd >= 0)
+	{
+		close(huart->fd);
+		huart->fd = -1;
+	}
+}
+
+/**@brief	Claims a direction of a UART for a transfer, just like the STM32 HAL does at the start of each transfer.
+ *
+ * @param[in,out] huart	Pointer to the UART Handle Structure.
+ * @param[in,out] state	State of the direction of the UART (i.e., its \c gState or its \c RxState field).
+ * @param busy			State that the direction of the UART is given whenever it is claimed.
+ *
+ * @retval	HAL_OK		if the direction of the UART was ready and has been claimed.
+ * @retval	HAL_BUSY	otherwise.
+ */
+static HAL_StatusTypeDef claim_uart(UART_HandleTypeDef *huart, volatile HAL_UART_StateTypeDef *state, HAL_UART_StateTypeDef busy)
+{
+	HAL_StatusTypeDef ret = HAL_BUSY;
+
+	pthread_mutex_lock(&huart->it_lock);
+	if (*state == HAL_UART_STATE_READY)
+	{
+		*state = busy;
+		huart->ErrorCode = HAL_UART_ERROR_NONE;
+		ret = HAL_OK;
+	}
+	pthread_mutex_unlock(&huart->it_lock);
+
+	return ret;
+}
+
+/**@brief	Releases a direction of a UART that was claimed with @ref claim_uart .
+ *
+ * @param[in,out] huart	Pointer to the UART Handle Structure.
+ * @param[in,out] state	State of the direction of the UART (i.e., its \c gState or its \c RxState field).
+ * @param ret			Result of the transfer, which is given back.
+ *
+ * @return	The \p ret param.
+ */
+static HAL_StatusTypeDef release_uart(UART_HandleTypeDef *huart, volatile HAL_UART_StateTypeDef *state, HAL_StatusTypeDef ret)
+{
+	pthread_mutex_lock(&huart->it_lock);
+	*state = HAL_UART_STATE_READY;
+	pthread_mutex_unlock(&huart->it_lock);
+
+	return ret;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	uint32_t deadline = HAL_GetTick() + Timeout;
+	uint16_t sent = 0;
+
+	if (claim_uart(huart, &huart->gState, HAL_UART_STATE_BUSY_TX) != HAL_OK)
+	{
+		return HAL_BUSY;
+	}
+	while (sent < Size)
+	{
+		ssize_t n = write(huart->fd, &pData[sent], Size - sent);
+		if (n > 0)
+		{
+			sent += n;
+			continue;
+		}
+		if ((n < 0) && (errno != EAGAIN) && (errno != EINTR))
+		{
+			return release_uart(huart, &huart->gState, HAL_ERROR);
+		}
+		int ready = wait_fd(huart->fd, POLLOUT, deadline, Timeout == HAL_MAX_DELAY);
+		if (ready == 0)
+		{
+			return release_uart(huart, &huart->gState, HAL_TIMEOUT);
+		}
+		if (ready < 0)
+		{
+			return release_uart(huart, &huart->gState, HAL_ERROR);
+		}
+	}
+
+	return release_uart(huart, &huart->gState, HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	uint32_t deadline = HAL_GetTick() + Timeout;
+	uint16_t received = 0;
+
+	if (claim_uart(huart, &huart->RxState, HAL_UART_STATE_BUSY_RX) != HAL_OK)
+	{
+		return HAL_BUSY;
+	}
+	/* Just like the STM32 HAL, the bytes of a reception that times out are lost. */
+	while (received < Size)
+	{
+		ssize_t n = read(huart->fd, &pData[received], Size - received);
+		if (n > 0)
+		{
+			received += n;
+			continue;
+		}
+		if ((n < 0) && (errno != EAGAIN) && (errno != EINTR))
+		{
+			return release_uart(huart, &huart->RxState, HAL_ERROR);
+		}
+		int ready = wait_fd(huart->fd, POLLIN, deadline, Timeout == HAL_MAX_DELAY);
+		if (ready == 0)
+		{
+			return release_uart(huart, &huart->RxState, HAL_TIMEOUT);
+		}
+		if (ready < 0)
+		{
+			return release_uart(huart, &huart->RxState, HAL_ERROR);
+		}
+	}
+
+	return release_uart(huart, &huart->RxState, HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size)
+{
+	if ((pData == NULL) || (Size == 0))
+	{
+		return HAL_ERROR;
+	}
+	if (claim_uart(huart, &huart->gState, HAL_UART_STATE_BUSY_TX) != HAL_OK)
+	{
+		return HAL_BUSY;
+	}
+	pthread_mutex_lock(&huart->it_lock);
+	huart->pTxBuffPtr = pData;
+	huart->TxXferSize = Size;
+	huart->TxXferCount = Size;
+	pthread_mutex_unlock(&huart->it_lock);
+	wake_it_thread(huart);
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+	if ((pData == NULL) || (Size == 0))
+	{
+		return HAL_ERROR;
+	}
+	if (claim_uart(huart, &huart->RxState, HAL_UART_STATE_BUSY_RX) != HAL_OK)
+	{
+		return HAL_BUSY;
+	}
+	pthread_mutex_lock(&huart->it_lock);
+	huart->pRxBuffPtr = pData;
+	huart->RxXferSize = Size;
+	huart->RxXferCount = Size;
+	pthread_mutex_unlock(&huart->it_lock);
+	wake_it_thread(huart);
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
+{
+	pthread_mutex_lock(&huart->it_lock);
+	huart->pTxBuffPtr = NULL;
+	huart->TxXferCount = 0;
+	huart->gState = HAL_UART_STATE_READY;
+	pthread_mutex_unlock(&huart->it_lock);
+	wake_it_thread(huart);
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
+{
+	pthread_mutex_lock(&huart->it_lock);
+	huart->pRxBuffPtr = NULL;
+	huart->RxXferCount = 0;
+	huart->RxState = HAL_UART_STATE_READY;
+	pthread_mutex_unlock(&huart->it_lock);
+	wake_it_thread(huart);
+
+	return HAL_OK;
+}
+
+__attribute__((weak)) void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+	if (hm10clone_uart_tx_cplt_isr != NULL)
+	{
+		hm10clone_uart_tx_cplt_isr(huart);
+	}
+}
+
+__attribute__((weak)) void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+	if (hm10clone_uart_rx_cplt_isr != NULL)
+	{
+		hm10clone_uart_rx_cplt_isr(huart);
+	}
+}
+
+__attribute__((weak)) void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+	if (hm10clone_uart_error_isr != NULL)
+	{
+		hm10clone_uart_error_isr(huart);
+	}
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+	return (GPIOx->IDR & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+	if (PinState == GPIO_PIN_SET)
+	{
+		GPIOx->ODR |= GPIO_Pin;
+	}
+	else
+	{
+		GPIOx->ODR &= ~(uint32_t) GPIO_Pin;
+	}
+}
+
+uint32_t hal_posix_clock_us(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint32_t) ((uint64_t) now.tv_sec * 1000000U + (uint64_t) now.tv_nsec / 1000U);
+}
+
+uint32_t HAL_GetTick(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint32_t) ((uint64_t) now.tv_sec * 1000U + (uint64_t) now.tv_nsec / 1000000U);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+	struct timespec delay = {.tv_sec = Delay / 1000U, .tv_nsec = (long) (Delay % 1000U) * 1000000L};
+
+	while ((nanosleep(&delay, &delay) != 0) && (errno == EINTR))
+	{
+	}
+}
@@ -0,0 +1,87 @@
+#!/bin/sh
+# @file
+# @brief	Flash/RAM footprint report of the AT-09 zs040 BLE Driver for each of its feature-trimmed build profiles.
+#
+# @details	Each profile is a set of configuration flags of "AT-09_config.h" (see PROFILES below). For each of them, every
+#           source file of the "Src" folder is compiled with arm-none-eabi-gcc and the sizes of the resulting objects
+#           are shown, where Flash = text + data and RAM = data + bss. The configurations of the application (i.e.,
+#           "AT-09_app_config.h") are not used, so that only the flags of each profile apply.
+#
+# @note		Usage: ./size_report.sh [-v] [-s <count>] [-p <profile>] -I <HAL include folder> [-I <folder>]...
+#           -v              Also show the sizes of each source file.
+#           -s <count>      Also show the <count> largest symbols of each profile.
+#           -p <profile>    Only report the given profile.
+#           -I <folder>     Include folder of the STM32 HAL (e.g., Drivers/STM32F1xx_HAL_Driver/Inc, together with the
+#                           CMSIS folders of the device), which can be given several times.
+#           The CC, SIZE and NM environment variables select the toolchain (arm-none-eabi-gcc, arm-none-eabi-size and
+#           arm-none-eabi-nm by default), while CFLAGS replaces the default flags of a Cortex-M3 (e.g., an STM32F103).
+#           The sources can also be checked on a host computer with the POSIX serial port shim of the HAL, for example
+#           with: CC=gcc SIZE=size NM=nm CFLAGS=-Os ./size_report.sh -I posix_hal
+#
+# @date		October 18, 2026.
+
+set -e
+
+CC=${CC:-arm-none-eabi-gcc}
+SIZE=${SIZE:-arm-none-eabi-size}
+NM=${NM:-arm-none-eabi-nm}
+CFLAGS=${CFLAGS:--mcpu=cortex-m3 -mthumb -Os -ffunction-sections -fdata-sections -DSTM32F103xB}
+
+# Name and configuration flags of each profile, from the largest to the smallest footprint.
+PROFILES='
+full		ETX_OTA_VERBOSE=1
+default
+peripheral	HM10_CLONE_CENTRAL_API=0 HM10_CLONE_NONBLOCKING_API=0
+set-only	HM10_CLONE_CENTRAL_API=0 HM10_CLONE_NONBLOCKING_API=0 HM10_CLONE_GETTER_CMDS=0 HM10_CLONE_STATS=0
+minimal		HM10_CLONE_CENTRAL_API=0 HM10_CLONE_NONBLOCKING_API=0 HM10_CLONE_GETTER_CMDS=0 HM10_CLONE_STATS=0 HM10_CLONE_ADAPTIVE_TIMEOUT=0 HM10_CLONE_NAME_CMDS=0 HM10_CLONE_ROLE_CMDS=0 HM10_CLONE_PIN_CMDS=0 HM10_CLONE_TYPE_CMDS=0 HM10_CLONE_STATE_PIN=0
+'
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+VERBOSE=0
+SYMBOLS=0
+ONLY=
+INCLUDES=
+while getopts "vs:p:I:" opt; do
+	case $opt in
+		v) VERBOSE=1 ;;
+		s) SYMBOLS=$OPTARG ;;
+		p) ONLY=$OPTARG ;;
+		I) INCLUDES="$INCLUDES -I$OPTARG" ;;
+		*) sed -n 's/^# @note\t\t//p; s/^#           -/  -/p' "$0" >&2; exit 1 ;;
+	esac
+done
+if [ -z "$INCLUDES" ]; then
+	echo "ERROR: The include folder of the STM32 HAL must be given with -I." >&2
+	exit 1
+fi
+
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+printf '%-30s %10s %10s %10s %12s %10s\n' "Profile" "text" "data" "bss" "Flash" "RAM"
+echo "$PROFILES" | while read -r name flags; do
+	if [ -z "$name" ] || { [ -n "$ONLY" ] && [ "$name" != "$ONLY" ]; }; then
+		continue
+	fi
+
+	defines="-DAT_09_APP_CONFIG_H_"
+	for flag in $flags; do
+		defines="$defines -D${flag%%=*}=(${flag#*=})"
+	done
+
+	mkdir -p "$OUT/$name"
+	for src in "$ROOT"/Src/*.c; do
+		# shellcheck disable=SC2086
+		$CC $CFLAGS $defines -I"$ROOT/Inc" $INCLUDES -c "$src" -o "$OUT/$name/$(basename "$src" .c).o"
+	done
+
+	$SIZE -t "$OUT/$name"/*.o | awk -v name="$name" -v verbose="$VERBOSE" '
+		NR == 1 { next }
+		$6 ~ /TOTALS/ { printf "%-30s %10d %10d %10d %12d %10d\n", name, $1, $2, $3, $1 + $2, $2 + $3; next }
+		verbose { n = split($6, path, "/"); printf "  %-28s %10d %10d %10d %12d %10d\n", path[n], $1, $2, $3, $1 + $2, $2 + $3 }
+	'
+
+	if [ "$SYMBOLS" -gt 0 ]; then
+		$NM -S --size-sort --radix=d "$OUT/$name"/*.o | awk 'NF == 4 { printf "    %10d %s %s\n", $2, $3, $4 }' | sort -nr | head -n "$SYMBOLS"
+	fi
+done